@@ -280,6 +280,17 @@ function(create_omr_compiler_library)
 		COMMENT "Generate ${BUILD_NAME_FILE}"
 	)
 
+	# Generate the simplifier's rewrite rules.
+	set(SIMPLIFIER_RULES_FILE "${CMAKE_BINARY_DIR}/${COMPILER_NAME}SimplifierRules.cpp")
+	set(SIMPLIFIER_RULES_SOURCE "${omr_SOURCE_DIR}/compiler/optimizer/OMRSimplifierRules.rules")
+	set(SIMPLIFIER_RULES_SCRIPT "${omr_SOURCE_DIR}/tools/compiler/scripts/generateSimplifierRules.pl")
+	add_custom_command(OUTPUT ${SIMPLIFIER_RULES_FILE}
+		COMMAND ${PERL_EXECUTABLE} ${SIMPLIFIER_RULES_SCRIPT} ${SIMPLIFIER_RULES_SOURCE} ${SIMPLIFIER_RULES_FILE}
+		DEPENDS ${SIMPLIFIER_RULES_SCRIPT} ${SIMPLIFIER_RULES_SOURCE}
+		VERBATIM
+		COMMENT "Generate ${SIMPLIFIER_RULES_FILE}"
+	)
+
 	omr_inject_object_modification_targets(COMPILER_OBJECTS ${COMPILER_NAME} ${COMPILER_OBJECTS})
 	
 	set(output_name_args "")
@@ -289,6 +300,7 @@ function(create_omr_compiler_library)
 	omr_add_library(${COMPILER_NAME} ${LIB_TYPE}
 		${output_name_args}
 		${BUILD_NAME_FILE}
+		${SIMPLIFIER_RULES_FILE}
 		${COMPILER_OBJECTS}
 	)
 
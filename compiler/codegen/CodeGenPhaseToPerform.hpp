@@ -26,6 +26,6 @@
 
 ReserveCodeCachePhase, LowerTreesPhase, UncommonCallConstNodesPhase, SetupForInstructionSelectionPhase,
     RemoveUnusedLocalsPhase, InstructionSelectionPhase, CreateStackAtlasPhase, RegisterAssigningPhase, MapStackPhase,
-    PeepholePhase, ExpandInstructionsPhase,
+    PeepholePhase, InstructionSchedulingPhase, ExpandInstructionsPhase,
 
     BinaryEncodingPhase, EmitSnippetsPhase, ProcessRelocationsPhase
@@ -517,6 +517,25 @@ void OMR::CodeGenPhase::performExpandInstructionsPhase(TR::CodeGenerator *cg, TR
         comp->getDebug()->dumpMethodInstrs(comp->log(), "Post Instruction Expansion Instructions", false, true);
 }
 
+void OMR::CodeGenPhase::performInstructionSchedulingPhase(TR::CodeGenerator *cg, TR::CodeGenPhase *phase)
+{
+    TR::Compilation *comp = cg->comp();
+
+    if (comp->getOption(TR_DisableInstructionScheduling)
+        || comp->getMethodHotness() < comp->getOptions()->getInstructionSchedulingOptLevel())
+        return;
+
+    phase->reportPhase(InstructionSchedulingPhase);
+
+    TR::LexicalMemProfiler mp(phase->getName(), comp->phaseMemProfiler());
+    LexicalTimer pt(phase->getName(), comp->phaseTimer());
+
+    bool performed = cg->scheduleInstructions();
+
+    if (performed && comp->getOption(TR_TraceCG))
+        comp->getDebug()->dumpMethodInstrs(comp->log(), "Post Instruction Scheduling Instructions", false, true);
+}
+
 const char *OMR::CodeGenPhase::getName() { return TR::CodeGenPhase::getName(_currentPhase); }
 
 const char *OMR::CodeGenPhase::getName(PhaseValue phase)
@@ -558,6 +577,8 @@ const char *OMR::CodeGenPhase::getName(PhaseValue phase)
             return "CleanUpFlagsPhase";
         case ExpandInstructionsPhase:
             return "ExpandInstructionsPhase";
+        case InstructionSchedulingPhase:
+            return "InstructionSchedulingPhase";
         default:
             TR_ASSERT(false, "TR::CodeGenPhase %d doesn't have a corresponding name.", phase);
             return NULL;
@@ -98,6 +98,7 @@ public:
     static void performCleanUpFlagsPhase(TR::CodeGenerator *cg, TR::CodeGenPhase *phase);
     static void performInsertDebugCountersPhase(TR::CodeGenerator *cg, TR::CodeGenPhase *phase);
     static void performExpandInstructionsPhase(TR::CodeGenerator *cg, TR::CodeGenPhase *phase);
+    static void performInstructionSchedulingPhase(TR::CodeGenerator *cg, TR::CodeGenPhase *phase);
 
 protected:
     CodeGenPhase(TR::CodeGenerator *cg)
@@ -30,4 +30,5 @@ ReserveCodeCachePhase, LowerTreesPhase, UncommonCallConstNodesPhase, SetupForIns
     BinaryEncodingPhase, EmitSnippetsPhase, ProcessRelocationsPhase, FindAndFixCommonedReferencesPhase,
     RemoveUnusedLocalsPhase,
     InliningReportPhase, // all
-    InsertDebugCountersPhase, CleanUpFlagsPhase, ExpandInstructionsPhase, LastOMRPhase = ExpandInstructionsPhase,
+    InsertDebugCountersPhase, CleanUpFlagsPhase, ExpandInstructionsPhase, InstructionSchedulingPhase,
+    LastOMRPhase = InstructionSchedulingPhase,
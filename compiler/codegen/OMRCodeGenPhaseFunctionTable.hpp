@@ -41,4 +41,4 @@ TR::CodeGenPhase::performReserveCodeCachePhase, // ReserveCodeCachePhase
     TR::CodeGenPhase::performRemoveUnusedLocalsPhase, // RemoveUnusedLocalsPhase
     TR::CodeGenPhase::performInliningReportPhase, // InliningReportPhase
     TR::CodeGenPhase::performInsertDebugCountersPhase, TR::CodeGenPhase::performCleanUpFlagsPhase,
-    TR::CodeGenPhase::performExpandInstructionsPhase,
+    TR::CodeGenPhase::performExpandInstructionsPhase, TR::CodeGenPhase::performInstructionSchedulingPhase,
@@ -496,6 +496,14 @@ public:
 
     void expandInstructions() {}
 
+    /**
+     * @brief Reorders the instructions of each basic block to hide latencies,
+     *        after register assignment.
+     *
+     * @return true if any instruction was moved
+     */
+    bool scheduleInstructions() { return false; }
+
     friend void OMR::CodeGenPhase::performEmitSnippetsPhase(TR::CodeGenerator *, TR::CodeGenPhase *);
     friend void OMR::CodeGenPhase::performCleanUpFlagsPhase(TR::CodeGenerator *cg, TR::CodeGenPhase *phase);
 
@@ -99,6 +99,7 @@
 #include "optimizer/RegisterCandidate.hpp"
 #include "optimizer/Structure.hpp"
 #include "optimizer/TransformUtil.hpp"
+#include "optimizer/abstractinterpreter/InliningSummaryCache.hpp"
 #include "ras/Debug.hpp"
 #include "ras/DebugCounter.hpp"
 #include "ras/ILValidationStrategies.hpp"
@@ -261,6 +262,7 @@ OMR::Compilation::Compilation(int32_t id, OMR_VMThread *omrVMThread, TR_FrontEnd
     , _failCHtableCommitFlag(false)
     , _phaseTimer("Compilation", self()->allocator("phaseTimer"), self()->getOption(TR_Timing))
     , _phaseMemProfiler("Compilation", self()->allocator("phaseMemProfiler"), self()->getOption(TR_LexicalMemProfiler))
+    , _optimizationStatistics(NULL)
     , _compilationNodes(NULL)
     , _copyPropagationRematerializationCandidates(self()->allocator("CP rematerialization"))
     , _nodeOpCodeLength(0)
@@ -440,7 +442,11 @@ OMR::Compilation::Compilation(int32_t id, OMR_VMThread *omrVMThread, TR_FrontEnd
         _osrCompilationData = NULL;
 }
 
-OMR::Compilation::~Compilation() throw() {}
+OMR::Compilation::~Compilation() throw()
+{
+    if (_optimizationStatistics && TR::OptimizationStatistics::instance())
+        TR::OptimizationStatistics::instance()->methodCompleted(self(), _optimizationStatistics);
+}
 
 TR::KnownObjectTable *OMR::Compilation::getOrCreateKnownObjectTable()
 {
@@ -1957,6 +1963,10 @@ void OMR::Compilation::shutdown(TR_FrontEnd *fe)
 
     TR::Recompilation::shutdown();
 
+    TR::OptimizationStatistics::shutdown();
+
+    TR::InliningSummaryCache::shutdown();
+
     TR::Options::shutdown(fe);
 
 #ifdef J9_PROJECT_SPECIFIC
@@ -69,6 +69,7 @@ typedef OMR::Compilation CompilationConnector;
 #include "infra/Stack.hpp"
 #include "infra/ThreadLocal.hpp"
 #include "optimizer/Optimizations.hpp"
+#include "optimizer/OptimizationStatistics.hpp"
 #include "ras/Debug.hpp"
 #include "ras/DebugCounter.hpp"
 #include "ras/ILValidationStrategies.hpp"
@@ -1063,6 +1064,10 @@ public:
 
     TR::PhaseMemSummary &phaseMemProfiler() { return _phaseMemProfiler; }
 
+    TR::OptimizationStatistics::MethodStatistics *getOptimizationStatistics() { return _optimizationStatistics; }
+
+    void setOptimizationStatistics(TR::OptimizationStatistics::MethodStatistics *s) { _optimizationStatistics = s; }
+
     TR::NodePool &getNodePool() { return *_compilationNodes; }
 
     bool mustNotBeRecompiled();
@@ -1550,6 +1555,7 @@ private:
 
     PhaseTimingSummary _phaseTimer;
     TR::PhaseMemSummary _phaseMemProfiler;
+    TR::OptimizationStatistics::MethodStatistics *_optimizationStatistics;
     TR::NodePool *_compilationNodes;
 
     TR::SparseBitVector _copyPropagationRematerializationCandidates;
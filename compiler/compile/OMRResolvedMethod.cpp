@@ -46,6 +46,7 @@ OMR::ResolvedMethod::ResolvedMethod(TR_OpaqueMethodBlock *method)
     _signature = resolvedMethod->getSignature();
     _externalName = 0;
     _entryPoint = resolvedMethod->getEntryPoint();
+    _isAllocationFunction = resolvedMethod->isAllocationFunction();
     strncpy(_signatureChars, resolvedMethod->signatureChars(),
         MAX_SIGNATURE_LENGTH); // TODO: introduce concept of robustness
 }
@@ -64,6 +65,7 @@ OMR::ResolvedMethod::ResolvedMethod(const char *fileName, const char *lineNumber
     , _returnType(returnType)
     , _entryPoint(entryPoint)
     , _ilgen(ilgen)
+    , _isAllocationFunction(false)
 {
     computeSignatureChars();
 }
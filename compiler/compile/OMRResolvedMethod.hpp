@@ -113,6 +113,10 @@ public:
 
     void *getEntryPoint() { return _entryPoint; }
 
+    virtual bool isAllocationFunction() { return _isAllocationFunction; }
+
+    void setIsAllocationFunction(bool b) { _isAllocationFunction = b; }
+
     void computeSignatureCharsPrimitive();
     void computeSignatureChars();
 
@@ -134,6 +138,7 @@ protected:
     TR::DataType _returnType;
     void *_entryPoint;
     TR_IlGenerator *_ilgen;
+    bool _isAllocationFunction;
 
     static const char *signatureNameForType[];
     static const char *signatureNameForVectorType[];
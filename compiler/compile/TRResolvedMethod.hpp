@@ -142,6 +142,13 @@ public:
 
     virtual bool owningMethodDoesntMatter() { return false; }
 
+    /**
+     * True if a call to this method only returns a new, zero-initialized block
+     * of memory whose size in bytes is given by the first argument, and the
+     * block never needs to be freed explicitly.
+     */
+    virtual bool isAllocationFunction() { return false; }
+
     virtual void *ramConstantPool();
     virtual void *constantPool();
     virtual TR_OpaqueClassBlock *getClassFromConstantPool(TR::Compilation *, uint32_t cpIndex,
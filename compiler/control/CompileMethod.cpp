@@ -37,6 +37,7 @@
 #include "compile/CompilationTypes.hpp"
 #include "compile/ResolvedMethod.hpp"
 #include "control/OptimizationPlan.hpp"
+#include "control/TieredCompilation.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "env/CPU.hpp"
@@ -61,6 +62,15 @@
 #include "omrformatconsts.h"
 #include "runtime/CodeCacheManager.hpp"
 #include "control/CompilationController.hpp"
+#include "optimizer/OptimizationStatistics.hpp"
+#include "optimizer/abstractinterpreter/InliningSummaryCache.hpp"
+#include "codegen/Instruction.hpp"
+#include "il/Node.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "infra/vector.hpp"
+#if (HOST_OS == OMR_LINUX)
+#include "runtime/PerfJitDump.hpp"
+#endif
 
 static void writePerfToolEntry(void *start, uint32_t size, const char *name)
 {
@@ -127,6 +137,50 @@ static void generatePerfToolEntry(uint8_t *startPC, uint8_t *endPC, const char *
     writePerfToolEntry(startPC, static_cast<uint32_t>(endPC - startPC), buffer);
 }
 
+#if (HOST_OS == OMR_LINUX)
+/**
+ * Writes the method body to the perf jitdump file, with a debug entry at each
+ * point where the instruction stream moves to a different (caller index,
+ * bytecode index) pair. Code from inlined methods is attributed to the inlined
+ * method's signature, so perf can report inlined frames.
+ */
+static void generatePerfJitDumpEntry(TR::Compilation *comp, TR::PerfJitDump *perfJitDump, uint8_t *startPC,
+    uint8_t *endPC)
+{
+    TR::vector<TR::PerfJitDump::DebugEntry, TR::Region &> entries(comp->trMemory()->currentStackRegion());
+    const char *outermostSignature = comp->signature();
+
+    int32_t lastCallerIndex = TR_ByteCodeInfo::invalidCallerIndex - 1;
+    int32_t lastByteCodeIndex = TR_ByteCodeInfo::invalidByteCodeIndex;
+    for (TR::Instruction *instr = comp->cg()->getFirstInstruction(); instr; instr = instr->getNext()) {
+        uint8_t *address = instr->getBinaryEncoding();
+        if (!instr->getNode() || !address || instr->getBinaryLength() == 0 || address < startPC || address >= endPC)
+            continue;
+
+        TR_ByteCodeInfo &bci = instr->getNode()->getByteCodeInfo();
+        int32_t callerIndex = bci.getCallerIndex();
+        int32_t byteCodeIndex = bci.getByteCodeIndex();
+        if (callerIndex == lastCallerIndex && byteCodeIndex == lastByteCodeIndex)
+            continue;
+
+        TR::PerfJitDump::DebugEntry entry;
+        entry._address = address;
+        entry._line = byteCodeIndex;
+        entry._discriminator = callerIndex;
+        entry._fileName = callerIndex < 0
+            ? outermostSignature
+            : comp->getInlinedResolvedMethod(callerIndex)->signature(comp->trMemory(), stackAlloc);
+        entries.push_back(entry);
+
+        lastCallerIndex = callerIndex;
+        lastByteCodeIndex = byteCodeIndex;
+    }
+
+    perfJitDump->codeLoad(comp->signature(), startPC, endPC - startPC, entries.empty() ? NULL : &entries[0],
+        static_cast<uint32_t>(entries.size()));
+}
+#endif // HOST_OS == OMR_LINUX
+
 #if defined(TR_TARGET_POWER)
 #include "p/codegen/PPCTableOfConstants.hpp"
 #endif
@@ -143,6 +197,18 @@ int32_t commonJitInit(TR::FrontEnd &fe, char *cmdLineOptions)
     TR::Compiler->target.cpu.setProcessor(TR_DefaultPPCProcessor);
 
     TR_VerboseLog::initialize(jitConfig);
+
+    if (!TR::OptimizationStatistics::initialize(TR::Options::getOptStatisticsFileName()))
+        fprintf(stderr, "JIT: unable to initialize optimization statistics\n");
+
+    if (TR::Options::getCmdLineOptions()->getOption(TR_EnableInliningSummaryCache)
+        && !TR::InliningSummaryCache::initialize())
+        fprintf(stderr, "JIT: unable to initialize the inlining summary cache\n");
+
+    if (TR::Options::getCmdLineOptions()->getOption(TR_EnableTieredCompilation)
+        && !TR::TieredCompilation::initialize())
+        fprintf(stderr, "JIT: unable to start tiered compilation\n");
+
     TR::Options::setCanJITCompile(true);
     TR::Options::getCmdLineOptions()->setOption(TR_NoRecompile);
     TR::CompilationController::init(NULL);
@@ -222,6 +288,12 @@ void registerTrampoline(uint8_t *start, uint32_t size, const char *name)
 {
     if (TR::Options::getCmdLineOptions()->getOption(TR_PerfTool))
         writePerfToolEntry(start, size, name);
+
+#if (HOST_OS == OMR_LINUX)
+    TR::PerfJitDump *perfJitDump = TR::CodeCacheManager::instance()->perfJitDump();
+    if (perfJitDump)
+        perfJitDump->codeLoad(name, start, size);
+#endif
 }
 
 static void printCompFailureInfo(TR::JitConfig *jitConfig, TR::Compilation *comp, const char *reason)
@@ -270,6 +342,8 @@ uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMeth
         ? static_cast<TR::SegmentAllocator &>(debugSegmentProvider)
         : static_cast<TR::SegmentAllocator &>(defaultSegmentProvider);
     TR::Region dispatchRegion(scratchSegmentProvider, rawAllocator);
+    if (TR::Options::getCmdLineOptions()->getOption(TR_EnableRegionFreeLists))
+        dispatchRegion.enableFreeLists();
     TR_Memory trMemory(*(fe->persistentMemory()), dispatchRegion);
     TR_ResolvedMethod &compilee = *((TR_ResolvedMethod *)details.getMethod());
 
@@ -385,6 +459,14 @@ uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMeth
                 }
             }
 
+#if (HOST_OS == OMR_LINUX)
+            TR::PerfJitDump *perfJitDump = fe->codeCacheManager().perfJitDump();
+            if (perfJitDump) {
+                TR::StackMemoryRegion stackMemoryRegion(trMemory);
+                generatePerfJitDumpEntry(&compiler, perfJitDump, startPC, compiler.cg()->getCodeEnd());
+            }
+#endif
+
             logprintf(trace, log, "<result success=\"true\" startPC=\"%#p\" time=\"%lld.%lldms\"/>\n", startPC,
                 translationTime / 1000, translationTime % 1000);
         } else /* of rc == COMPILATION_SUCCEEDED */
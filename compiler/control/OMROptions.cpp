@@ -617,6 +617,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      "M\tdisable inlining of IntrinsicCandidate that is not a recognized method", SET_OPTION_BIT(TR_DisableInliningUnrecognizedIntrinsics), "F" },
     { "disableInnerPreexistence", "O\tdisable inner preexistence", TR::Options::disableOptimization, innerPreexistence,
      0, "P" },
+    { "disableInstructionScheduling", "O\tdisable instruction scheduling in the code generator",
+     SET_OPTION_BIT(TR_DisableInstructionScheduling), "F" },
     { "disableIntegerCompareSimplification", "O\tdisable byte/short/int/long compare simplification  ",
      SET_OPTION_BIT(TR_DisableIntegerCompareSimplification), "F" },
     { "disableInterfaceCallCaching", "O\tdisable interfaceCall caching   ",
@@ -668,6 +670,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_DisableLastITableCache), "F" },
     { "disableLeafRoutineDetection", "O\tdisable lleaf routine detection on zlinux",
      SET_OPTION_BIT(TR_DisableLeafRoutineDetection), "F" },
+    { "disableLinearScanGRA", "O\tnever use the linear scan assignment mode of global register allocation",
+     SET_OPTION_BIT(TR_DisableLinearScanGRA), "F" },
     { "disableLinkageRegisterAllocation", "O\tdon't turn parm loads into RegLoads in first basic block",
      SET_OPTION_BIT(TR_DisableLinkageRegisterAllocation), "F" },
     { "disableLiveMonitorMetadata", "O\tdisable the creation of live monitor metadata",
@@ -896,6 +900,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_DisableSIMDUTF16BEEncoder), "F" },
     { "disableSIMDUTF16LEEncoder", "M\tdisable inlining of SIMD UTF16 Little Endian encoder",
      SET_OPTION_BIT(TR_DisableSIMDUTF16LEEncoder), "F" },
+    { "disableSimplifierRewriteRules", "O\tdisable the simplifier's rewrite rules, leaving only its handlers",
+     SET_OPTION_BIT(TR_DisableSimplifierRewriteRules), "F" },
     { "disableSmartPlacementOfCodeCaches",
      "O\tdisable placement of code caches in memory so they are near each other and the DLLs", SET_OPTION_BIT(TR_DisableSmartPlacementOfCodeCaches), "F", NOT_IN_SUBSET },
     { "disableSSE3", "C\tdisable sse 3 and newer on x86", TR::Options::disableCPUFeatures, TR_DisableSSE3, 0, "F" },
@@ -1003,6 +1009,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_DisableVSSStackCompaction), "F" },
     { "disableWarmCallGraphTooBigHeuristic", "O\tdisable heuristic related to warm-call-graph-too-big logic",
      SET_OPTION_BIT(TR_DisableWarmCallGraphTooBigHeuristic), "F" },
+    { "disableWorklistBVA", "O\tdisable the worklist solver for block level bit vector analyses",
+     SET_OPTION_BIT(TR_DisableWorklistBVA), "F" },
     { "disableWriteBarriersRangeCheck", "O\tdisable adding range check to write barriers",
      SET_OPTION_BIT(TR_DisableWriteBarriersRangeCheck), "F" },
     { "disableZ10", "O\tdisable z10 support", SET_OPTION_BIT(TR_DisableZ10), "F" },
@@ -1202,6 +1210,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_EnableExpensiveOptsAtWarm), "F" },
     { "enableExtendedVectorLengths", "C\tenable vectors wider than 128-bits in vector API",
      SET_OPTION_BIT(TR_EnableExtendedVectorLengths), "F" },
+    { "enableExtTSPBlockOrdering", "O\tlay out blocks globally from edge frequencies (Ext-TSP) in block ordering",
+     SET_OPTION_BIT(TR_EnableExtTSPBlockOrdering), "F" },
     { "enableFastHotRecompilation", "R\ttry to recompile at hot sooner", SET_OPTION_BIT(TR_EnableFastHotRecompilation),
      "F" },
     { "enableFastScorchingRecompilation", "R\ttry to recompile at scorching sooner",
@@ -1241,6 +1251,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      RESET_OPTION_BIT(TR_DisableInliningDuringVPAtWarm), "F" },
     { "enableInliningOfUnsafeForArraylets", "O\tenable inlining of Unsafe calls when arraylets are enabled",
      SET_OPTION_BIT(TR_EnableInliningOfUnsafeForArraylets), "F" },
+    { "enableInliningSummaryCache", "O\treuse the inlining method summaries of callees without calls across compilations",
+     SET_OPTION_BIT(TR_EnableInliningSummaryCache), "F" },
     { "enableInterfaceCallCachingSingleDynamicSlot",
      "O\tenable interfaceCall caching with one slot storing J9MethodPtr   ", SET_OPTION_BIT(TR_enableInterfaceCallCachingSingleDynamicSlot), "F" },
     { "enableIprofilerChanges", "O\tenable iprofiler changes", SET_OPTION_BIT(TR_EnableIprofilerChanges), "F" },
@@ -1263,6 +1275,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_EnableKnownObjectTableCachingVerification), "F" },
     { "enableLastRetrialLogging",
      "O\tenable fullTrace logging for last compilation attempt. Needs to have a log defined on the command line", SET_OPTION_BIT(TR_EnableLastCompilationRetrialLogging), "F" },
+    { "enableLinearScanGRA", "O\tuse linear scan to assign global registers in every compilation",
+     SET_OPTION_BIT(TR_EnableLinearScanGRA), "F" },
     { "enableLocalVPSkipLowFreqBlock", "O\tSkip processing of low frequency blocks in localVP",
      SET_OPTION_BIT(TR_EnableLocalVPSkipLowFreqBlock), "F" },
     { "enableLoopEntryAlignment", "O\tenable loop Entry alignment", SET_OPTION_BIT(TR_EnableLoopEntryAlignment), "F" },
@@ -1323,6 +1337,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "enableRefinedAliases",
      "O\tenable collecting side-effect summaries from compilations to improve aliasing info in subsequent "
         "compilations", RESET_OPTION_BIT(TR_DisableRefinedAliases), "F" },
+    { "enableRegionFreeLists", "M\treuse small allocations freed by containers in compilation memory regions",
+     SET_OPTION_BIT(TR_EnableRegionFreeLists), "F", NOT_IN_SUBSET },
     { "enableRegisterPressureEstimation", "O\tdeprecated; same as enableRegisterPressureSimulation",
      RESET_OPTION_BIT(TR_DisableRegisterPressureSimulation), "F" },
     { "enableRegisterPressureSimulation",
@@ -1368,6 +1384,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_EnableSymbolValidationManager), "F" },
     { "enableThisLiveRangeExtension", "R\tenable this live range extension to the end of the method",
      SET_OPTION_BIT(TR_EnableThisLiveRangeExtension), "F" },
+    { "enableTieredCompilation", "O\tcompile JitBuilder methods at cold with counters and recompile hot ones in the background",
+     SET_OPTION_BIT(TR_EnableTieredCompilation), "F", NOT_IN_SUBSET },
     { "enableTM", "O\tenable transactional memory support", SET_OPTION_BIT(TR_EnableTM), "F" },
     { "enableTraps", "C\tenable trap instructions", RESET_OPTION_BIT(TR_DisableTraps), "F" },
     { "enableTreePatternMatching", "O\tEnable opts that use the TR_Pattern framework",
@@ -1562,6 +1580,18 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      offsetof(OMR::Options, _insertDebuggingCounters), 0, "F%d", NOT_IN_SUBSET },
     { "installAOTToColdCode", "M\tinstall AOT methods into cold code cache", SET_OPTION_BIT(TR_InstallAOTToColdCode),
      "F" },
+    { "instructionSchedulingOptLevel=cold", "C\tschedule instructions in compilations at cold and above",
+     TR::Options::set32BitValue, offsetof(OMR::Options, _instructionSchedulingOptLevel), cold, "F" },
+    { "instructionSchedulingOptLevel=hot", "C\tschedule instructions in compilations at hot and above",
+     TR::Options::set32BitValue, offsetof(OMR::Options, _instructionSchedulingOptLevel), hot, "F" },
+    { "instructionSchedulingOptLevel=noOpt", "C\tschedule instructions in compilations at noOpt and above",
+     TR::Options::set32BitValue, offsetof(OMR::Options, _instructionSchedulingOptLevel), noOpt, "F" },
+    { "instructionSchedulingOptLevel=scorching", "C\tschedule instructions in compilations at scorching and above",
+     TR::Options::set32BitValue, offsetof(OMR::Options, _instructionSchedulingOptLevel), scorching, "F" },
+    { "instructionSchedulingOptLevel=veryHot", "C\tschedule instructions in compilations at veryHot and above",
+     TR::Options::set32BitValue, offsetof(OMR::Options, _instructionSchedulingOptLevel), veryHot, "F" },
+    { "instructionSchedulingOptLevel=warm", "C\tschedule instructions in compilations at warm and above",
+     TR::Options::set32BitValue, offsetof(OMR::Options, _instructionSchedulingOptLevel), warm, "F" },
     { "interpreterSamplingDivisorInStartupMode=",
      "R<nnn>\tThe divisor used to decrease the invocation count when an interpreted method is sampled", TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_interpreterSamplingDivisorInStartupMode, 0, "F%d",
      NOT_IN_SUBSET },
@@ -1724,6 +1754,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      offsetof(OMR::Options, _optLevel), veryHot, "P" },
     { "optLevel=warm", "O\tcompile all methods at warm level", TR::Options::set32BitValue,
      offsetof(OMR::Options, _optLevel), warm, "P" },
+    { "optStatsFile=",
+     "L<filename>\twrite per-optimization compile time and memory statistics to filename at shutdown (JSON if "
+     "filename ends in .json, CSV otherwise)",
+     TR::Options::setStaticString, (intptr_t)(&TR::Options::_optStatisticsFileName), 0, "F%s", NOT_IN_SUBSET },
     { "orphanedConstRefs=fail", "M\tfail the compilation if there are any orphaned const refs",
      SET_OPTION_BIT(TR_OrphanedConstRefsFail), "F" },
     { "orphanedConstRefs=top",
@@ -1738,6 +1772,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_PaintDataCacheOnFree), "F" },
     { "paranoidOptCheck", "O\tcheck the trees and cfgs after every optimization phase",
      SET_OPTION_BIT(TR_EnableParanoidOptCheck), "F" },
+    { "perfJitDump", "M\twrite compiled method bodies to a perf jitdump file (/tmp/jit-<pid>.dump)",
+     SET_OPTION_BIT(TR_PerfJitDump), "F", NOT_IN_SUBSET },
     { "performLookaheadAtWarmCold", "O\tallow lookahead to be performed at cold and warm",
      SET_OPTION_BIT(TR_PerformLookaheadAtWarmCold), "F" },
     { "perfTool", "M\tenable PerfTool", SET_OPTION_BIT(TR_PerfTool), "F", NOT_IN_SUBSET },
@@ -1875,6 +1911,12 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      TR::Options::set32BitNumeric, offsetof(OMR::Options, _test390LitPoolBuffer), 0, "F%d" },
     { "test390StackBufferSize=", "L\tInsert buffer in stack to force testing of large stack sizes",
      TR::Options::set32BitNumeric, offsetof(OMR::Options, _test390StackBuffer), 0, "F%d" },
+    { "tieredHotThreshold=", "O<nnn>\tinvocations plus backedges after which a tiered method is recompiled at hot",
+     TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_tieredHotThreshold, 0, "F%d", NOT_IN_SUBSET },
+    { "tieredSampleInterval=", "O<nnn>\tmilliseconds between samples of the tiered method counters",
+     TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_tieredSampleInterval, 0, "F%d", NOT_IN_SUBSET },
+    { "tieredWarmThreshold=", "O<nnn>\tinvocations plus backedges after which a tiered method is recompiled at warm",
+     TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_tieredWarmThreshold, 0, "F%d", NOT_IN_SUBSET },
     { "timing", "M\ttime individual phases and optimizations", SET_OPTION_BIT(TR_Timing), "F" },
     { "timingCumulative", "M\ttime cumulative phases (ILgen,Optimizer,codegen)", SET_OPTION_BIT(TR_CummTiming), "F" },
 #if defined(TR_HOST_X86) || defined(TR_HOST_POWER)
@@ -1983,6 +2025,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "traceInlining", "L\ttrace IL inlining", TR::Options::traceOptimization, inlining, 0, "P" },
     { "traceInnerPreexistence", "L\ttrace inner preexistence", TR::Options::traceOptimization, innerPreexistence, 0,
      "P" },
+    { "traceInstructionScheduling", "L\ttrace instruction scheduling in the code generator",
+     SET_OPTION_BIT(TR_TraceInstructionScheduling), "P" },
     { "traceInvariantArgumentPreexistence", "L\ttrace invariable argument preexistence", TR::Options::traceOptimization,
      invariantArgumentPreexistence, 0, "P" },
     { "traceIsolatedSE", "L\ttrace isolated store elimination", TR::Options::traceOptimization,
@@ -2485,6 +2529,10 @@ int32_t OMR::Options::_aggressiveRecompilationChances = 4;
 // J9, but one dependence in Compilation
 int32_t OMR::Options::_bigAppThreshold = 2000; // loaded classes
 
+int32_t OMR::Options::_tieredWarmThreshold = 1000;
+int32_t OMR::Options::_tieredHotThreshold = 100000;
+int32_t OMR::Options::_tieredSampleInterval = 10; // ms
+
 int32_t OMR::Options::_profilingCompNodecountThreshold
     = 30000; // this number should be smaller than USHRT_MAX
              // and larger than a desired size
@@ -2892,6 +2940,7 @@ void OMR::Options::initialize()
     _disableDLTBytecodeIndex = -1;
     _enableDLTBytecodeIndex = -1;
     _dltOptLevel = -1;
+    _instructionSchedulingOptLevel = hot;
     _profilingCount = 0;
     _profilingFrequency = 0;
     _counterBucketGranularity = 0;
@@ -6370,6 +6419,8 @@ char *OMR::Options::_logFileNameSuffix = ".%tick.%pid";
 char *OMR::Options::_logFileNameSuffix = "";
 #endif
 
+char *OMR::Options::_optStatisticsFileName = NULL;
+
 char *OMR::Options::getLogFileNameSuffix() { return TR::Options::_logFileNameSuffix; }
 
 void OMR::Options::setLogFileNameSuffix(char *s) { TR::Options::_logFileNameSuffix = s; }
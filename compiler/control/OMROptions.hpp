@@ -474,11 +474,11 @@ enum TR_CompilationOptions {
     TR_ForceTRIOForLoggers                                   = 0x00000040 + 12,
     TR_DisablePartialInlining                                = 0x00000080 + 12,
     TR_AssumeStartupPhaseUntilToldNotTo                      = 0x00000100 + 12,
-    // Available                                             = 0x00000200 + 12,
+    TR_DisableWorklistBVA                                    = 0x00000200 + 12,
     TR_DisableAOTBytesCompression                            = 0x00000400 + 12,
     TR_X86UseMFENCE                                          = 0x00000800 + 12,
-    // Available                                             = 0x00001000 + 12,
-    // Available                                             = 0x00002000 + 12,
+    TR_EnableLinearScanGRA                                   = 0x00001000 + 12,
+    TR_DisableLinearScanGRA                                  = 0x00002000 + 12,
     TR_DisableHPRSpill                                       = 0x00004000 + 12, // zGryphon
     TR_DisableHPRUpgrade                                     = 0x00008000 + 12, // zGryphon
     TR_AggressiveOpts                                        = 0x00010000 + 12,
@@ -494,23 +494,23 @@ enum TR_CompilationOptions {
     TR_TraceBIIDTGen                                         = 0x04000000 + 12,
     TR_TraceBIProposal                                       = 0x08000000 + 12,
     TR_TraceBISummary                                        = 0x10000000 + 12,
-    // Available                                             = 0x20000000 + 12,
-    // Available                                             = 0x40000000 + 12,
+    TR_DisableInstructionScheduling                          = 0x20000000 + 12,
+    TR_TraceInstructionScheduling                            = 0x40000000 + 12,
     TR_DisableAOTInstanceFieldResolution                     = 0x80000000 + 12,
 
     // Option word 13
-    // Available                                             = 0x00000020 + 13,
+    TR_EnableInliningSummaryCache                            = 0x00000020 + 13,
     TR_DisableRefArraycopyRT                                 = 0x00000040 + 13,
-    // Available                                             = 0x00000080 + 13,
+    TR_EnableRegionFreeLists                                 = 0x00000080 + 13,
     TR_StaticDebugCountersRequested                          = 0x00000100 + 13,
     TR_TraceNonLinearRegisterAssigner                        = 0x00000200 + 13,
     TR_TraceLookahead                                        = 0x00000400 + 13,
     TR_DisableMultiLeafArrayCopy                             = 0x00000800 + 13,
     TR_DisableInlinerFanIn                                   = 0x00001000 + 13,
-    // Available                                             = 0x00002000 + 13,
+    TR_DisableSimplifierRewriteRules                         = 0x00002000 + 13,
     TR_OrphanedConstRefsTop                                  = 0x00004000 + 13,
     TR_OrphanedConstRefsFail                                 = 0x00008000 + 13,
-    // Available                                             = 0x00010000 + 13,
+    TR_EnableTieredCompilation                               = 0x00010000 + 13,
     // Available                                             = 0x00020000 + 13,
     TR_EnableMonitorCacheLookup                              = 0x00040000 + 13,
     TR_TraceTreeVerification                                 = 0x00080000 + 13,
@@ -728,7 +728,7 @@ enum TR_CompilationOptions {
     TR_DisableCallConstUncommoning                           = 0x80000000 + 20,
 
     // Option word 21
-    // Available                                             = 0x00000020 + 21,
+    TR_EnableExtTSPBlockOrdering                             = 0x00000020 + 21, // Global profile-guided block layout in basicBlockOrdering
     // Available                                             = 0x00000040 + 21,
     // Available                                             = 0x00000080 + 21,
     TR_DisableCodeCacheReclamation                           = 0x00000100 + 21, // Disable the freeing of compiled methods
@@ -850,7 +850,7 @@ enum TR_CompilationOptions {
     TR_TracePREForOptimalSubNodeReplacement                  = 0x00002000 + 25,
     // Available                                             = 0x00008000 + 25,
     TR_PerfTool                                              = 0x00010000 + 25,
-    // Available                                             = 0x00020000 + 25,
+    TR_PerfJitDump                                           = 0x00020000 + 25, // Emit a perf jitdump file; code cache reclamation stays enabled
     TR_DisableBranchOnCount                                  = 0x00040000 + 25,
     TR_DontInlineUnloadableMethods                           = 0x00080000 + 25,
     TR_DisableLoopEntryAlignment                             = 0x00100000 + 25,
@@ -1589,6 +1589,12 @@ public:
      */
     static void setLogFileNameSuffix(char *s);
 
+    /**
+     * @brief Returns the file named by optStatsFile=, or NULL if per-optimization
+     *     statistics were not requested.
+     */
+    static const char *getOptStatisticsFileName() { return _optStatisticsFileName; }
+
     // methods that set or query the command line option and the option sets
     //
     static bool isOptionSetForAnyMethod(TR_CompilationOptions);
@@ -1767,6 +1773,12 @@ public:
 
     int32_t getDLTOptLevel() { return _dltOptLevel; }
 
+    /**
+     * @brief Returns the lowest hotness at which the code generator schedules
+     *     instructions
+     */
+    int32_t getInstructionSchedulingOptLevel() { return _instructionSchedulingOptLevel; }
+
     int32_t getProfilingCount() { return _profilingCount; }
 
     int32_t getProfilingFrequency() { return _profilingFrequency; }
@@ -2109,6 +2121,10 @@ public:
     static int32_t _aggressiveRecompilationChances;
     static int32_t _bigAppThreshold; // loaded classes
 
+    static int32_t _tieredWarmThreshold;
+    static int32_t _tieredHotThreshold;
+    static int32_t _tieredSampleInterval; // ms
+
     static int32_t _coldUpgradeSampleThreshold;
 
     static int32_t _interpreterSamplingDivisorInStartupMode;
@@ -2694,6 +2710,7 @@ protected:
     const char *_envOptions;
     static const char *_compilationStrategyName;
     static char *_logFileNameSuffix;
+    static char *_optStatisticsFileName;
 
     // Option flag words
     //
@@ -2824,6 +2841,7 @@ protected:
     int32_t _disableDLTBytecodeIndex;
     int32_t _enableDLTBytecodeIndex;
     int32_t _dltOptLevel;
+    int32_t _instructionSchedulingOptLevel;
     int32_t _profilingCount;
     int32_t _profilingFrequency;
     int32_t _counterBucketGranularity;
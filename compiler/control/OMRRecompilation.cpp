@@ -34,6 +34,7 @@
 #include "control/OptimizationPlan.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
+#include "control/TieredCompilation.hpp"
 #include "env/PersistentInfo.hpp"
 #include "env/TRMemory.hpp"
 #include "env/jittypes.h"
@@ -53,6 +54,6 @@ OMR::Recompilation::Recompilation(TR::Compilation *comp)
     : _compilation(comp)
 {}
 
-void OMR::Recompilation::shutdown() {}
+void OMR::Recompilation::shutdown() { TR::TieredCompilation::shutdown(); }
 
 TR::Recompilation *OMR::Recompilation::self() { return static_cast<TR::Recompilation *>(this); }
@@ -37,6 +37,9 @@
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/Runtime.hpp"
 #include "control/CompilationController.hpp"
+#include "control/TieredCompilation.hpp"
+#include "optimizer/OptimizationStatistics.hpp"
+#include "optimizer/abstractinterpreter/InliningSummaryCache.hpp"
 
 #if defined(AIXPPC)
 #include "p/codegen/PPCTableOfConstants.hpp"
@@ -104,6 +107,7 @@ static void initializeCodeCache(TR::CodeCacheManager &codeCacheManager)
     codeCacheConfig._emitExecutableELF = TR::Options::getCmdLineOptions()->getOption(TR_PerfTool)
         || TR::Options::getCmdLineOptions()->getOption(TR_EmitExecutableELFFile);
     codeCacheConfig._emitRelocatableELF = TR::Options::getCmdLineOptions()->getOption(TR_EmitRelocatableELFFile);
+    codeCacheConfig._emitPerfJitDump = TR::Options::getCmdLineOptions()->getOption(TR_PerfJitDump);
 
     TR::CodeCache *firstCodeCache = codeCacheManager.initialize(true, 1);
 }
@@ -198,11 +202,18 @@ void shutdownSimpleJit()
 {
     auto fe = TR::FrontEnd::instance();
 
+    // Stop recompiling before the code cache goes away
+    TR::TieredCompilation::shutdown();
+
     TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
     codeCacheManager.destroy();
 
     TR::CompilationController::shutdown();
 
+    TR::OptimizationStatistics::shutdown();
+
+    TR::InliningSummaryCache::shutdown();
+
     if (TR::Compiler != NULL)
         TR::Compiler->rawAllocator.deallocate(TR::Compiler);
 }
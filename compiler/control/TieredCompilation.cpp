@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "control/TieredCompilation.hpp"
+
+#include <new>
+#include <string.h>
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
+#include "ilgen/MethodBuilder.hpp"
+
+#if !defined(OMR_OS_WINDOWS)
+#include <errno.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <time.h>
+
+static pthread_mutex_t compileMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t tieringCond = PTHREAD_COND_INITIALIZER;
+static pthread_t tieringThread;
+static bool tieringShutdown = false;
+#endif
+
+bool TR::TieredCompilation::_enabled = false;
+TR::TieredMethod *TR::TieredCompilation::_methods = NULL;
+uint32_t TR::TieredCompilation::_numRecompilations = 0;
+
+bool TR::TieredCompilation::initialize()
+{
+#if defined(OMR_OS_WINDOWS)
+    return false;
+#else
+    if (_enabled)
+        return true;
+
+    tieringShutdown = false;
+    if (pthread_create(&tieringThread, NULL, tieringThreadEntry, NULL) != 0)
+        return false;
+
+    _enabled = true;
+    return true;
+#endif
+}
+
+void TR::TieredCompilation::shutdown()
+{
+#if !defined(OMR_OS_WINDOWS)
+    if (!_enabled)
+        return;
+
+    pthread_mutex_lock(&compileMutex);
+    tieringShutdown = true;
+    pthread_cond_signal(&tieringCond);
+    pthread_mutex_unlock(&compileMutex);
+    pthread_join(tieringThread, NULL);
+
+    if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Tiered compilation: %u recompilations", _numRecompilations);
+
+    TR::TieredMethod *method = _methods;
+    while (method) {
+        TR::TieredMethod *next = method->_next;
+        TR::Compiler->persistentAllocator().deallocate(method);
+        method = next;
+    }
+    _methods = NULL;
+    _numRecompilations = 0;
+    _enabled = false;
+#endif
+}
+
+int32_t TR::TieredCompilation::compile(TR::MethodBuilder *builder, void **entry)
+{
+#if defined(OMR_OS_WINDOWS)
+    return builder->compile(entry, warm);
+#else
+    void *storage = TR::Compiler->persistentAllocator().allocate(sizeof(TR::TieredMethod), std::nothrow);
+    if (!storage)
+        return builder->compile(entry, warm);
+
+    TR::TieredMethod *method = static_cast<TR::TieredMethod *>(storage);
+    memset(method, 0, sizeof(TR::TieredMethod));
+    method->_builder = builder;
+    method->_level = cold;
+
+    pthread_mutex_lock(&compileMutex);
+    int32_t rc = builder->compile(entry, cold, method);
+    if (rc == 0) {
+        method->_next = _methods;
+        _methods = method;
+    }
+    pthread_mutex_unlock(&compileMutex);
+
+    if (rc != 0)
+        TR::Compiler->persistentAllocator().deallocate(method);
+    return rc;
+#endif
+}
+
+TR_Hotness TR::TieredCompilation::nextLevel(const TR::TieredMethod *method)
+{
+    int64_t count = static_cast<int64_t>(method->_invocations) + static_cast<int64_t>(method->_backedges);
+    if (method->_level < hot && count >= TR::Options::_tieredHotThreshold)
+        return hot;
+    if (method->_level < warm && count >= TR::Options::_tieredWarmThreshold)
+        return warm;
+    return method->_level;
+}
+
+#if !defined(OMR_OS_WINDOWS)
+void *TR::TieredCompilation::tieringThreadEntry(void *)
+{
+    pthread_mutex_lock(&compileMutex);
+    while (!tieringShutdown) {
+        struct timeval now;
+        gettimeofday(&now, NULL);
+        int64_t deadlineNs = (static_cast<int64_t>(now.tv_usec) + TR::Options::_tieredSampleInterval * 1000LL) * 1000;
+        struct timespec deadline;
+        deadline.tv_sec = now.tv_sec + static_cast<time_t>(deadlineNs / 1000000000);
+        deadline.tv_nsec = static_cast<long>(deadlineNs % 1000000000);
+        while (!tieringShutdown && pthread_cond_timedwait(&tieringCond, &compileMutex, &deadline) != ETIMEDOUT) {}
+
+        if (!tieringShutdown)
+            sampleMethods();
+    }
+    pthread_mutex_unlock(&compileMutex);
+    return NULL;
+}
+#endif
+
+// Called with the compile mutex held
+void TR::TieredCompilation::sampleMethods()
+{
+    for (TR::TieredMethod *method = _methods; method; method = method->_next) {
+        TR_Hotness level = nextLevel(method);
+        if (level != method->_level)
+            recompile(method, level);
+    }
+}
+
+// Called with the compile mutex held
+void TR::TieredCompilation::recompile(TR::TieredMethod *method, TR_Hotness level)
+{
+    void *entry = NULL;
+    int32_t rc = method->_builder->compile(&entry, level, level < hot ? method : NULL);
+    if (rc != 0 || entry == NULL) {
+        // Leave the method where it is rather than trying again at every sample
+        method->_level = hot;
+        return;
+    }
+
+    // Code becomes visible to other threads when the compilation completes,
+    // so only the forwarding slots need to be published
+    for (int32_t l = cold; l < level; l++)
+        method->_forwardTo[l] = entry;
+    method->_level = level;
+    _numRecompilations++;
+}
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef TIERED_COMPILATION_INCL
+#define TIERED_COMPILATION_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include "compile/CompilationTypes.hpp"
+
+namespace TR {
+class MethodBuilder;
+}
+
+namespace TR {
+
+/**
+ * Profiling state of a MethodBuilder compiled by tiered compilation.
+ *
+ * The counters are bumped by the method's cold and warm bodies and read by
+ * the tiering thread. Like debug counters they are bumped without
+ * synchronization, so concurrent callers may lose a few counts.
+ *
+ * A profiled body starts by loading its forwarding slot and, once a better
+ * body has been compiled, calls that body instead of running its own code.
+ * Entry points that a client obtained earlier therefore keep working, and
+ * keep running the best code available, after the method is recompiled.
+ */
+struct TieredMethod {
+    TR::MethodBuilder *_builder;
+    intptr_t _invocations;
+    intptr_t _backedges;
+    void *volatile _forwardTo[numHotnessLevels]; ///< indexed by the hotness of the forwarding body
+    TR_Hotness _level;
+    TieredMethod *_next;
+};
+
+/**
+ * Tiered compilation of JitBuilder methods.
+ *
+ * When enableTieredCompilation is set, MethodBuilder::Compile() compiles a
+ * method at cold with invocation and backedge counters, and returns that
+ * body's entry point. A background thread samples the counters every
+ * tieredSampleInterval milliseconds. A method whose count reaches
+ * tieredWarmThreshold is recompiled at warm, still with counters, and one
+ * whose count reaches tieredHotThreshold is recompiled at hot without them.
+ * Each time, the forwarding slots of the method's older bodies are patched
+ * to the new entry point.
+ *
+ * A method is recompiled by running its MethodBuilder again, so the builder
+ * must stay alive until the JIT is shut down. MethodBuilder compilations are
+ * serialized while tiered compilation is active.
+ */
+class TieredCompilation {
+public:
+    static bool isEnabled() { return _enabled; }
+
+    /**
+     * Start the tiering thread.
+     *
+     * @return false if the thread could not be started, in which case
+     *         methods are compiled at a fixed level as usual
+     */
+    static bool initialize();
+
+    /**
+     * Stop the tiering thread. Must be called before the code cache is
+     * destroyed.
+     */
+    static void shutdown();
+
+    /**
+     * Compile a method builder at cold with counters and register it for
+     * promotion.
+     *
+     * @return the compilation's return code, as from MethodBuilder::Compile()
+     */
+    static int32_t compile(TR::MethodBuilder *builder, void **entry);
+
+    /**
+     * @return the level \p method should be compiled at next, or its current
+     *         level if its counts do not reach the next threshold
+     */
+    static TR_Hotness nextLevel(const TieredMethod *method);
+
+private:
+    static void *tieringThreadEntry(void *);
+    static void sampleMethods();
+    static void recompile(TieredMethod *method, TR_Hotness level);
+
+    static bool _enabled;
+    static TieredMethod *_methods;
+    static uint32_t _numRecompilations;
+};
+
+} // namespace TR
+
+#endif
@@ -21,18 +21,307 @@
 
 #include "env/PersistentAllocator.hpp"
 
+#include <string.h>
+#include "infra/Assert.hpp"
+#include "infra/ThreadLocal.hpp"
+
+namespace {
+TR_TLS_DEFINE(void *, threadCacheKey);
+bool threadCacheKeyAllocated = false;
+} // namespace
+
+uint32_t OMR::PersistentAllocator::_nextId = 1;
+
 OMR::PersistentAllocator::PersistentAllocator(const TR::PersistentAllocatorKit &allocatorKit)
     : _rawAllocator(allocatorKit.rawAllocator)
-{}
+    , _id(_nextId++)
+    , _threadCaches(NULL)
+    , _segmentAlloc(NULL)
+    , _segmentRemaining(0)
+    , _segmentBytes(0)
+    , _lockAcquisitions(0)
+    , _contendedLockAcquisitions(0)
+{
+    memset(_pool, 0, sizeof(_pool));
+    memset(_numPooled, 0, sizeof(_numPooled));
+    memset(&_uncached, 0, sizeof(_uncached));
+
+#if defined(OMR_OS_WINDOWS)
+    MUTEX_INIT(_mutex);
+#else
+    bool rc = MUTEX_INIT(_mutex);
+    TR_ASSERT_FATAL(rc, "Failed to initialize the persistent allocator mutex");
+#endif /* defined(OMR_OS_WINDOWS) */
+
+#if defined(SUPPORTS_THREAD_LOCAL)
+    if (!threadCacheKeyAllocated) {
+        TR_TLS_ALLOC(threadCacheKey);
+        threadCacheKeyAllocated = true;
+    }
+#endif
+}
 
 void *OMR::PersistentAllocator::allocate(size_t size, const std::nothrow_t tag, void *hint) throw()
 {
-    return _rawAllocator.allocate(size, tag, hint);
+    if (size > MAX_CACHED_SIZE)
+        return allocateLarge(size, tag);
+    return allocateSmall(size, sizeClass(size));
 }
 
-void *OMR::PersistentAllocator::allocate(size_t size, void *hint) { return _rawAllocator.allocate(size, hint); }
+void *OMR::PersistentAllocator::allocate(size_t size, void *hint)
+{
+    void * const alloc = allocate(size, std::nothrow, hint);
+    if (!alloc)
+        throw std::bad_alloc();
+    return alloc;
+}
 
 void OMR::PersistentAllocator::deallocate(void *p, const size_t sizeHint) throw()
 {
-    _rawAllocator.deallocate(p, sizeHint);
+    if (!p)
+        return;
+
+    Header *header = static_cast<Header *>(p) - 1;
+    ThreadCache *cache = threadCache();
+
+    if (header->_sizeClass == LARGE) {
+        if (cache) {
+            cache->_largeBytesInUse -= header->_size;
+            cache->_numLargeAllocations--;
+        } else {
+            lock();
+            _uncached._largeBytesInUse -= header->_size;
+            _uncached._numLargeAllocations--;
+            unlock();
+        }
+        _rawAllocator.deallocate(header);
+        return;
+    }
+
+    size_t const sizeClass = header->_sizeClass;
+    size_t const size = header->_size;
+    FreeBlock *block = reinterpret_cast<FreeBlock *>(header);
+
+    if (cache) {
+        block->_next = cache->_freeLists[sizeClass];
+        cache->_freeLists[sizeClass] = block;
+        cache->_smallBytesInUse -= blockSize(sizeClass);
+        cache->_smallBytesRequested -= size;
+        if (++cache->_numFree[sizeClass] >= 2 * BATCH_SIZE)
+            flush(cache, sizeClass, BATCH_SIZE);
+    } else {
+        lock();
+        block->_next = _pool[sizeClass];
+        _pool[sizeClass] = block;
+        _numPooled[sizeClass]++;
+        _uncached._smallBytesInUse -= blockSize(sizeClass);
+        _uncached._smallBytesRequested -= size;
+        unlock();
+    }
+}
+
+OMR::PersistentAllocator::ThreadCache *OMR::PersistentAllocator::threadCache()
+{
+#if defined(SUPPORTS_THREAD_LOCAL)
+    ThreadCache *cache = static_cast<ThreadCache *>(TR_TLS_GET(threadCacheKey, void *));
+    if (cache && cache->_allocatorId == _id)
+        return cache;
+
+    // A thread only caches blocks of one allocator. It moves on to a newer
+    // allocator, such as the one created when the JIT is initialized again,
+    // and uses any older one through the shared pool.
+    if (cache && cache->_allocatorId > _id)
+        return NULL;
+
+    cache = static_cast<ThreadCache *>(_rawAllocator.allocate(sizeof(ThreadCache), std::nothrow));
+    if (!cache)
+        return NULL;
+
+    memset(cache, 0, sizeof(ThreadCache));
+    cache->_allocatorId = _id;
+
+    lock();
+    cache->_next = _threadCaches;
+    _threadCaches = cache;
+    unlock();
+
+    TR_TLS_SET(threadCacheKey, cache);
+    return cache;
+#else
+    return NULL;
+#endif
+}
+
+void *OMR::PersistentAllocator::allocateSmall(size_t size, size_t sizeClass) throw()
+{
+    ThreadCache *cache = threadCache();
+    FreeBlock *block = NULL;
+
+    if (cache) {
+        block = cache->_freeLists[sizeClass];
+        if (block) {
+            cache->_freeLists[sizeClass] = block->_next;
+            cache->_numFree[sizeClass]--;
+        } else {
+            block = refill(cache, sizeClass);
+            if (!block)
+                return NULL;
+        }
+        cache->_smallBytesInUse += blockSize(sizeClass);
+        cache->_smallBytesRequested += size;
+    } else {
+        lock();
+        block = takeFromPool(sizeClass);
+        if (block) {
+            _uncached._smallBytesInUse += blockSize(sizeClass);
+            _uncached._smallBytesRequested += size;
+        }
+        unlock();
+        if (!block)
+            return NULL;
+    }
+
+    Header *header = reinterpret_cast<Header *>(block);
+    header->_size = size;
+    header->_sizeClass = sizeClass;
+    return header + 1;
+}
+
+void *OMR::PersistentAllocator::allocateLarge(size_t size, const std::nothrow_t tag) throw()
+{
+    Header *header = static_cast<Header *>(_rawAllocator.allocate(sizeof(Header) + size, tag));
+    if (!header)
+        return NULL;
+
+    header->_size = size;
+    header->_sizeClass = LARGE;
+
+    ThreadCache *cache = threadCache();
+    if (cache) {
+        cache->_largeBytesInUse += size;
+        cache->_numLargeAllocations++;
+    } else {
+        lock();
+        _uncached._largeBytesInUse += size;
+        _uncached._numLargeAllocations++;
+        unlock();
+    }
+    return header + 1;
+}
+
+OMR::PersistentAllocator::FreeBlock *OMR::PersistentAllocator::refill(ThreadCache *cache, size_t sizeClass) throw()
+{
+    lock();
+    FreeBlock *first = takeFromPool(sizeClass);
+    for (uint32_t i = 1; first && i < BATCH_SIZE; i++) {
+        FreeBlock *block = takeFromPool(sizeClass);
+        if (!block)
+            break;
+        block->_next = cache->_freeLists[sizeClass];
+        cache->_freeLists[sizeClass] = block;
+        cache->_numFree[sizeClass]++;
+    }
+    unlock();
+    return first;
+}
+
+void OMR::PersistentAllocator::flush(ThreadCache *cache, size_t sizeClass, uint32_t count) throw()
+{
+    FreeBlock *first = cache->_freeLists[sizeClass];
+    FreeBlock *last = first;
+    for (uint32_t i = 1; i < count; i++)
+        last = last->_next;
+
+    cache->_freeLists[sizeClass] = last->_next;
+    cache->_numFree[sizeClass] -= count;
+
+    lock();
+    last->_next = _pool[sizeClass];
+    _pool[sizeClass] = first;
+    _numPooled[sizeClass] += count;
+    unlock();
+}
+
+OMR::PersistentAllocator::FreeBlock *OMR::PersistentAllocator::takeFromPool(size_t sizeClass) throw()
+{
+    FreeBlock *block = _pool[sizeClass];
+    if (block) {
+        _pool[sizeClass] = block->_next;
+        _numPooled[sizeClass]--;
+        return block;
+    }
+
+    size_t const bytes = blockSize(sizeClass);
+    if (_segmentRemaining < bytes) {
+        char *segment = static_cast<char *>(_rawAllocator.allocate(SEGMENT_SIZE, std::nothrow));
+        if (!segment)
+            return NULL;
+
+        // Put what is left of the current segment in the pool
+        for (size_t c = sizeClass; c-- > 0;) {
+            while (_segmentRemaining >= blockSize(c)) {
+                FreeBlock *leftover = reinterpret_cast<FreeBlock *>(_segmentAlloc);
+                leftover->_next = _pool[c];
+                _pool[c] = leftover;
+                _numPooled[c]++;
+                _segmentAlloc += blockSize(c);
+                _segmentRemaining -= blockSize(c);
+            }
+        }
+
+        _segmentAlloc = segment;
+        _segmentRemaining = SEGMENT_SIZE;
+        _segmentBytes += SEGMENT_SIZE;
+    }
+
+    block = reinterpret_cast<FreeBlock *>(_segmentAlloc);
+    _segmentAlloc += bytes;
+    _segmentRemaining -= bytes;
+    return block;
+}
+
+void OMR::PersistentAllocator::lock()
+{
+    if (MUTEX_TRY_ENTER(_mutex) != 0) {
+        MUTEX_ENTER(_mutex);
+        _contendedLockAcquisitions++;
+    }
+    _lockAcquisitions++;
+}
+
+void OMR::PersistentAllocator::unlock() { MUTEX_EXIT(_mutex); }
+
+void OMR::PersistentAllocator::getStatistics(Statistics &stats)
+{
+    memset(&stats, 0, sizeof(stats));
+
+    lock();
+
+    intptr_t smallBytesInUse = _uncached._smallBytesInUse;
+    intptr_t smallBytesRequested = _uncached._smallBytesRequested;
+    intptr_t largeBytesInUse = _uncached._largeBytesInUse;
+    intptr_t numLargeAllocations = _uncached._numLargeAllocations;
+
+    for (ThreadCache *cache = _threadCaches; cache; cache = cache->_next) {
+        smallBytesInUse += cache->_smallBytesInUse;
+        smallBytesRequested += cache->_smallBytesRequested;
+        largeBytesInUse += cache->_largeBytesInUse;
+        numLargeAllocations += cache->_numLargeAllocations;
+        for (uint32_t c = 0; c < NUM_SIZE_CLASSES; c++)
+            stats.cachedBytes += cache->_numFree[c] * blockSize(c);
+        stats.numThreadCaches++;
+    }
+
+    for (uint32_t c = 0; c < NUM_SIZE_CLASSES; c++)
+        stats.pooledBytes += _numPooled[c] * blockSize(c);
+
+    stats.segmentBytes = _segmentBytes;
+    stats.smallBytesInUse = static_cast<size_t>(smallBytesInUse);
+    stats.smallBytesRequested = static_cast<size_t>(smallBytesRequested);
+    stats.largeBytesInUse = static_cast<size_t>(largeBytesInUse);
+    stats.numLargeAllocations = static_cast<size_t>(numLargeAllocations);
+    stats.lockAcquisitions = _lockAcquisitions;
+    stats.contendedLockAcquisitions = _contendedLockAcquisitions;
+
+    unlock();
 }
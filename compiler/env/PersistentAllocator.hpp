@@ -42,17 +42,54 @@ using OMR::PersistentAllocator;
 
 #include "env/RawAllocator.hpp"
 #include "env/PersistentAllocatorKit.hpp"
+#include "omrmutex.h"
 
 namespace OMR {
 
+/**
+ * Allocator for memory that lives as long as the compiler.
+ *
+ * Requests of up to MAX_CACHED_SIZE bytes are rounded up to a power-of-two
+ * size class and carved out of segments obtained from the raw allocator. Every
+ * thread keeps a cache of free blocks of each class, so most small allocations
+ * and deallocations take no lock. A thread refills an empty cache with a batch
+ * of blocks from a pool shared by all threads, and returns a batch to the pool
+ * when its cache grows too large, so memory freed by one thread is reused by
+ * others. Larger requests go to the raw allocator.
+ *
+ * Memory in the segments and thread caches is kept until the process ends.
+ */
 class PersistentAllocator {
 public:
+    /**
+     * Footprint and lock contention of the allocator, see getStatistics().
+     */
+    struct Statistics {
+        size_t segmentBytes; ///< memory obtained for small allocations
+        size_t smallBytesInUse; ///< size class bytes of live small allocations
+        size_t smallBytesRequested; ///< bytes requested for live small allocations
+        size_t cachedBytes; ///< free small blocks in thread caches
+        size_t pooledBytes; ///< free small blocks in the shared pool
+        size_t largeBytesInUse; ///< bytes requested for live large allocations
+        size_t numLargeAllocations; ///< live large allocations
+        uint64_t lockAcquisitions; ///< times the shared pool was locked
+        uint64_t contendedLockAcquisitions; ///< times a thread had to wait for the lock
+        uint32_t numThreadCaches;
+    };
+
     PersistentAllocator(const TR::PersistentAllocatorKit &allocatorKit);
 
     void *allocate(size_t size, const std::nothrow_t tag, void *hint = 0) throw();
     void *allocate(size_t size, void *hint = 0);
     void deallocate(void *p, const size_t sizeHint = 0) throw();
 
+    /**
+     * Gather the allocator's statistics. Thread caches are read without
+     * synchronization, so the result is approximate while other threads are
+     * allocating.
+     */
+    void getStatistics(Statistics &stats);
+
     friend bool operator==(const PersistentAllocator &left, const PersistentAllocator &right)
     {
         return left._rawAllocator == right._rawAllocator;
@@ -63,10 +100,81 @@ public:
         return !operator==(left, right);
     }
 
+    static const size_t MAX_CACHED_SIZE = 512;
+
 private:
     PersistentAllocator(const PersistentAllocator &);
 
+    static const size_t MIN_CACHED_SIZE = 16;
+    static const uint32_t NUM_SIZE_CLASSES = 6; // 16 to 512 bytes
+    static const size_t LARGE = ~static_cast<size_t>(0);
+    static const uint32_t BATCH_SIZE = 16;
+    static const size_t SEGMENT_SIZE = 64 * 1024;
+
+    /**
+     * Precedes every allocation. The header is 16 bytes so that allocations
+     * keep the alignment of the raw allocator.
+     */
+    struct Header {
+        size_t _size; ///< bytes requested
+        size_t _sizeClass; ///< LARGE for allocations from the raw allocator
+    };
+
+    struct FreeBlock {
+        FreeBlock *_next;
+    };
+
+    struct ThreadCache {
+        ThreadCache *_next;
+        uint32_t _allocatorId;
+        uint32_t _numFree[NUM_SIZE_CLASSES];
+        FreeBlock *_freeLists[NUM_SIZE_CLASSES];
+
+        // Blocks are often freed by another thread than the one that
+        // allocated them, so the counters of one cache may be negative
+        intptr_t _smallBytesInUse;
+        intptr_t _smallBytesRequested;
+        intptr_t _largeBytesInUse;
+        intptr_t _numLargeAllocations;
+    };
+
+    static size_t sizeClass(size_t size)
+    {
+        size_t sizeClass = 0;
+        while ((MIN_CACHED_SIZE << sizeClass) < size)
+            sizeClass++;
+        return sizeClass;
+    }
+
+    static size_t blockSize(size_t sizeClass) { return sizeof(Header) + (MIN_CACHED_SIZE << sizeClass); }
+
+    ThreadCache *threadCache();
+    void *allocateSmall(size_t size, size_t sizeClass) throw();
+    void *allocateLarge(size_t size, const std::nothrow_t tag) throw();
+    FreeBlock *refill(ThreadCache *cache, size_t sizeClass) throw();
+    void flush(ThreadCache *cache, size_t sizeClass, uint32_t count) throw();
+    FreeBlock *takeFromPool(size_t sizeClass) throw();
+    void lock();
+    void unlock();
+
+    static uint32_t _nextId;
+
     TR::RawAllocator _rawAllocator;
+    uint32_t const _id;
+    MUTEX _mutex;
+
+    // Protected by _mutex
+    ThreadCache *_threadCaches;
+    FreeBlock *_pool[NUM_SIZE_CLASSES];
+    uint32_t _numPooled[NUM_SIZE_CLASSES];
+    char *_segmentAlloc;
+    size_t _segmentRemaining;
+    size_t _segmentBytes;
+    uint64_t _lockAcquisitions;
+    uint64_t _contendedLockAcquisitions;
+
+    // Counters of threads without a cache, protected by _mutex
+    ThreadCache _uncached;
 };
 
 } // namespace OMR
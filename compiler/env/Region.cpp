@@ -19,9 +19,11 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <string.h>
 #include "env/MemorySegment.hpp"
 #include "env/SegmentProvider.hpp"
 #include "env/Region.hpp"
+#include "infra/Assert.hpp"
 #include "infra/ReferenceWrapper.hpp"
 #include "env/TRMemory.hpp"
 
@@ -29,21 +31,31 @@ namespace TR {
 
 Region::Region(TR::SegmentProvider &segmentProvider, TR::RawAllocator rawAllocator)
     : _bytesAllocated(0)
+    , _bytesInUse(0)
+    , _highWaterMark(0)
+    , _freeListsEnabled(false)
     , _segmentProvider(segmentProvider)
     , _rawAllocator(rawAllocator)
     , _initialSegment(_initialSegmentArea.data, INITIAL_SEGMENT_SIZE)
     , _currentSegment(TR::ref(_initialSegment))
     , _lastDestroyer(NULL)
-{}
+{
+    memset(_freeLists, 0, sizeof(_freeLists));
+}
 
 Region::Region(const Region &prototype)
     : _bytesAllocated(0)
+    , _bytesInUse(0)
+    , _highWaterMark(0)
+    , _freeListsEnabled(prototype._freeListsEnabled)
     , _segmentProvider(prototype._segmentProvider)
     , _rawAllocator(prototype._rawAllocator)
     , _initialSegment(_initialSegmentArea.data, INITIAL_SEGMENT_SIZE)
     , _currentSegment(TR::ref(_initialSegment))
     , _lastDestroyer(NULL)
-{}
+{
+    memset(_freeLists, 0, sizeof(_freeLists));
+}
 
 Region::~Region() throw()
 {
@@ -65,9 +77,34 @@ Region::~Region() throw()
     TR_ASSERT(_currentSegment.get() == _initialSegment, "self-referencial link was broken");
 }
 
+void Region::enableFreeLists()
+{
+    TR_ASSERT_FATAL(_bytesAllocated == 0, "Free lists must be enabled before the region allocates");
+    _freeListsEnabled = true;
+}
+
 void *Region::allocate(size_t const size, void *hint)
 {
-    size_t const roundedSize = (size + 15) & (~15);
+    if (_freeListsEnabled && size <= MAX_FREE_LIST_ALLOCATION) {
+        size_t const sizeClass = Region::sizeClass(size);
+        void *allocation = _freeLists[sizeClass];
+        if (allocation == NULL)
+            return allocateFromSegment(MIN_FREE_LIST_ALLOCATION << sizeClass);
+
+        memcpy(&_freeLists[sizeClass], allocation, sizeof(void *));
+        _bytesInUse += MIN_FREE_LIST_ALLOCATION << sizeClass;
+        if (_bytesInUse > _highWaterMark)
+            _highWaterMark = _bytesInUse;
+        return allocation;
+    }
+    return allocateFromSegment((size + 15) & (~15));
+}
+
+void *Region::allocateFromSegment(size_t const roundedSize)
+{
+    _bytesInUse += roundedSize;
+    if (_bytesInUse > _highWaterMark)
+        _highWaterMark = _bytesInUse;
     if (_currentSegment.get().remaining() >= roundedSize) {
         _bytesAllocated += roundedSize;
         return _currentSegment.get().allocate(roundedSize);
@@ -80,5 +117,15 @@ void *Region::allocate(size_t const size, void *hint)
     return _currentSegment.get().allocate(roundedSize);
 }
 
-void Region::deallocate(void *allocation, size_t) throw() {}
+void Region::deallocate(void *allocation, size_t size) throw()
+{
+    if (!_freeListsEnabled || allocation == NULL || size == 0 || size > MAX_FREE_LIST_ALLOCATION)
+        return;
+
+    size_t const sizeClass = Region::sizeClass(size);
+    memcpy(allocation, &_freeLists[sizeClass], sizeof(void *));
+    _freeLists[sizeClass] = allocation;
+    _bytesInUse -= MIN_FREE_LIST_ALLOCATION << sizeClass;
+}
+
 } // namespace TR
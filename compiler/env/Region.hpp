@@ -139,7 +139,34 @@ public:
         _lastDestroyer = new (*this) TypedDestroyer<T>(_lastDestroyer, obj);
     }
 
-    void deallocate(void *allocation, size_t = 0) throw();
+    /**
+     * \brief Return memory to the Region before the Region is destroyed.
+     *
+     * This does nothing unless free lists are enabled (see enableFreeLists())
+     * and \p size is the size that was requested from allocate() for
+     * \p allocation.
+     */
+    void deallocate(void *allocation, size_t size = 0) throw();
+
+    /**
+     * \brief Reuse small allocations returned with deallocate().
+     *
+     * Memory normally comes back only when the whole Region is destroyed, so
+     * temporary containers that are built and discarded add to the peak
+     * memory of the Region. Once free lists are enabled, requests of up to
+     * MAX_FREE_LIST_ALLOCATION bytes are rounded up to a power-of-two size
+     * class, and deallocate() keeps such memory on a free list for its class
+     * where the next allocation of the same class finds it. The containers
+     * that use TR::typed_allocator pass the size of every buffer and node
+     * they release, so they recycle their memory this way.
+     *
+     * Free lists must be enabled before the Region allocates anything. Regions
+     * created from this one as a prototype, such as TR::StackMemoryRegion,
+     * inherit the setting.
+     */
+    void enableFreeLists();
+
+    bool freeListsEnabled() const { return _freeListsEnabled; }
 
     static void reset(TR::Region &targetRegion, TR::Region &prototypeRegion)
     {
@@ -156,12 +183,40 @@ public:
 
     size_t bytesAllocated() { return _bytesAllocated; }
 
+    /**
+     * \brief Bytes allocated and not yet returned with deallocate().
+     *
+     * This is the same as bytesAllocated() unless free lists are enabled.
+     */
+    size_t bytesInUse() const { return _bytesInUse; }
+
+    /** \brief The largest value bytesInUse() has had. */
+    size_t highWaterMark() const { return _highWaterMark; }
+
     static size_t initialSize() { return INITIAL_SEGMENT_SIZE; }
 
 private:
     friend class TR::RegionProfiler;
 
+    void *allocateFromSegment(size_t roundedSize);
+
+    static size_t sizeClass(size_t size)
+    {
+        size_t sizeClass = 0;
+        while ((MIN_FREE_LIST_ALLOCATION << sizeClass) < size)
+            sizeClass++;
+        return sizeClass;
+    }
+
+    static const size_t MIN_FREE_LIST_ALLOCATION = 16;
+    static const size_t MAX_FREE_LIST_ALLOCATION = 1024;
+    static const size_t NUM_SIZE_CLASSES = 7; // 16 to 1024 bytes
+
     size_t _bytesAllocated;
+    size_t _bytesInUse;
+    size_t _highWaterMark;
+    bool _freeListsEnabled;
+    void *_freeLists[NUM_SIZE_CLASSES];
     TR::SegmentProvider &_segmentProvider;
     TR::RawAllocator _rawAllocator;
     TR::MemorySegment _initialSegment;
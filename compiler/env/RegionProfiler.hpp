@@ -39,8 +39,10 @@ namespace TR {
  * This class makes use of the compiler's debug counter facility to record the
  * difference in memory usage for a region and its segment provider between the
  * two points of execution determined by the invocation of its constructor and
- * the invocation of its destructor. The lifetime of the region tracked by the
- * profiler object must comprehend the lifetime of the profiler itself. The
+ * the invocation of its destructor, along with the high-water mark of the
+ * region's memory in use between those points. The lifetime of the region
+ * tracked by the profiler object must comprehend the lifetime of the profiler
+ * itself, and profilers of the same region must be nested. The
  * implementation requires a compilation object in order to determine whether
  * or not the facility is active.
  */
@@ -51,8 +53,14 @@ public:
         : _region(region)
         , _initialRegionSize(_region.bytesAllocated())
         , _initialSegmentProviderSize(_region._segmentProvider.bytesAllocated())
+        , _initialBytesInUse(_region._bytesInUse)
+        , _enclosingHighWaterMark(_region._highWaterMark)
         , _compilation(compilation)
     {
+        // Track the high-water mark of this scope alone, and fold it back into
+        // the region's mark when the scope ends
+        _region._highWaterMark = _region._bytesInUse;
+
         if (_compilation.getOption(TR_ProfileMemoryRegions)) {
             va_list args;
             va_start(args, format);
@@ -73,13 +81,48 @@ public:
             TR::DebugCounter::incStaticDebugCounter(&_compilation,
                 TR::DebugCounter::debugCounterName(&_compilation, "segmentAllocation.details/%s", _identifier),
                 static_cast<int32_t>((_region._segmentProvider.bytesAllocated() - _initialSegmentProviderSize) / 1024));
+            TR::DebugCounter::incStaticDebugCounter(&_compilation,
+                TR::DebugCounter::debugCounterName(&_compilation, "kbytesHighWaterMark.details/%s", _identifier),
+                static_cast<int32_t>(highWaterMark() / 1024));
         }
+
+        if (_enclosingHighWaterMark > _region._highWaterMark)
+            _region._highWaterMark = _enclosingHighWaterMark;
+    }
+
+    /**
+     * Bytes allocated from the region since the profiler was constructed.
+     */
+    size_t regionBytesAllocated() { return _region.bytesAllocated() - _initialRegionSize; }
+
+    /**
+     * Most bytes of the region in use at any point since the profiler was
+     * constructed, beyond those in use when it was constructed. This is less
+     * than regionBytesAllocated() when the region has free lists enabled and
+     * memory was returned to it and reused.
+     */
+    size_t highWaterMark() const
+    {
+        return _region._highWaterMark > _initialBytesInUse ? _region._highWaterMark - _initialBytesInUse : 0;
+    }
+
+    /**
+     * Growth of the region's segment provider since the profiler was
+     * constructed, or zero if it has shrunk. This includes memory obtained for
+     * any other region sharing the provider, such as stack memory regions.
+     */
+    size_t segmentBytesAllocated() const
+    {
+        size_t current = _region._segmentProvider.bytesAllocated();
+        return current > _initialSegmentProviderSize ? current - _initialSegmentProviderSize : 0;
     }
 
 private:
     TR::Region &_region;
     size_t const _initialRegionSize;
     size_t const _initialSegmentProviderSize;
+    size_t const _initialBytesInUse;
+    size_t const _enclosingHighWaterMark;
     TR::Compilation &_compilation;
     char _identifier[256];
 };
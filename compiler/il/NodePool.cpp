@@ -35,18 +35,65 @@ TR::NodePool::NodePool(TR::Compilation *comp)
     , _disableGC(true)
     , _globalIndex(0)
     , _nodeRegion(comp->trMemory()->heapMemoryRegion())
+    , _nextNode(NULL)
+    , _nodesLeftInBlock(0)
+    , _sideTableChunks(NULL)
+    , _numSideTableChunks(0)
+    , _maxSideTableChunks(0)
 {}
 
-void TR::NodePool::cleanUp() { TR::Region::reset(_nodeRegion, _comp->trMemory()->heapMemoryRegion()); }
+void TR::NodePool::cleanUp()
+{
+    TR::Region::reset(_nodeRegion, _comp->trMemory()->heapMemoryRegion());
+    _nextNode = NULL;
+    _nodesLeftInBlock = 0;
+    _sideTableChunks = NULL;
+    _numSideTableChunks = 0;
+    _maxSideTableChunks = 0;
+}
+
+void TR::NodePool::addSideTableChunk()
+{
+    if (_numSideTableChunks == _maxSideTableChunks) {
+        uint32_t maxChunks = _maxSideTableChunks ? _maxSideTableChunks * 2 : 16;
+        SideTableEntry **chunks
+            = static_cast<SideTableEntry **>(_nodeRegion.allocate(maxChunks * sizeof(SideTableEntry *)));
+        memset(chunks, 0, maxChunks * sizeof(SideTableEntry *));
+        if (_numSideTableChunks)
+            memcpy(chunks, _sideTableChunks, _numSideTableChunks * sizeof(SideTableEntry *));
+        _sideTableChunks = chunks;
+        _maxSideTableChunks = maxChunks;
+    }
+
+    SideTableEntry *chunk
+        = static_cast<SideTableEntry *>(_nodeRegion.allocate(SIDE_TABLE_ENTRIES_PER_CHUNK * sizeof(SideTableEntry)));
+    memset(static_cast<void *>(chunk), 0, SIDE_TABLE_ENTRIES_PER_CHUNK * sizeof(SideTableEntry));
+#ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
+    for (uint32_t i = 0; i < SIDE_TABLE_ENTRIES_PER_CHUNK; i++)
+        chunk[i]._knownObjectIndex = TR::KnownObjectTable::UNKNOWN;
+#endif
+    _sideTableChunks[_numSideTableChunks++] = chunk;
+}
 
 TR::Node *TR::NodePool::allocate()
 {
-    void *space = _nodeRegion.allocate(sizeof(TR::Node));
+    if (_nodesLeftInBlock == 0) {
+        _nextNode = static_cast<char *>(_nodeRegion.allocate(NODES_PER_BLOCK * sizeof(TR::Node)));
+        _nodesLeftInBlock = NODES_PER_BLOCK;
+    }
+
+    void *space = _nextNode;
+    _nextNode += sizeof(TR::Node);
+    _nodesLeftInBlock--;
+
     memset(space, 0, sizeof(TR::Node));
     TR::Node *newNode = static_cast<TR::Node *>(space);
     newNode->_globalIndex = ++_globalIndex;
     TR_ASSERT(_globalIndex < MAX_NODE_COUNT, "Reached TR::Node allocation limit");
 
+    while (_globalIndex / SIDE_TABLE_ENTRIES_PER_CHUNK >= _numSideTableChunks)
+        addSideTableChunk();
+
     if (debug("traceNodePool")) {
         diagnostic("%sAllocating Node[%p] with Global Index %d\n", OPT_DETAILS_NODEPOOL, newNode,
             newNode->getGlobalIndex());
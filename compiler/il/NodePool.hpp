@@ -53,14 +53,59 @@ public:
 
     TR::Compilation *comp() { return _comp; }
 
+    /**
+     * Byte code info of the node with the given global index.
+     *
+     * Byte code info and known object indices are read when nodes are
+     * created, inlined and encoded, but not by the tree walks that make up
+     * most of an optimization, so they are kept in this side table rather
+     * than in TR::Node. That keeps the node fields that are walked small and
+     * densely packed.
+     */
+    TR_ByteCodeInfo &byteCodeInfo(ncount_t globalIndex) { return sideTableEntry(globalIndex)._byteCodeInfo; }
+
+#ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
+    TR::KnownObjectTable::Index &knownObjectIndex(ncount_t globalIndex)
+    {
+        return sideTableEntry(globalIndex)._knownObjectIndex;
+    }
+#endif
+
     void cleanUp();
 
 private:
+    // Nodes are carved out of blocks so that they are not each rounded up to
+    // the region's allocation granularity
+    static const uint32_t NODES_PER_BLOCK = 64;
+
+    struct SideTableEntry {
+        TR_ByteCodeInfo _byteCodeInfo;
+#ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
+        TR::KnownObjectTable::Index _knownObjectIndex;
+#endif
+    };
+
+    static const uint32_t SIDE_TABLE_ENTRIES_PER_CHUNK = 1024;
+
+    SideTableEntry &sideTableEntry(ncount_t globalIndex)
+    {
+        return _sideTableChunks[globalIndex / SIDE_TABLE_ENTRIES_PER_CHUNK][globalIndex % SIDE_TABLE_ENTRIES_PER_CHUNK];
+    }
+
+    void addSideTableChunk();
+
     TR::Compilation *_comp;
     bool _disableGC;
     ncount_t _globalIndex;
 
     TR::Region _nodeRegion;
+
+    char *_nextNode;
+    uint32_t _nodesLeftInBlock;
+
+    SideTableEntry **_sideTableChunks;
+    uint32_t _numSideTableChunks;
+    uint32_t _maxSideTableChunks;
 };
 
 } // namespace TR
@@ -131,6 +131,7 @@ public:
         HasBranches = 0x00000010,
         HasVectorAPI = 0x00000020,
         HasIdiomRecognitionOpportunities = 0x00000040,
+        HasAggregateAllocations = 0x00000080,
         dummyLastFlag2
     };
 
@@ -104,12 +104,6 @@ OMR::Node::Node()
     , _visitCount(0)
     , _localIndex(0)
     , _referenceCount(0)
-    ,
-#ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
-    _knownObjectIndex(TR::KnownObjectTable::UNKNOWN)
-    ,
-#endif
-    _byteCodeInfo()
     , _unionBase()
     , _unionPropertyA()
 {}
@@ -130,12 +124,6 @@ OMR::Node::Node(TR::Node *originatingByteCodeNode, TR::ILOpCodes op, uint16_t nu
     , _visitCount(0)
     , _localIndex(0)
     , _referenceCount(0)
-    ,
-#ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
-    _knownObjectIndex(TR::KnownObjectTable::UNKNOWN)
-    ,
-#endif
-    _byteCodeInfo()
     , _unionBase()
     , _unionPropertyA()
 {
@@ -169,29 +157,31 @@ OMR::Node::Node(TR::Node *originatingByteCodeNode, TR::ILOpCodes op, uint16_t nu
         comp->failCompilation<TR::ExcessiveComplexity>("Global index equal to max node count");
     }
 
-    _byteCodeInfo.setInvalidCallerIndex();
-    _byteCodeInfo.setIsSameReceiver(0);
+    TR_ByteCodeInfo &byteCodeInfo = comp->getNodePool().byteCodeInfo(_globalIndex);
+    byteCodeInfo = TR_ByteCodeInfo();
+    byteCodeInfo.setInvalidCallerIndex();
+    byteCodeInfo.setIsSameReceiver(0);
     TR_IlGenerator *ilGen = comp->getCurrentIlGenerator();
     if (ilGen) {
         int32_t i = ilGen->currentByteCodeIndex();
-        _byteCodeInfo.setByteCodeIndex(i >= 0 ? i : 0);
-        _byteCodeInfo.setCallerIndex(comp->getCurrentInlinedSiteIndex());
+        byteCodeInfo.setByteCodeIndex(i >= 0 ? i : 0);
+        byteCodeInfo.setCallerIndex(comp->getCurrentInlinedSiteIndex());
 
-        if (_byteCodeInfo.getCallerIndex() < 0)
-            _byteCodeInfo.setCallerIndex(ilGen->currentCallSiteIndex());
-        TR_ASSERT(_byteCodeInfo.getCallerIndex() < (SHRT_MAX / 4),
+        if (byteCodeInfo.getCallerIndex() < 0)
+            byteCodeInfo.setCallerIndex(ilGen->currentCallSiteIndex());
+        TR_ASSERT(byteCodeInfo.getCallerIndex() < (SHRT_MAX / 4),
             "Caller index too high; cannot set high order bit\n");
-        _byteCodeInfo.setDoNotProfile(0);
+        byteCodeInfo.setDoNotProfile(0);
     } else if (originatingByteCodeNode) {
-        _byteCodeInfo = originatingByteCodeNode->getByteCodeInfo();
-        _byteCodeInfo.setDoNotProfile(1);
+        byteCodeInfo = originatingByteCodeNode->getByteCodeInfo();
+        byteCodeInfo.setDoNotProfile(1);
     } else {
         // Commented out because dummy nodes are created in
         // estimate code size to be able to propagate frequencies
         // else
         //   TR_ASSERT(0, "no byte code info");
 
-        _byteCodeInfo.setDoNotProfile(1);
+        byteCodeInfo.setDoNotProfile(1);
     }
     if (comp->getDebug())
         comp->getDebug()->newNode(self());
@@ -221,12 +211,6 @@ OMR::Node::Node(TR::Node *from, uint16_t numChildren)
     , _visitCount(0)
     , _localIndex(0)
     , _referenceCount(0)
-    ,
-#ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
-    _knownObjectIndex(TR::KnownObjectTable::UNKNOWN)
-    ,
-#endif
-    _byteCodeInfo()
     , _unionBase()
     , _unionPropertyA()
 {
@@ -242,7 +226,8 @@ OMR::Node::Node(TR::Node *from, uint16_t numChildren)
 
     self()->setGlobalIndex(comp->getNodePool().getLastGlobalIndex());
     // a memcpy is used above to copy fields from the argument "node" to "this", but
-    // opt attributes are separate, and need separate initialization.
+    // opt attributes and the byte code info are separate, and need separate initialization.
+    self()->getByteCodeInfo() = from->getByteCodeInfo();
     self()->setReferenceCount(from->getReferenceCount());
     self()->setVisitCount(from->getVisitCount());
     self()->setLocalIndex(from->getLocalIndex());
@@ -421,7 +406,7 @@ void OMR::Node::copyValidProperties(TR::Node *fromNode, TR::Node *toNode)
     // TODO: check whether properties are valid for the replacement node and remove if invalid
 
     if (toNode->getOpCode().isBranch() || toNode->getOpCode().isSwitch())
-        toNode->_byteCodeInfo.setDoNotProfile(1);
+        toNode->getByteCodeInfo().setDoNotProfile(1);
 
     // _flags
     toNode->setFlags(fromNode->getFlags()); // do not clear hasNodeExtension
@@ -497,7 +482,7 @@ TR::Node *OMR::Node::recreateAndCopyValidPropertiesImpl(TR::Node *originalNode,
     TR_ASSERT(originalNode != NULL, "trying to recreate node from a NULL originalNode.");
     if (originalNode->getOpCodeValue() == op) {
         if (!originalNode->hasSymbolReference() || newSymRef != originalNode->getSymbolReference())
-            originalNode->_byteCodeInfo.setDoNotProfile(1);
+            originalNode->getByteCodeInfo().setDoNotProfile(1);
 
         // need to at least set the new symbol reference on the node before returning
         if (newSymRef)
@@ -545,7 +530,7 @@ TR::Node *OMR::Node::recreateAndCopyValidPropertiesImpl(TR::Node *originalNode,
 
     // TODO: copyValidProperties is incomplete
     TR::Node::copyValidProperties(originalNodeCopy, node);
-    originalNode->_byteCodeInfo.setDoNotProfile(1);
+    originalNode->getByteCodeInfo().setDoNotProfile(1);
 
     // add originalNodeCopy back to the node pool
     comp->getNodePool().deallocate(originalNodeCopy);
@@ -3637,27 +3622,38 @@ void OMR::Node::setFlags(flags32_t f)
     self()->setHasNodeExtension(nodeExtensionExists);
 }
 
-void OMR::Node::setByteCodeInfo(const TR_ByteCodeInfo &bcInfo)
+TR_ByteCodeInfo &OMR::Node::getByteCodeInfo() { return TR::comp()->getNodePool().byteCodeInfo(_globalIndex); }
+
+#ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
+void OMR::Node::setKnownObjectIndex(TR::KnownObjectTable::Index koi)
 {
-    _byteCodeInfo = bcInfo;
-    if (!TR::comp()->getCurrentIlGenerator())
-        _byteCodeInfo.setDoNotProfile(1);
+    TR::comp()->getNodePool().knownObjectIndex(_globalIndex) = koi;
 }
 
-void OMR::Node::copyByteCodeInfo(TR::Node *from)
+TR::KnownObjectTable::Index OMR::Node::getKnownObjectIndex()
 {
-    _byteCodeInfo = from->_byteCodeInfo;
-    if (!TR::comp()->getCurrentIlGenerator())
-        _byteCodeInfo.setDoNotProfile(1);
+    return TR::comp()->getNodePool().knownObjectIndex(_globalIndex);
 }
+#endif
+
+void OMR::Node::setByteCodeInfo(const TR_ByteCodeInfo &bcInfo)
+{
+    TR::Compilation *comp = TR::comp();
+    TR_ByteCodeInfo &byteCodeInfo = comp->getNodePool().byteCodeInfo(_globalIndex);
+    byteCodeInfo = bcInfo;
+    if (!comp->getCurrentIlGenerator())
+        byteCodeInfo.setDoNotProfile(1);
+}
+
+void OMR::Node::copyByteCodeInfo(TR::Node *from) { self()->setByteCodeInfo(from->getByteCodeInfo()); }
 
-uint32_t OMR::Node::getByteCodeIndex() { return _byteCodeInfo.getByteCodeIndex(); }
+uint32_t OMR::Node::getByteCodeIndex() { return self()->getByteCodeInfo().getByteCodeIndex(); }
 
-void OMR::Node::setByteCodeIndex(uint32_t i) { _byteCodeInfo.setByteCodeIndex(i); }
+void OMR::Node::setByteCodeIndex(uint32_t i) { self()->getByteCodeInfo().setByteCodeIndex(i); }
 
-int16_t OMR::Node::getInlinedSiteIndex() { return _byteCodeInfo.getCallerIndex(); }
+int16_t OMR::Node::getInlinedSiteIndex() { return self()->getByteCodeInfo().getCallerIndex(); }
 
-void OMR::Node::setInlinedSiteIndex(int16_t i) { _byteCodeInfo.setCallerIndex(i); }
+void OMR::Node::setInlinedSiteIndex(int16_t i) { self()->getByteCodeInfo().setCallerIndex(i); }
 
 TR::Node *OMR::Node::setChild(int32_t c, TR::Node *p)
 {
@@ -845,7 +845,9 @@ public:
 
     void setFlags(flags32_t f);
 
-    TR_ByteCodeInfo &getByteCodeInfo() { return _byteCodeInfo; }
+    /// Kept in a side table of the compilation's TR::NodePool, indexed by the
+    /// global index.
+    TR_ByteCodeInfo &getByteCodeInfo();
 
     void setByteCodeInfo(const TR_ByteCodeInfo &bcInfo);
     void copyByteCodeInfo(TR::Node *from);
@@ -913,19 +915,19 @@ public:
      * @brief Sets a known object index on this node
      * @param[in] koi : the known object index
      */
-    void setKnownObjectIndex(TR::KnownObjectTable::Index koi) { _knownObjectIndex = koi; }
+    void setKnownObjectIndex(TR::KnownObjectTable::Index koi);
 
     /**
      * @brief Retrieve the known object index associated with this node, if any.
      * @return Known object index, or TR::KnownObjectTable::UNKNOWN if none.
      */
-    TR::KnownObjectTable::Index getKnownObjectIndex() { return _knownObjectIndex; }
+    TR::KnownObjectTable::Index getKnownObjectIndex();
 
     /**
      * @brief Inquires whether this node has a known object index associated with it.
      * @return true if a known object index is cached; false otherwise.
      */
-    bool hasKnownObjectIndex() { return _knownObjectIndex != TR::KnownObjectTable::UNKNOWN; }
+    bool hasKnownObjectIndex() { return getKnownObjectIndex() != TR::KnownObjectTable::UNKNOWN; }
 #endif
 
     inline scount_t getFutureUseCount();
@@ -1834,7 +1836,9 @@ protected:
     vcount_t _visitCount;
 
     /// Unique index for every single node created - no other node
-    /// will have the same index within a compilation.
+    /// will have the same index within a compilation. Also indexes the
+    /// side table of the TR::NodePool that holds the byte code info and
+    /// known object index.
     ncount_t _globalIndex;
 
     /// Flags for the node.
@@ -1843,23 +1847,9 @@ protected:
     /// Index for this node, used throughout optimizations.
     scount_t _localIndex;
 
-    /// Info about the byte code associated with this node.
-    TR_ByteCodeInfo _byteCodeInfo;
-
     /// References to this node.
     rcount_t _referenceCount;
 
-#ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
-    /// Known object index associated with this node, if any.
-    ///
-    /// This field allows for more accurate placement of known object information
-    /// as it applies to a particular node.
-    ///
-    /// If no such information is available this field is TR::KnownObjectTable::UNKNOWN
-    ///
-    TR::KnownObjectTable::Index _knownObjectIndex;
-#endif
-
     UnionA _unionA;
 
     /// Elements unioned with children.
@@ -2092,7 +2092,7 @@ int32_t OMR::ResolvedMethodSymbol::incTempIndex(TR_FrontEnd *fe) { return self()
 
 bool OMR::ResolvedMethodSymbol::hasEscapeAnalysisOpportunities()
 {
-    return self()->hasNews() || self()->hasDememoizationOpportunities();
+    return self()->hasNews() || self()->hasDememoizationOpportunities() || self()->hasAggregateAllocations();
 }
 
 bool OMR::ResolvedMethodSymbol::doJSR292PerfTweaks() { return false; }
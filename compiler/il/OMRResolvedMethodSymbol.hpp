@@ -311,6 +311,10 @@ public:
 
     void setHasIdiomRecognitionOpportunities(bool b) { _methodFlags2.set(HasIdiomRecognitionOpportunities, b); }
 
+    bool hasAggregateAllocations() { return _methodFlags2.testAny(HasAggregateAllocations); }
+
+    void setHasAggregateAllocations(bool b) { _methodFlags2.set(HasAggregateAllocations, b); }
+
     int32_t getNumberOfBackEdges();
 
     bool canDirectNativeCall() { return _properties.testAny(CanDirectNativeCall); }
@@ -667,6 +667,7 @@ TR::IlValue *OMR::IlBuilder::CreateLocalArray(int32_t numElements, TR::IlType *e
     _methodBuilder->defineSymbol(name, localArraySymRef);
 
     TR::Node *arrayAddress = TR::Node::createWithSymRef(TR::loadaddr, 0, localArraySymRef);
+    _comp->getMethodSymbol()->setHasAggregateAllocations(true);
     TR::IlValue *arrayAddressValue = newValue(TR::Address, arrayAddress);
 
     TraceIL("IlBuilder[ %p ]::%d is CreateLocalArray array allocated %d bytes\n", this, arrayAddressValue->getID(),
@@ -688,6 +689,7 @@ TR::IlValue *OMR::IlBuilder::CreateLocalStruct(TR::IlType *structType)
     _methodBuilder->defineSymbol(name, localStructSymRef);
 
     TR::Node *structAddress = TR::Node::createWithSymRef(TR::loadaddr, 0, localStructSymRef);
+    _comp->getMethodSymbol()->setHasAggregateAllocations(true);
     TR::IlValue *structAddressValue = newValue(TR::Address, structAddress);
 
     TraceIL("IlBuilder[ %p ]::%d is CreateLocalStruct struct allocated %d bytes\n", this, structAddressValue->getID(),
@@ -1995,6 +1997,8 @@ TR::IlValue *OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, ...
     if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
         resolvedMethod = _methodBuilder->lookupFunction(functionName);
     TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
+    if (resolvedMethod->isAllocationFunction())
+        _comp->getMethodSymbol()->setHasAggregateAllocations(true);
 
     TR::SymbolReference *methodSymRef
         = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
@@ -2008,6 +2012,8 @@ TR::IlValue *OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, TR:
     if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
         resolvedMethod = _methodBuilder->lookupFunction(functionName);
     TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
+    if (resolvedMethod->isAllocationFunction())
+        _comp->getMethodSymbol()->setHasAggregateAllocations(true);
 
     TR::SymbolReference *methodSymRef
         = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
@@ -40,6 +40,7 @@
 #include "compile/SymbolReferenceTable.hpp"
 #include "control/CompileMethod.hpp"
 #include "control/Recompilation.hpp"
+#include "control/TieredCompilation.hpp"
 #include "infra/Assert.hpp"
 #include "infra/Cfg.hpp"
 #include "infra/STLUtils.hpp"
@@ -131,6 +132,7 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
     , _nextInlineSiteIndex(0)
     , _returnBuilder(NULL)
     , _returnSymbolName(NULL)
+    , _tieredMethod(NULL)
 {
     _definingLine[0] = '\0';
 }
@@ -164,6 +166,7 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
     , _nextInlineSiteIndex(0)
     , _returnBuilder(NULL)
     , _returnSymbolName(NULL)
+    , _tieredMethod(NULL)
 {
     _definingLine[0] = '\0';
     initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -229,6 +232,98 @@ void OMR::MethodBuilder::setupForBuildIL()
 
     // set up initial CFG
     cfg()->addEdge(_entryBlock, _currentBlock);
+
+    if (_tieredMethod)
+        generateTieredForwarding();
+}
+
+bool OMR::MethodBuilder::injectIL()
+{
+    bool rc = TR::IlBuilder::injectIL();
+    if (rc && _tieredMethod)
+        insertTieredCounters();
+    return rc;
+}
+
+#define TIERED_FORWARD_FUNCTION_NAME "TieredForwardTarget"
+
+void OMR::MethodBuilder::generateTieredForwarding()
+{
+    TR::IlType **parmTypes = getParameterTypes();
+    if (_functions.find(TIERED_FORWARD_FUNCTION_NAME) == _functions.end())
+        DefineFunction(TIERED_FORWARD_FUNCTION_NAME, _definingFile, _definingLine, NULL, _returnType, _numParameters,
+            parmTypes);
+
+    void *slot = const_cast<void **>(&_tieredMethod->_forwardTo[comp()->getMethodHotness()]);
+    TR::IlType *pAddress = typeDictionary()->PointerTo(Address);
+
+    TR::IlBuilder *forward = NULL;
+    IfThen(&forward, NotEqualTo(LoadAt(pAddress, ConstAddress(slot)), NullAddress()));
+
+    TR::IlValue **args
+        = (TR::IlValue **)comp()->trMemory()->allocateHeapMemory((_numParameters + 1) * sizeof(TR::IlValue *));
+    args[0] = forward->LoadAt(pAddress, forward->ConstAddress(slot));
+    for (int32_t p = 0; p < _numParameters; p++)
+        args[p + 1] = forward->Load(getSymbolName(p));
+
+    TR::IlValue *result = forward->ComputedCall(TIERED_FORWARD_FUNCTION_NAME, _numParameters + 1, args);
+    if (_returnType == NoType)
+        forward->Return();
+    else
+        forward->Return(result);
+}
+
+static void prependTieredCounterBump(TR::Compilation *comp, TR::Block *block, TR::SymbolReference *counter)
+{
+    // Same shape as a debug counter bump: word sized on 64 bit and 32 bit platforms
+    TR::Node *origin = block->getEntry()->getNode();
+    bool is64Bit = comp->target().is64Bit();
+    TR::Node *delta = is64Bit ? TR::Node::lconst(origin, 1) : TR::Node::iconst(origin, 1);
+    TR::Node *load = TR::Node::createWithSymRef(delta, is64Bit ? TR::lload : TR::iload, 0, counter);
+    TR::Node *add = TR::Node::create(is64Bit ? TR::ladd : TR::iadd, 2, load, delta);
+    TR::Node *store = TR::Node::createWithSymRef(is64Bit ? TR::lstore : TR::istore, 1, 1, add, counter);
+    block->getEntry()->insertAfter(TR::TreeTop::create(comp, store));
+}
+
+void OMR::MethodBuilder::insertTieredCounters()
+{
+    TR::DataType counterType = comp()->target().is64Bit() ? TR::Int64 : TR::Int32;
+    TR::SymbolReference *invocations = symRefTab()->findOrCreateCounterSymRef(const_cast<char *>("tieredInvocations"),
+        counterType, &_tieredMethod->_invocations);
+    TR::SymbolReference *backedges = symRefTab()->findOrCreateCounterSymRef(const_cast<char *>("tieredBackedges"),
+        counterType, &_tieredMethod->_backedges);
+
+    TR::Block *firstBlock = _methodSymbol->getFirstTreeTop()->getNode()->getBlock();
+
+    // Blocks are laid out in the order the builders were appended, so an
+    // edge to a block at or above its source closes a loop. Each loop header
+    // gets one bump however many backedges reach it.
+    int32_t numNodes = cfg()->getNextNodeNumber();
+    int32_t *position = (int32_t *)comp()->trMemory()->allocateHeapMemory(numNodes * sizeof(int32_t));
+    bool *counted = (bool *)comp()->trMemory()->allocateHeapMemory(numNodes * sizeof(bool));
+    for (int32_t n = 0; n < numNodes; n++) {
+        position[n] = -1;
+        counted[n] = false;
+    }
+
+    int32_t nextPosition = 0;
+    for (TR::Block *block = firstBlock; block; block = block->getNextBlock())
+        position[block->getNumber()] = nextPosition++;
+
+    for (TR::Block *block = firstBlock; block; block = block->getNextBlock()) {
+        TR::CFGEdgeList &successors = block->getSuccessors();
+        for (auto e = successors.begin(); e != successors.end(); ++e) {
+            TR::Block *target = toBlock((*e)->getTo());
+            int32_t targetPosition = position[target->getNumber()];
+            if (targetPosition < 0 || targetPosition > position[block->getNumber()] || counted[target->getNumber()])
+                continue;
+
+            counted[target->getNumber()] = true;
+            prependTieredCounterBump(comp(), target, backedges);
+        }
+    }
+
+    prependTieredCounterBump(comp(), firstBlock, invocations);
 }
 
 uint32_t OMR::MethodBuilder::countBlocks()
@@ -549,6 +644,13 @@ void OMR::MethodBuilder::DefineFunction(const char * const name, const char * co
     _functions.insert(std::make_pair(name, method));
 }
 
+void OMR::MethodBuilder::DefineAllocator(const char *name)
+{
+    FunctionMap::iterator it = _functions.find(name);
+    TR_ASSERT_FATAL(it != _functions.end(), "Function '%s' must be defined before it can be an allocator", name);
+    it->second->setIsAllocationFunction(true);
+}
+
 const char *OMR::MethodBuilder::getSymbolName(int32_t slot)
 {
     // Sometimes the code generators will manufacture a symbol reference themselves with no way
@@ -650,6 +752,14 @@ int32_t OMR::MethodBuilder::GetNextBytecodeFromWorklist()
 }
 
 int32_t OMR::MethodBuilder::Compile(void **entry)
+{
+    if (TR::TieredCompilation::isEnabled())
+        return TR::TieredCompilation::compile(static_cast<TR::MethodBuilder *>(this), entry);
+
+    return compile(entry, warm);
+}
+
+int32_t OMR::MethodBuilder::compile(void **entry, TR_Hotness hotness, TR::TieredMethod *profiledMethod)
 {
     TR::IlType **paramTypes = getParameterTypes();
     TR::DataType *methodParmTypes
@@ -667,7 +777,9 @@ int32_t OMR::MethodBuilder::Compile(void **entry)
     TR::IlGeneratorMethodDetails details(&resolvedMethod);
 
     int32_t rc = 0;
-    *entry = (void *)compileMethodFromDetails(NULL, details, warm, rc);
+    _tieredMethod = profiledMethod;
+    *entry = (void *)compileMethodFromDetails(NULL, details, hotness, rc);
+    _tieredMethod = NULL;
 
     // let TypeDictionary know to clear out sym refs used in this compilation so
     // no dangling pointers
@@ -679,6 +791,21 @@ int32_t OMR::MethodBuilder::Compile(void **entry)
     _symbols.clear();
     _connectedTrees = false;
 
+    // the rest of the per compilation state also lives in the compilation's
+    // memory, so reset it too in case this MethodBuilder is compiled again
+    _count = -1;
+    _comesBack = true;
+    _currentBlock = NULL;
+    _currentBlockNumber = -1;
+    _numBlocks = 0;
+    _blocks = NULL;
+    _blocksAllocatedUpFront = false;
+    _countBlocksWorklist = NULL;
+    _connectTreesWorklist = NULL;
+    _allBytecodeBuilders = NULL;
+    _bytecodeWorklist = NULL;
+    _bytecodeHasBeenInWorklist = NULL;
+
     return rc;
 }
 
@@ -25,6 +25,7 @@
 #include <map>
 #include <set>
 #include <fstream>
+#include "compile/CompilationTypes.hpp"
 #include "env/TRMemory.hpp"
 #include "ilgen/IlBuilder.hpp"
 #include "env/TypedAllocator.hpp"
@@ -38,6 +39,7 @@ namespace TR {
 class BytecodeBuilder;
 class ResolvedMethod;
 class SymbolReference;
+struct TieredMethod;
 class VirtualMachineState;
 } // namespace TR
 
@@ -60,6 +62,7 @@ public:
     MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachineState *vmState = NULL);
     virtual ~MethodBuilder();
 
+    virtual bool injectIL();
     virtual void setupForBuildIL();
 
     /**
@@ -142,8 +145,28 @@ public:
     void DefineFunction(const char * const name, const char * const fileName, const char * const lineNumber,
         void *entryPoint, TR::IlType *returnType, int32_t numParms, TR::IlType **parmTypes);
 
+    /**
+     * @brief Mark a function previously given to DefineFunction as an allocator
+     * @param name the name of the function
+     * An allocator takes the size in bytes of the memory it allocates as its first
+     * argument and returns new, zero-initialized memory of that size. It has no other
+     * side effects, and the memory it returns is never freed explicitly. Allocations
+     * that do not escape the method can then be removed by the optimizer.
+     */
+    void DefineAllocator(const char *name);
+
     int32_t Compile(void **entry);
 
+    /**
+     * @brief compile this method at a given level
+     * @param entry set to the entry point of the compiled body
+     * @param hotness the optimization level to compile at
+     * @param profiledMethod if not NULL, the body forwards to newer bodies and bumps the
+     *        invocation and backedge counters of this tiered method
+     * @returns the compilation's return code
+     */
+    int32_t compile(void **entry, TR_Hotness hotness, TR::TieredMethod *profiledMethod = NULL);
+
     /**
      * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
      *        mechanism for MethodBuilder subclasses to provide method lookup on demand rather than all up
@@ -272,6 +295,18 @@ protected:
      */
     const char *adjustNameForInlinedSite(const char *name);
 
+    /*
+     * @brief generates the check at the start of a profiled body that calls the tiered
+     * method's newer body once one has been compiled
+     */
+    void generateTieredForwarding();
+
+    /*
+     * @brief inserts the tiered method's invocation counter bump at the start of the
+     * method and its backedge counter bump at the start of every loop header
+     */
+    void insertTieredCounters();
+
 private:
     // We have MemoryManager as the first member of TypeDictionary, so that
     // it is the last one to get destroyed and all objects allocated using
@@ -363,6 +398,9 @@ private:
     TR::IlBuilder *_returnBuilder;
     const char *_returnSymbolName;
 
+    // the tiered method this method is being compiled for with counters, if any
+    TR::TieredMethod *_tieredMethod;
+
 private:
     static ClientAllocator _clientAllocator;
     static ImplGetter _getImpl;
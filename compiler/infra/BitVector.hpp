@@ -174,6 +174,11 @@ public:
 
     void operator=(TR_SingleBitContainer &other) { _value = other._value; }
 
+    void subtractAndUnion(TR_SingleBitContainer &kill, TR_SingleBitContainer &gen)
+    {
+        _value = (_value && !kill._value) || gen._value;
+    }
+
     void setAll(int64_t n)
     {
         TR_ASSERT(n < 2, "SingleBitContainers only contain one bit\n");
@@ -686,6 +691,75 @@ public:
             *this -= *v2._bitVector;
     }
 
+    // Replace this vector by (this & ~kill) | gen, the transfer function of a
+    // gen/kill data flow problem. Where the chunks of kill and gen overlap,
+    // both are applied in the same pass instead of one pass per operator.
+    //
+    void subtractAndUnion(TR_BitVector &kill, TR_BitVector &gen)
+    {
+        if (gen._lastChunkWithNonZero < 0) {
+            *this -= kill;
+            return;
+        }
+        if (kill._lastChunkWithNonZero < 0 || _lastChunkWithNonZero < 0) {
+            if (_lastChunkWithNonZero < 0)
+                *this = gen;
+            else
+                *this |= gen;
+            return;
+        }
+
+        // Grow the this vector if smaller than the gen vector
+        if (_numChunks < gen._numChunks)
+            setChunkSize(gen._numChunks);
+
+        int32_t low = _firstChunkWithNonZero < gen._firstChunkWithNonZero ? _firstChunkWithNonZero
+                                                                          : gen._firstChunkWithNonZero;
+        int32_t high = _lastChunkWithNonZero > gen._lastChunkWithNonZero ? _lastChunkWithNonZero
+                                                                         : gen._lastChunkWithNonZero;
+
+        // Only the chunks that are non-zero in both this vector and kill need to be killed
+        int32_t killLow = kill._firstChunkWithNonZero > _firstChunkWithNonZero ? kill._firstChunkWithNonZero
+                                                                               : _firstChunkWithNonZero;
+        int32_t killHigh = kill._lastChunkWithNonZero < _lastChunkWithNonZero ? kill._lastChunkWithNonZero
+                                                                              : _lastChunkWithNonZero;
+        int32_t genLow = gen._firstChunkWithNonZero;
+        int32_t genHigh = gen._lastChunkWithNonZero;
+
+        int32_t i;
+        if (killLow > killHigh) {
+            for (i = genLow; i <= genHigh; i++)
+                _chunks[i] |= gen._chunks[i];
+        } else {
+            int32_t bothLow = killLow > genLow ? killLow : genLow;
+            int32_t bothHigh = killHigh < genHigh ? killHigh : genHigh;
+            if (bothLow > bothHigh) {
+                // Disjoint ranges, so the two loops still touch each chunk once
+                for (i = killLow; i <= killHigh; i++)
+                    _chunks[i] &= ~kill._chunks[i];
+                for (i = genLow; i <= genHigh; i++)
+                    _chunks[i] |= gen._chunks[i];
+            } else {
+                // Below and above the common range only one of kill and gen applies
+                for (i = killLow; i < bothLow; i++)
+                    _chunks[i] &= ~kill._chunks[i];
+                for (i = genLow; i < bothLow; i++)
+                    _chunks[i] |= gen._chunks[i];
+                for (i = bothLow; i <= bothHigh; i++)
+                    _chunks[i] = (_chunks[i] & ~kill._chunks[i]) | gen._chunks[i];
+                for (i = bothHigh + 1; i <= killHigh; i++)
+                    _chunks[i] &= ~kill._chunks[i];
+                for (i = bothHigh + 1; i <= genHigh; i++)
+                    _chunks[i] |= gen._chunks[i];
+            }
+        }
+
+        resetLowAndHighChunks(low, high);
+#if BV_SANITY_CHECK
+        sanityCheck("subtractAndUnion");
+#endif
+    }
+
     // mixed type operations and conversions
     template<class BitVector> TR_BitVector &operator=(const BitVector &sparse);
     template<class BitVector> TR_BitVector &operator-=(const BitVector &sparse);
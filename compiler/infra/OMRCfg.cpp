@@ -840,8 +840,11 @@ bool OMR::CFG::removeEdge(TR::CFGEdge *edge)
 
             blocksVisited->set(from->getNumber());
 
+            // Every edge visited is removed from the lists being iterated, so
+            // start from the first remaining edge each time rather than
+            // advancing an iterator to the removed element
             TR_SuccessorIterator edgesIt(from);
-            for (TR::CFGEdge *e = edgesIt.getFirst(); e; e = edgesIt.getNext()) {
+            for (TR::CFGEdge *e = edgesIt.getFirst(); e; e = edgesIt.getFirst()) {
                 to = e->getTo();
                 _numEdges--;
 
@@ -0,0 +1,613 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/AggregateEscapeAnalysis.hpp"
+
+#include <algorithm>
+#include <limits.h>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/AutomaticSymbol.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Checklist.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/UseDefInfo.hpp"
+#include "ras/Logger.hpp"
+
+namespace {
+
+bool canBeScalarized(TR::DataType dt)
+{
+    switch (dt.getDataType()) {
+        case TR::Int8:
+        case TR::Int16:
+        case TR::Int32:
+        case TR::Int64:
+        case TR::Float:
+        case TR::Double:
+        case TR::Address:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+TR::AggregateEscapeAnalysis::AggregateEscapeAnalysis(TR::OptimizationManager *manager)
+    : TR::Optimization(manager)
+    , _candidates(NULL)
+    , _nodeInfo(NULL)
+    , _accesses(NULL)
+    , _defOwners(NULL)
+    , _untrackedSymbols(NULL)
+    , _exposedLocals(NULL)
+    , _useDefInfo(NULL)
+{}
+
+int32_t TR::AggregateEscapeAnalysis::perform()
+{
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+    TR::Region &stackRegion = comp()->trMemory()->currentStackRegion();
+
+    NodeInfo noInfo = { -1, -1, -1, 0, false, false, false };
+    TR::vector<Candidate, TR::Region &> candidates(stackRegion);
+    TR::vector<NodeInfo, TR::Region &> nodeInfo(comp()->getNodeCount(), noInfo, stackRegion);
+    TR::vector<Access, TR::Region &> accesses(stackRegion);
+    TR::vector<int32_t, TR::Region &> defOwners(stackRegion);
+    TR::vector<TR::Symbol *, TR::Region &> untrackedSymbols(stackRegion);
+    TR::vector<TR::Symbol *, TR::Region &> exposedLocals(stackRegion);
+
+    _candidates = &candidates;
+    _nodeInfo = &nodeInfo;
+    _accesses = &accesses;
+    _defOwners = &defOwners;
+    _untrackedSymbols = &untrackedSymbols;
+    _exposedLocals = &exposedLocals;
+    _useDefInfo = optimizer()->getUseDefInfo();
+
+    collectCandidates();
+
+    int32_t numTransformed = 0;
+    if (!candidates.empty()) {
+        findOccurrences(_useDefInfo);
+        checkUses();
+        checkStoredSymbols(_useDefInfo);
+        checkOldInstances();
+
+        TR::vector<Field, TR::Region &> fields(stackRegion);
+        for (int32_t c = 0; c < static_cast<int32_t>(candidates.size()); c++) {
+            Candidate &candidate = candidates[c];
+            if (candidate._escapes)
+                continue;
+
+            fields.clear();
+            if (collectFields(c, fields)) {
+                if (performTransformation(comp(), "%sReplacing the fields of %s n%un [%p] with %d temporaries\n",
+                        optDetailString(), candidate._localSymbol ? "local aggregate" : "heap allocation",
+                        candidate._node->getGlobalIndex(), candidate._node, static_cast<int32_t>(fields.size()))) {
+                    scalarReplace(c, fields);
+                    numTransformed++;
+                }
+            } else if (!candidate._localSymbol && candidate._size <= MAX_STACK_ALLOCATION_SIZE) {
+                if (performTransformation(comp(), "%sAllocating heap allocation n%un [%p] of %d bytes on the stack\n",
+                        optDetailString(), candidate._node->getGlobalIndex(), candidate._node, candidate._size)) {
+                    allocateOnStack(c);
+                    numTransformed++;
+                }
+            } else {
+                logprintf(trace(), comp()->log(), "Candidate n%un does not escape but cannot be transformed\n",
+                    candidate._node->getGlobalIndex());
+            }
+        }
+    }
+
+    if (numTransformed > 0) {
+        optimizer()->setUseDefInfo(NULL);
+        optimizer()->setValueNumberInfo(NULL);
+    }
+
+    _candidates = NULL;
+    _nodeInfo = NULL;
+    _accesses = NULL;
+    _defOwners = NULL;
+    _untrackedSymbols = NULL;
+    _exposedLocals = NULL;
+    _useDefInfo = NULL;
+
+    return numTransformed;
+}
+
+const char *TR::AggregateEscapeAnalysis::optDetailString() const throw()
+{
+    return "O^O AGGREGATE ESCAPE ANALYSIS: ";
+}
+
+bool TR::AggregateEscapeAnalysis::fieldPrecedes(const Field &a, const Field &b)
+{
+    if (a._offset != b._offset)
+        return a._offset < b._offset;
+    return a._dataType.getDataType() < b._dataType.getDataType();
+}
+
+void TR::AggregateEscapeAnalysis::collectCandidates()
+{
+    TR::NodeChecklist visited(comp());
+    int32_t treeNumber = 0;
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop(), treeNumber++)
+        collectCandidates(tt->getNode(), tt, treeNumber, visited);
+
+    for (size_t i = 0; i < _exposedLocals->size(); i++) {
+        int32_t c = findLocalCandidate((*_exposedLocals)[i]);
+        if (c >= 0)
+            escapes(c, "its symbol is referenced directly", (*_candidates)[c]._node);
+    }
+}
+
+void TR::AggregateEscapeAnalysis::collectCandidates(TR::Node *node, TR::TreeTop *tt, int32_t treeNumber,
+    TR::NodeChecklist &visited)
+{
+    NodeInfo &info = (*_nodeInfo)[node->getGlobalIndex()];
+    info._lastTreeNumber = treeNumber;
+    if (visited.contains(node))
+        return;
+    visited.add(node);
+    info._firstTreeNumber = treeNumber;
+
+    for (int32_t i = 0; i < node->getNumChildren(); i++)
+        collectCandidates(node->getChild(i), tt, treeNumber, visited);
+
+    TR::ILOpCode &op = node->getOpCode();
+    if (!op.hasSymbolReference())
+        return;
+
+    TR::Symbol *symbol = node->getSymbol();
+    if (node->getOpCodeValue() == TR::loadaddr) {
+        if (symbol->isLocalObject() && symbol->getDataType() == TR::Aggregate) {
+            int32_t c = findLocalCandidate(symbol);
+            if (c < 0) {
+                Candidate candidate = { node, symbol, NULL, -1, -1, static_cast<int32_t>(symbol->getSize()), NULL,
+                    false };
+                c = static_cast<int32_t>(_candidates->size());
+                _candidates->push_back(candidate);
+                logprintf(trace(), comp()->log(), "Candidate %d is local aggregate #%d at n%un, %d bytes\n", c,
+                    node->getSymbolReference()->getReferenceNumber(), node->getGlobalIndex(), candidate._size);
+            }
+            info._candidate = c;
+            info._offsetIsKnown = true;
+            info._isFresh = true;
+        } else if (symbol->isAutoOrParm()
+            && std::find(_untrackedSymbols->begin(), _untrackedSymbols->end(), symbol) == _untrackedSymbols->end()) {
+            _untrackedSymbols->push_back(symbol);
+        }
+    } else if (op.isLoadVarDirect() || op.isStoreDirect()) {
+        if (symbol->isLocalObject()) {
+            _exposedLocals->push_back(symbol);
+        } else if (op.isLoadVarDirect() && symbol->isAutoOrParm() && node->getUseDefIndex() == 0
+            && std::find(_untrackedSymbols->begin(), _untrackedSymbols->end(), symbol) == _untrackedSymbols->end()) {
+            _untrackedSymbols->push_back(symbol);
+        }
+    } else if (op.isCallDirect() && node->getDataType() == TR::Address && node->getNumChildren() > 0
+        && node->getFirstChild()->getOpCode().isLoadConst()) {
+        TR::ResolvedMethodSymbol *callee = symbol->getResolvedMethodSymbol();
+        if (!callee || !callee->getResolvedMethod()->isAllocationFunction())
+            return;
+
+        int64_t size = node->getFirstChild()->get64bitIntegralValue();
+        if (size <= 0 || size > INT_MAX)
+            return;
+
+        Candidate candidate = { node, NULL, tt, treeNumber, -1, static_cast<int32_t>(size), NULL, false };
+        info._candidate = static_cast<int32_t>(_candidates->size());
+        info._offsetIsKnown = true;
+        info._isFresh = true;
+        _candidates->push_back(candidate);
+        logprintf(trace(), comp()->log(), "Candidate %d is heap allocation n%un, %d bytes\n", info._candidate,
+            node->getGlobalIndex(), candidate._size);
+    }
+}
+
+int32_t TR::AggregateEscapeAnalysis::findLocalCandidate(TR::Symbol *symbol)
+{
+    for (size_t c = 0; c < _candidates->size(); c++) {
+        if ((*_candidates)[c]._localSymbol == symbol)
+            return static_cast<int32_t>(c);
+    }
+    return -1;
+}
+
+// Find the loads of locals that can only see the address of one candidate.
+// A store of a candidate's address owns its def; a load all of whose
+// reaching defs are owned by the same candidate is another occurrence of
+// that candidate, and a store of that load owns its def in turn.
+//
+void TR::AggregateEscapeAnalysis::findOccurrences(TR_UseDefInfo *useDefInfo)
+{
+    if (!useDefInfo)
+        return;
+
+    _defOwners->assign(useDefInfo->getNumDefNodes(), -1);
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (int32_t d = useDefInfo->getFirstRealDefIndex(); d <= useDefInfo->getLastDefIndex(); d++) {
+            TR::Node *def = useDefInfo->getNode(d);
+            if ((*_defOwners)[d] >= 0 || !def || !def->getOpCode().isStoreDirect())
+                continue;
+
+            NodeInfo &valueInfo = (*_nodeInfo)[def->getFirstChild()->getGlobalIndex()];
+            if (valueInfo._candidate >= 0 && !valueInfo._isDerived) {
+                (*_defOwners)[d] = valueInfo._candidate;
+                changed = true;
+            }
+        }
+
+        for (int32_t u = useDefInfo->getFirstUseIndex(); u <= useDefInfo->getLastUseIndex(); u++) {
+            TR::Node *use = useDefInfo->getNode(u);
+            if (!use || use->getReferenceCount() == 0 || !use->getOpCode().isLoadVarDirect())
+                continue;
+
+            NodeInfo &useInfo = (*_nodeInfo)[use->getGlobalIndex()];
+            if (useInfo._candidate >= 0)
+                continue;
+
+            TR_UseDefInfo::BitVector defs(comp()->allocator());
+            if (!useDefInfo->getUseDef(defs, u))
+                continue;
+
+            int32_t owner = -1;
+            TR_UseDefInfo::BitVector::Cursor cursor(defs);
+            for (cursor.SetToFirstOne(); cursor.Valid(); cursor.SetToNextOne()) {
+                int32_t d = cursor;
+                int32_t defOwner = d < useDefInfo->getFirstRealDefIndex() ? -1 : (*_defOwners)[d];
+                if (defOwner < 0 || (owner >= 0 && defOwner != owner)) {
+                    owner = -1;
+                    break;
+                }
+                owner = defOwner;
+            }
+
+            if (owner >= 0) {
+                useInfo._candidate = owner;
+                useInfo._offsetIsKnown = true;
+                changed = true;
+            }
+        }
+    }
+}
+
+void TR::AggregateEscapeAnalysis::checkUses()
+{
+    TR::NodeChecklist visited(comp());
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop())
+        checkUses(tt->getNode(), visited);
+}
+
+void TR::AggregateEscapeAnalysis::checkUses(TR::Node *node, TR::NodeChecklist &visited)
+{
+    if (visited.contains(node))
+        return;
+    visited.add(node);
+
+    for (int32_t i = 0; i < node->getNumChildren(); i++)
+        checkUses(node->getChild(i), visited);
+
+    for (int32_t i = 0; i < node->getNumChildren(); i++)
+        checkUse(node, i);
+}
+
+void TR::AggregateEscapeAnalysis::checkUse(TR::Node *parent, int32_t childIndex)
+{
+    TR::Node *child = parent->getChild(childIndex);
+    NodeInfo &childInfo = (*_nodeInfo)[child->getGlobalIndex()];
+    int32_t c = childInfo._candidate;
+    if (c < 0 || (*_candidates)[c]._escapes)
+        return;
+
+    Candidate &candidate = (*_candidates)[c];
+    TR::ILOpCode &op = parent->getOpCode();
+
+    if (parent->getOpCodeValue() == TR::treetop)
+        return;
+
+    if (op.isStoreDirect() && childIndex == 0) {
+        int32_t defIndex = parent->getUseDefIndex();
+        if (childInfo._isDerived || !_useDefInfo || !_useDefInfo->isDefIndex(defIndex)
+            || (*_defOwners)[defIndex] != c) {
+            escapes(c, "its address is stored", parent);
+            return;
+        }
+
+        if (candidate._storedSymbol && candidate._storedSymbol != parent->getSymbol()) {
+            escapes(c, "its address is stored to more than one local", parent);
+            return;
+        }
+        candidate._storedSymbol = parent->getSymbol();
+
+        int32_t treeNumber = (*_nodeInfo)[parent->getGlobalIndex()]._firstTreeNumber;
+        if (child == candidate._node
+            && (candidate._firstStoreTreeNumber < 0 || treeNumber < candidate._firstStoreTreeNumber))
+            candidate._firstStoreTreeNumber = treeNumber;
+        return;
+    }
+
+    if ((op.isLoadIndirect() || op.isStoreIndirect()) && childIndex == 0) {
+        TR::SymbolReference *symRef = parent->getSymbolReference();
+        if (op.isWrtBar() || !symRef->getSymbol()->isShadow() || symRef->isUnresolved()) {
+            escapes(c, "it is accessed through an unsupported symbol", parent);
+            return;
+        }
+
+        Access access = { parent, c, symRef->getOffset() + childInfo._offset, childInfo._offsetIsKnown };
+        if (access._offsetIsKnown && (access._offset < 0 || access._offset + parent->getSize() > candidate._size)) {
+            escapes(c, "it is accessed out of bounds", parent);
+            return;
+        }
+        _accesses->push_back(access);
+        return;
+    }
+
+    if ((parent->getOpCodeValue() == TR::aladd || parent->getOpCodeValue() == TR::aiadd) && childIndex == 0) {
+        NodeInfo &parentInfo = (*_nodeInfo)[parent->getGlobalIndex()];
+        TR::Node *offsetNode = parent->getSecondChild();
+        parentInfo._candidate = c;
+        parentInfo._isDerived = true;
+        parentInfo._isFresh = childInfo._isFresh;
+        parentInfo._offsetIsKnown = childInfo._offsetIsKnown && offsetNode->getOpCode().isLoadConst();
+        parentInfo._offset = parentInfo._offsetIsKnown ? childInfo._offset + offsetNode->get64bitIntegralValue() : 0;
+        return;
+    }
+
+    escapes(c, "its address is used", parent);
+}
+
+// A local that holds a candidate's address must hold nothing else: every use
+// of a def owned by the candidate must itself be an occurrence, and every
+// load of the local must be visible to use-def info.
+//
+void TR::AggregateEscapeAnalysis::checkStoredSymbols(TR_UseDefInfo *useDefInfo)
+{
+    for (size_t c = 0; c < _candidates->size(); c++) {
+        Candidate &candidate = (*_candidates)[c];
+        if (!candidate._escapes && candidate._storedSymbol
+            && std::find(_untrackedSymbols->begin(), _untrackedSymbols->end(), candidate._storedSymbol)
+                != _untrackedSymbols->end())
+            escapes(static_cast<int32_t>(c), "it is stored to a local that is not tracked", candidate._node);
+    }
+
+    if (!useDefInfo)
+        return;
+
+    for (int32_t u = useDefInfo->getFirstUseIndex(); u <= useDefInfo->getLastUseIndex(); u++) {
+        TR::Node *use = useDefInfo->getNode(u);
+        if (!use || use->getReferenceCount() == 0 || !use->getOpCode().isLoadVarDirect())
+            continue;
+
+        NodeInfo &useInfo = (*_nodeInfo)[use->getGlobalIndex()];
+        if (useInfo._candidate >= 0) {
+            Candidate &candidate = (*_candidates)[useInfo._candidate];
+            if (!candidate._escapes && use->getSymbol() != candidate._storedSymbol)
+                escapes(useInfo._candidate, "it is loaded from an aliased local", use);
+            continue;
+        }
+
+        TR_UseDefInfo::BitVector defs(comp()->allocator());
+        if (!useDefInfo->getUseDef(defs, u))
+            continue;
+
+        TR_UseDefInfo::BitVector::Cursor cursor(defs);
+        for (cursor.SetToFirstOne(); cursor.Valid(); cursor.SetToNextOne()) {
+            int32_t d = cursor;
+            if (d >= useDefInfo->getFirstRealDefIndex() && (*_defOwners)[d] >= 0)
+                escapes((*_defOwners)[d], "a load of its local may see another value", use);
+        }
+    }
+}
+
+// Every execution of an allocation call creates a new instance, but the
+// transformations give all instances created by one call the same storage.
+// That is only correct if nothing refers to an older instance once the call
+// has executed: no reference to the local it is stored to may be evaluated
+// before the call and used after it, or evaluated between the call and the
+// store that replaces the local's value.
+//
+void TR::AggregateEscapeAnalysis::checkOldInstances()
+{
+    TR::TreeTop *tt = comp()->getStartTree();
+    int32_t treeNumber = 0;
+    for (size_t c = 0; c < _candidates->size(); c++) {
+        Candidate &candidate = (*_candidates)[c];
+        if (candidate._escapes || candidate._localSymbol || candidate._firstStoreTreeNumber < 0)
+            continue;
+
+        // The store must be in the same block as the call
+        //
+        for (; treeNumber < candidate._anchorTreeNumber; treeNumber++)
+            tt = tt->getNextTreeTop();
+        TR::TreeTop *storeTree = tt;
+        for (int32_t n = treeNumber; n < candidate._firstStoreTreeNumber; n++) {
+            storeTree = storeTree->getNextTreeTop();
+            if (storeTree->getNode()->getOpCodeValue() == TR::BBEnd) {
+                escapes(static_cast<int32_t>(c), "its address is stored in another block", candidate._node);
+                break;
+            }
+        }
+    }
+
+    for (size_t n = 0; n < _nodeInfo->size(); n++) {
+        NodeInfo &info = (*_nodeInfo)[n];
+        if (info._candidate < 0 || info._isFresh)
+            continue;
+
+        Candidate &candidate = (*_candidates)[info._candidate];
+        if (candidate._escapes || candidate._localSymbol)
+            continue;
+
+        int32_t windowEnd = candidate._firstStoreTreeNumber >= 0 ? candidate._firstStoreTreeNumber
+                                                                 : candidate._anchorTreeNumber;
+        if (info._firstTreeNumber >= 0 && info._firstTreeNumber < windowEnd
+            && info._lastTreeNumber >= candidate._anchorTreeNumber)
+            escapes(info._candidate, "an older instance may be live at the allocation", candidate._node);
+    }
+}
+
+void TR::AggregateEscapeAnalysis::escapes(int32_t candidate, const char *reason, TR::Node *node)
+{
+    Candidate &c = (*_candidates)[candidate];
+    if (c._escapes)
+        return;
+    c._escapes = true;
+    logprintf(trace(), comp()->log(), "Candidate %d (n%un) escapes: %s at n%un\n", candidate,
+        c._node->getGlobalIndex(), reason, node->getGlobalIndex());
+}
+
+// The fields of a candidate are the distinct (offset, type) pairs it is
+// accessed with. They can be replaced by temporaries if all offsets are known
+// and no two fields overlap.
+//
+bool TR::AggregateEscapeAnalysis::collectFields(int32_t candidate, TR::vector<Field, TR::Region &> &fields)
+{
+    for (size_t a = 0; a < _accesses->size(); a++) {
+        Access &access = (*_accesses)[a];
+        if (access._candidate != candidate)
+            continue;
+
+        TR::DataType dt = access._node->getDataType();
+        if (!access._offsetIsKnown || !canBeScalarized(dt))
+            return false;
+
+        Field field = { access._offset, dt, NULL };
+        fields.push_back(field);
+    }
+
+    std::sort(fields.begin(), fields.end(), fieldPrecedes);
+    size_t numFields = 0;
+    for (size_t f = 0; f < fields.size(); f++) {
+        if (numFields > 0) {
+            Field &previous = fields[numFields - 1];
+            if (previous._offset == fields[f]._offset && previous._dataType == fields[f]._dataType)
+                continue;
+            if (fields[f]._offset < previous._offset + TR::DataType::getSize(previous._dataType))
+                return false;
+        }
+        fields[numFields++] = fields[f];
+    }
+    fields.resize(numFields);
+    return true;
+}
+
+void TR::AggregateEscapeAnalysis::scalarReplace(int32_t c, TR::vector<Field, TR::Region &> &fields)
+{
+    Candidate &candidate = (*_candidates)[c];
+    TR::SymbolReferenceTable *symRefTab = comp()->getSymRefTab();
+
+    for (size_t f = 0; f < fields.size(); f++) {
+        fields[f]._temp = symRefTab->createTemporary(comp()->getMethodSymbol(), fields[f]._dataType);
+        fields[f]._temp->getSymbol()->setNotCollected();
+        logprintf(trace(), comp()->log(), "   field at offset %lld is temp #%d\n", (long long)fields[f]._offset,
+            fields[f]._temp->getReferenceNumber());
+    }
+
+    for (size_t a = 0; a < _accesses->size(); a++) {
+        Access &access = (*_accesses)[a];
+        if (access._candidate != c)
+            continue;
+
+        TR::Node *node = access._node;
+        TR::DataType dt = node->getDataType();
+        Field key = { access._offset, dt, NULL };
+        TR::SymbolReference *temp = std::lower_bound(fields.begin(), fields.end(), key, fieldPrecedes)->_temp;
+
+        node->getFirstChild()->recursivelyDecReferenceCount();
+        if (node->getOpCode().isStore()) {
+            node->setChild(0, node->getSecondChild());
+            node->setNumChildren(1);
+            TR::Node::recreate(node, comp()->il.opCodeForDirectStore(dt));
+        } else {
+            node->setNumChildren(0);
+            TR::Node::recreate(node, comp()->il.opCodeForDirectLoad(dt));
+        }
+        node->setSymbolReference(temp);
+    }
+
+    if (candidate._localSymbol)
+        return;
+
+    // The memory returned by an allocation function is zero-initialized
+    //
+    TR::Node *call = candidate._node;
+    for (size_t f = 0; f < fields.size(); f++) {
+        TR::Node *store
+            = TR::Node::createStore(fields[f]._temp, TR::Node::createConstZeroValue(call, fields[f]._dataType));
+        candidate._anchorTree->insertBefore(TR::TreeTop::create(comp(), store));
+    }
+
+    call->removeAllChildren();
+    TR::Node::recreate(call, TR::aconst);
+    call->setFlags(0);
+    call->setAddress(0);
+}
+
+void TR::AggregateEscapeAnalysis::allocateOnStack(int32_t c)
+{
+    Candidate &candidate = (*_candidates)[c];
+    TR::SymbolReferenceTable *symRefTab = comp()->getSymRefTab();
+    TR::SymbolReference *localSymRef
+        = symRefTab->createLocalPrimArray(candidate._size, comp()->getMethodSymbol(), 8 /* byte */);
+    localSymRef->setStackAllocatedArrayAccess();
+
+    TR::Node *call = candidate._node;
+    call->removeAllChildren();
+    TR::Node::recreateWithSymRef(call, TR::loadaddr, localSymRef);
+    call->setFlags(0);
+
+    // Zero the local every time the allocation is executed. The generic int
+    // shadows used for this must alias the shadows the candidate is accessed
+    // through, whatever they are.
+    //
+    symRefTab->aliasBuilder.setConservativeGenericIntShadowAliasing(true);
+    for (int32_t offset = 0; offset < candidate._size;) {
+        int32_t width = 8;
+        while (width > 1 && (offset % width != 0 || offset + width > candidate._size))
+            width /= 2;
+
+        TR::DataType dt = width == 8 ? TR::Int64 : width == 4 ? TR::Int32 : width == 2 ? TR::Int16 : TR::Int8;
+        TR::Node *address = TR::Node::createWithSymRef(call, TR::loadaddr, 0, localSymRef);
+        TR::Node *store = TR::Node::createWithSymRef(comp()->il.opCodeForIndirectStore(dt), 2, address,
+            TR::Node::createConstZeroValue(call, dt), 0, symRefTab->findOrCreateGenericIntShadowSymbolReference(offset));
+        candidate._anchorTree->insertBefore(TR::TreeTop::create(comp(), store));
+        offset += width;
+    }
+}
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef AGGREGATEESCAPEANALYSIS_INCL
+#define AGGREGATEESCAPEANALYSIS_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR {
+class NodeChecklist;
+class Node;
+class Symbol;
+class SymbolReference;
+class TreeTop;
+} // namespace TR
+class TR_UseDefInfo;
+
+namespace TR {
+
+// Escape analysis for aggregates that are not objects of a managed heap.
+//
+// Two kinds of allocation are candidates:
+//
+//  - a loadaddr of a local aggregate (an automatic symbol created by
+//    createLocalPrimArray, as JitBuilder's CreateLocalStruct and
+//    CreateLocalArray do), and
+//
+//  - a direct call to a function whose TR_ResolvedMethod reports
+//    isAllocationFunction(), with a constant size as its first argument.
+//
+// A candidate does not escape if every use of its address is a load or store
+// through it (possibly after adding an offset), or a store of the address to
+// a single local whose loads are all reached only by such stores. Use-def
+// information is what links the loads of that local back to the allocation.
+//
+// When every access is at a known offset and the fields do not overlap, each
+// field is replaced by a temporary, and a heap allocation is removed. A heap
+// allocation whose fields cannot be replaced is moved to a local aggregate of
+// the same size instead, provided it is small. Both transformations are
+// proven correct for every path through the method, so no runtime check or
+// fallback path is generated.
+//
+// A heap allocation inside a loop creates a new instance in every iteration.
+// Replacing all of them with one set of temporaries (or one stack slot) is
+// only correct if no reference to an old instance is used after the next
+// allocation, which the analysis checks as well.
+
+class AggregateEscapeAnalysis : public TR::Optimization {
+public:
+    AggregateEscapeAnalysis(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) AggregateEscapeAnalysis(manager);
+    }
+
+    virtual int32_t perform();
+    virtual const char *optDetailString() const throw();
+
+    // Largest heap allocation, in bytes, that may be moved to the stack
+    static const int32_t MAX_STACK_ALLOCATION_SIZE = 256;
+
+private:
+    struct Candidate {
+        TR::Node *_node; // the loadaddr or the call to the allocation function
+        TR::Symbol *_localSymbol; // the local aggregate, or NULL for a heap allocation
+        TR::TreeTop *_anchorTree; // first tree that references the call
+        int32_t _anchorTreeNumber;
+        int32_t _firstStoreTreeNumber; // first tree that stores the call itself to a local
+        int32_t _size;
+        TR::Symbol *_storedSymbol; // the local the address is stored to
+        bool _escapes;
+    };
+
+    // What the analysis knows about a node that holds the address of a
+    // candidate, or an address derived from it
+    struct NodeInfo {
+        int32_t _candidate; // -1 if the node is not related to any candidate
+        int32_t _firstTreeNumber; // tree where the node is evaluated
+        int32_t _lastTreeNumber; // last tree that references the node
+        int64_t _offset; // from the start of the candidate, if known
+        bool _isDerived; // the node adds an offset to the candidate address
+        bool _offsetIsKnown;
+        bool _isFresh; // the node refers to the instance created in this tree's block by the call
+    };
+
+    struct Access {
+        TR::Node *_node; // the indirect load or store
+        int32_t _candidate;
+        int64_t _offset;
+        bool _offsetIsKnown;
+    };
+
+    struct Field {
+        int64_t _offset;
+        TR::DataType _dataType;
+        TR::SymbolReference *_temp;
+    };
+
+    static bool fieldPrecedes(const Field &a, const Field &b);
+
+    void collectCandidates();
+    void collectCandidates(TR::Node *node, TR::TreeTop *tt, int32_t treeNumber, TR::NodeChecklist &visited);
+    int32_t findLocalCandidate(TR::Symbol *symbol);
+    void findOccurrences(TR_UseDefInfo *useDefInfo);
+    void checkUses();
+    void checkUses(TR::Node *node, TR::NodeChecklist &visited);
+    void checkUse(TR::Node *parent, int32_t childIndex);
+    void checkStoredSymbols(TR_UseDefInfo *useDefInfo);
+    void checkOldInstances();
+    void escapes(int32_t candidate, const char *reason, TR::Node *node);
+
+    bool collectFields(int32_t candidate, TR::vector<Field, TR::Region &> &fields);
+    void scalarReplace(int32_t candidate, TR::vector<Field, TR::Region &> &fields);
+    void allocateOnStack(int32_t candidate);
+
+    TR::vector<Candidate, TR::Region &> *_candidates;
+    TR::vector<NodeInfo, TR::Region &> *_nodeInfo;
+    TR::vector<Access, TR::Region &> *_accesses;
+
+    // Owning candidate of each def in the use-def info, or -1
+    TR::vector<int32_t, TR::Region &> *_defOwners;
+
+    // Locals that cannot hold a candidate address: their address is taken, or
+    // some of their loads are not tracked by use-def info
+    TR::vector<TR::Symbol *, TR::Region &> *_untrackedSymbols;
+
+    // Local aggregates that are referenced by something other than a loadaddr
+    TR::vector<TR::Symbol *, TR::Region &> *_exposedLocals;
+
+    TR_UseDefInfo *_useDefInfo;
+};
+
+} // namespace TR
+
+#endif
@@ -21,6 +21,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <utility>
 #include "compile/Compilation.hpp"
 #include "env/TRMemory.hpp"
 #include "il/Block.hpp"
@@ -28,10 +29,12 @@
 #include "il/TreeTop.hpp"
 #include "il/TreeTop_inlines.hpp"
 #include "infra/Assert.hpp"
+#include "infra/Cfg.hpp"
 #include "infra/Link.hpp"
 #include "infra/List.hpp"
 #include "infra/CfgEdge.hpp"
 #include "infra/CfgNode.hpp"
+#include "infra/vector.hpp"
 #include "optimizer/Structure.hpp"
 #include "optimizer/DataFlowAnalysis.hpp"
 #include "ras/Logger.hpp"
@@ -1373,8 +1376,8 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeBlockStructure(TR_BlockStruct
 
     if (blockNum != 0) {
         if (this->_regularGenSetInfo) {
-            if (this->_regularKillSetInfo[blockNum])
-                *this->_regularInfo -= *this->_regularKillSetInfo[blockNum];
+            this->applyGenAndKill(this->_regularInfo, this->_regularKillSetInfo[blockNum],
+                this->_regularGenSetInfo[blockNum]);
 
             if (traceBBVA()) {
                 dumpOptDetails(this->comp(), "Normal info for %d : ", blockNum);
@@ -1382,19 +1385,8 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeBlockStructure(TR_BlockStruct
                 dumpOptDetails(this->comp(), "\n");
             }
 
-            if (this->_regularGenSetInfo[blockNum])
-                *this->_regularInfo |= *this->_regularGenSetInfo[blockNum];
-
-            if (traceBBVA()) {
-                dumpOptDetails(this->comp(), "Normal info for %d : ", blockNum);
-                this->_regularInfo->print(log, this->comp());
-                dumpOptDetails(this->comp(), "\n");
-            }
-
-            if (this->_exceptionKillSetInfo[blockNum])
-                *this->_exceptionInfo -= *this->_exceptionKillSetInfo[blockNum];
-            if (this->_exceptionGenSetInfo[blockNum])
-                *this->_exceptionInfo |= *this->_exceptionGenSetInfo[blockNum];
+            this->applyGenAndKill(this->_exceptionInfo, this->_exceptionKillSetInfo[blockNum],
+                this->_exceptionGenSetInfo[blockNum]);
             compose(this->_regularInfo, this->_exceptionInfo);
 
             if (traceBBVA()) {
@@ -1462,6 +1454,143 @@ void TR_BackwardDFSetAnalysis<Container *>::analyzeTreeTopsInBlockStructure(TR_B
     }
 }
 
+// Solve the block level equations directly. Blocks are visited in a postorder
+// of the CFG so that most blocks are analyzed after their successors, and only
+// the predecessors of blocks whose in set changed are analyzed again. Unlike
+// the structural analysis this computes no information for regions, so it can
+// only be used by analyses whose clients just read _blockAnalysisInfo.
+//
+template<class Container> void TR_BackwardDFSetAnalysis<Container *>::solveWithWorklist()
+{
+    LexicalTimer tlex("backwardDFSetAnalysis_worklist", this->comp()->phaseTimer());
+
+    OMR::Logger *log = this->comp()->log();
+    TR::Region &stackRegion = this->comp()->trMemory()->currentStackRegion();
+    TR::CFG *cfg = this->_cfg;
+    int32_t numberOfNodes = this->_numberOfNodes;
+
+    // Postorder of a depth first walk from the entry; unreachable blocks go last
+    //
+    TR::vector<TR::Block *, TR::Region &> order(stackRegion);
+    order.reserve(numberOfNodes);
+    TR::vector<std::pair<TR::CFGNode *, bool>, TR::Region &> stack(stackRegion);
+    TR_BitVector visited(numberOfNodes, stackRegion);
+    stack.push_back(std::make_pair(cfg->getStart(), false));
+    while (!stack.empty()) {
+        TR::CFGNode *node = stack.back().first;
+        bool successorsDone = stack.back().second;
+        stack.pop_back();
+        if (successorsDone) {
+            order.push_back(node->asBlock());
+            continue;
+        }
+        if (visited.isSet(node->getNumber()))
+            continue;
+
+        visited.set(node->getNumber());
+        stack.push_back(std::make_pair(node, true));
+        TR_SuccessorIterator successors(node);
+        for (TR::CFGEdge *edge = successors.getFirst(); edge; edge = successors.getNext()) {
+            if (!visited.isSet(edge->getTo()->getNumber()))
+                stack.push_back(std::make_pair(edge->getTo(), false));
+        }
+    }
+
+    for (TR::CFGNode *node = cfg->getFirstNode(); node; node = node->getNext()) {
+        if (!visited.isSet(node->getNumber()))
+            order.push_back(node->asBlock());
+    }
+
+    int32_t numberOfBlocks = static_cast<int32_t>(order.size());
+    TR::vector<int32_t, TR::Region &> position(numberOfNodes, -1, stackRegion);
+    for (int32_t i = 0; i < numberOfBlocks; i++) {
+        int32_t blockNum = order[i]->getNumber();
+        position[blockNum] = i;
+        if (this->_blockAnalysisInfo[blockNum])
+            initializeInfo(this->_blockAnalysisInfo[blockNum]);
+    }
+
+    // Blocks still to be analyzed, by position
+    //
+    TR_BitVector pending(numberOfBlocks, stackRegion);
+    pending.setAll(numberOfBlocks);
+
+    int32_t numPasses = 0;
+    int32_t numBlocksAnalyzed = 0;
+    while (!pending.isEmpty()) {
+        numPasses++;
+        for (int32_t i = 0; i < numberOfBlocks; i++) {
+            if (!pending.isSet(i))
+                continue;
+
+            pending.reset(i);
+            if (((++numBlocksAnalyzed & 0x3f) == 0)
+                && this->comp()->compilationShouldBeInterrupted(BBVA_ANALYZE_CONTEXT)) {
+                TR::Compilation *comp = this->comp();
+                comp->failCompilation<TR::CompilationInterrupted>("interrupted in backward bit vector analysis");
+            }
+
+            TR::Block *block = order[i];
+            int32_t blockNum = block->getNumber();
+            if (blockNum == 0)
+                continue;
+
+            initializeInfo(this->_regularInfo);
+            initializeInfo(this->_exceptionInfo);
+
+            if (block == cfg->getEnd()) {
+                this->copyFromInto(_originalOutSetInfo[blockNum], this->_regularInfo);
+                this->copyFromInto(_originalOutSetInfo[blockNum], this->_exceptionInfo);
+            } else {
+                for (auto succ = block->getSuccessors().begin(); succ != block->getSuccessors().end(); ++succ) {
+                    Container *succInfo = this->_blockAnalysisInfo[(*succ)->getTo()->getNumber()];
+                    if (succInfo)
+                        compose(this->_regularInfo, succInfo);
+                }
+
+                for (auto succ = block->getExceptionSuccessors().begin();
+                     succ != block->getExceptionSuccessors().end(); ++succ) {
+                    Container *succInfo = this->_blockAnalysisInfo[(*succ)->getTo()->getNumber()];
+                    if (succInfo)
+                        compose(this->_exceptionInfo, succInfo);
+                }
+            }
+
+            this->applyGenAndKill(this->_regularInfo, this->_regularKillSetInfo[blockNum],
+                this->_regularGenSetInfo[blockNum]);
+            this->applyGenAndKill(this->_exceptionInfo, this->_exceptionKillSetInfo[blockNum],
+                this->_exceptionGenSetInfo[blockNum]);
+            compose(this->_regularInfo, this->_exceptionInfo);
+
+            Container *inSetInfo = this->_blockAnalysisInfo[blockNum];
+            if (!inSetInfo) {
+                this->allocateBlockInfoContainer(&this->_blockAnalysisInfo[blockNum], this->_regularInfo);
+                inSetInfo = this->_blockAnalysisInfo[blockNum];
+            } else if (*inSetInfo == *this->_regularInfo) {
+                continue;
+            }
+
+            this->copyFromInto(this->_regularInfo, inSetInfo);
+
+            TR_PredecessorIterator predecessors(block);
+            for (TR::CFGEdge *edge = predecessors.getFirst(); edge; edge = predecessors.getNext())
+                pending.set(position[edge->getFrom()->getNumber()]);
+        }
+    }
+
+    if (traceBBVA()) {
+        log->printf("\nWorklist analysis converged after %d passes and %d block visits\n", numPasses,
+            numBlocksAnalyzed);
+        for (int32_t i = 1; i < numberOfNodes; i++) {
+            if (this->_blockAnalysisInfo[i]) {
+                log->printf("In Set Info for Block numbered %d : ", i);
+                this->_blockAnalysisInfo[i]->print(log, this->comp());
+                log->println();
+            }
+        }
+    }
+}
+
 template<class Container> void TR_BackwardDFSetAnalysis<Container *>::compose(Container *, Container *) {}
 
 template<class Container> TR_DataFlowAnalysis::Kind TR_BackwardDFSetAnalysis<Container *>::getKind()
@@ -21,6 +21,9 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
 #include "optimizer/DataFlowAnalysis.hpp"
 
 class TR_BitVector;
@@ -71,6 +74,14 @@ template<class Container> Container *TR_BackwardUnionDFSetAnalysis<Container *>:
     return result;
 }
 
+// Starting from empty in sets, the worklist finds the same least fixed point
+// as the structural analysis
+//
+template<class Container> bool TR_BackwardUnionDFSetAnalysis<Container *>::canSolveWithWorklist()
+{
+    return this->supportsGenAndKillSets() && !this->comp()->getOption(TR_DisableWorklistBVA);
+}
+
 template<class Container> TR_DataFlowAnalysis::Kind TR_BackwardUnionDFSetAnalysis<Container *>::getKind()
 {
     return TR_DataFlowAnalysis::BackwardUnionDFSetAnalysis;
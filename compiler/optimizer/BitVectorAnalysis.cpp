@@ -69,7 +69,10 @@ bool TR_BasicDFSetAnalysis<Container *>::performAnalysis(TR_Structure *rootStruc
     initializeDFSetAnalysis();
     if (!postInitializationProcessing())
         return false;
-    doAnalysis(rootStructure, checkForChanges);
+    if (canSolveWithWorklist())
+        solveWithWorklist();
+    else
+        doAnalysis(rootStructure, checkForChanges);
     return true;
 }
 
@@ -153,7 +156,7 @@ template<class Container> void TR_BasicDFSetAnalysis<Container *>::initializeBas
 
         initializeGenAndKillSetInfo();
 
-        if (!_hasImproperRegion) {
+        if (!_hasImproperRegion && !canSolveWithWorklist()) {
             initializeGenAndKillSetInfoForStructures();
             if (traceBVA())
                 dumpOptDetails(comp(),
@@ -1348,14 +1351,10 @@ bool TR_ForwardDFSetAnalysis<Container *>::analyzeBlockStructure(TR_BlockStructu
         this->copyFromInto(_currentInSetInfo, this->_regularInfo);
         this->copyFromInto(_currentInSetInfo, this->_exceptionInfo);
         if (this->_regularGenSetInfo) {
-            if (this->_regularKillSetInfo[blockNum])
-                *this->_regularInfo -= *this->_regularKillSetInfo[blockNum];
-            if (this->_regularGenSetInfo[blockNum])
-                *this->_regularInfo |= *this->_regularGenSetInfo[blockNum];
-            if (this->_exceptionKillSetInfo[blockNum])
-                *this->_exceptionInfo -= *this->_exceptionKillSetInfo[blockNum];
-            if (this->_exceptionGenSetInfo[blockNum])
-                *this->_exceptionInfo |= *this->_exceptionGenSetInfo[blockNum];
+            this->applyGenAndKill(this->_regularInfo, this->_regularKillSetInfo[blockNum],
+                this->_regularGenSetInfo[blockNum]);
+            this->applyGenAndKill(this->_exceptionInfo, this->_exceptionKillSetInfo[blockNum],
+                this->_exceptionGenSetInfo[blockNum]);
             this->copyFromInto(analysisInfo->_inSetInfo, this->_blockAnalysisInfo[blockStructure->getNumber()]);
         } else {
             analyzeTreeTopsInBlockStructure(blockStructure);
@@ -305,6 +305,23 @@ public:
         return rootStructure->doDataFlowAnalysis(this, checkForChanges);
     }
 
+    // Analyses whose result only depends on the block level gen and kill sets
+    // can solve the block equations with a worklist instead of by structure
+    virtual bool canSolveWithWorklist() { return false; }
+
+    virtual void solveWithWorklist() {}
+
+    // info = (info - kill) | gen, where either set may be missing
+    void applyGenAndKill(Container *info, Container *kill, Container *gen)
+    {
+        if (kill && gen)
+            info->subtractAndUnion(*kill, *gen);
+        else if (kill)
+            *info -= *kill;
+        else if (gen)
+            *info |= *gen;
+    }
+
     virtual void initializeDFSetAnalysis() = 0;
 
     class TR_ContainerNodeNumberPair : public TR_Link<TR_ContainerNodeNumberPair> {
@@ -574,6 +591,8 @@ public:
     virtual void initializeGenAndKillSetInfoForBlock(TR_BlockStructure *);
     virtual bool canGenAndKillForStructure(TR_Structure *);
 
+    virtual void solveWithWorklist();
+
     Container **_currentOutSetInfo;
     Container **_originalOutSetInfo;
     bool _areInsideRegion;
@@ -619,6 +638,8 @@ public:
 
     virtual TR_DataFlowAnalysis::Kind getKind();
 
+    virtual bool canSolveWithWorklist();
+
     virtual void compose(Container *, Container *);
     virtual void inverseCompose(Container *, Container *);
     virtual void initializeOutSetInfo();
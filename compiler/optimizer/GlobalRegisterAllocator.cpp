@@ -460,10 +460,18 @@ int32_t TR_GlobalRegisterAllocator::perform()
         TR_BitVector splitSymRefs(_origSymRefCount, trMemory(), stackAlloc);
         TR_BitVector nonSplittingCopyStored(_origSymRefCount, trMemory(), stackAlloc);
 
+        // Methods too large for the full assignment still get the cheaper linear scan one
+        //
+        bool useLinearScan = comp()->getOption(TR_EnableLinearScanGRA)
+            || (!canAffordAssignment && !comp()->getOption(TR_DisableLinearScanGRA));
+        _candidates->setUseLinearScan(useLinearScan);
+        if (useLinearScan)
+            logprintf(trace(), log, "Using linear scan assignment of global registers\n");
+
         //
         // Assign registers to candidates
         //
-        if (canAffordAssignment) {
+        if (canAffordAssignment || useLinearScan) {
             globalFPAssignmentDone
                 = _candidates->assign(cfgBlocks, numberOfBlocks, _firstGlobalRegisterNumber, _lastGlobalRegisterNumber);
 
@@ -1565,7 +1565,9 @@ int32_t TR_HoistBlocks::process(TR::TreeTop *startTree, TR::TreeTop *endTree)
                                 cfg->addExceptionEdge(splitBlock, succBlock);
                             }
 
-                            int32_t splitFrequency = (*nextEdge)->getFrequency();
+                            // splitEdge removed the edge from the predecessor list, so
+                            // nextEdge no longer refers to it
+                            int32_t splitFrequency = current->getFrequency();
                             if (splitFrequency < 0)
                                 splitFrequency = block->getFrequency();
                             // dumpOptDetails(comp(), "Split block_%d has freq %d\n", splitBlock->getNumber(),
@@ -7630,6 +7632,11 @@ static bool coldBlock(TR::Block *block, TR::Compilation *comp)
     return retValue;
 }
 
+bool TR_ColdBlockOutlining::isOutliningCandidate(TR::Block *block, TR::Compilation *comp)
+{
+    return coldBlock(block, comp);
+}
+
 static uint32_t numBlocksSoFar = 0;
 
 void TR_ColdBlockOutlining::reorderColdBlocks()
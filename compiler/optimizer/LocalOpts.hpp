@@ -790,6 +790,12 @@ public:
     virtual int32_t perform();
     virtual const char *optDetailString() const throw();
 
+    /**
+     * \brief Returns true if \p block would be moved to the end of the method by
+     *        cold block outlining
+     */
+    static bool isOutliningCandidate(TR::Block *block, TR::Compilation *comp);
+
 private:
     void reorderColdBlocks();
 };
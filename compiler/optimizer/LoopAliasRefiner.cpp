@@ -0,0 +1,515 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/LoopAliasRefiner.hpp"
+
+#include <stdint.h>
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/CompilerEnv.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/List.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Structure.hpp"
+#include "ras/Logger.hpp"
+
+namespace {
+// Limits on the accesses considered, which keep both the number of versioning
+// tests and the magnitude of every intermediate value in them small
+const size_t MAX_ACCESSES = 64;
+const size_t MAX_BASES = 8;
+const int64_t MAX_SCALE = (int64_t)1 << 20;
+const int64_t MAX_DISPLACEMENT = (int64_t)1 << 40;
+
+bool isIntLoad(TR::Node *node)
+{
+    return node->getOpCodeValue() == TR::iload && node->getSymbol()->isAutoOrParm();
+}
+} // namespace
+
+TR_LoopAliasRefiner::TR_LoopAliasRefiner(TR::OptimizationManager *manager)
+    : TR_LoopVersioner(manager, false, true)
+    , _candidatesLoop(NULL)
+    , _accesses(NULL)
+    , _bases(NULL)
+    , _hasUnsupportedAccess(false)
+    , _refineCurrentLoop(false)
+    , _inductionVariable(NULL)
+    , _step(0)
+    , _increasing(true)
+    , _inclusiveLimit(false)
+    , _lowestAdjustment(0)
+    , _highestAdjustment(0)
+{}
+
+const char *TR_LoopAliasRefiner::optDetailString() const throw() { return "O^O LOOP ALIAS REFINER: "; }
+
+void TR_LoopAliasRefiner::initAdditionalDataStructures()
+{
+    _candidatesLoop = NULL;
+    _accesses = NULL;
+    _bases = NULL;
+    _refineCurrentLoop = false;
+}
+
+void TR_LoopAliasRefiner::collectArrayAliasCandidates(TR::Node *node, vcount_t visitCount)
+{
+    if (_candidatesLoop != _currentNaturalLoop) {
+        _candidatesLoop = _currentNaturalLoop;
+        _accesses = new (_curLoop->_memRegion) TR::vector<ArrayAccess, TR::Region &>(_curLoop->_memRegion);
+        _bases = new (_curLoop->_memRegion) TR::vector<ArrayBase, TR::Region &>(_curLoop->_memRegion);
+        _hasUnsupportedAccess = false;
+    }
+
+    if (_hasUnsupportedAccess)
+        return;
+
+    // The same node is seen once for every tree that references it
+    for (size_t i = 0; i < _accesses->size(); i++) {
+        if ((*_accesses)[i]._node == node)
+            return;
+    }
+
+    TR::ILOpCode &op = node->getOpCode();
+    if (!(op.isLoadIndirect() || op.isStoreIndirect()) || !node->getSymbol()->isArrayShadowSymbol()
+        || _accesses->size() == MAX_ACCESSES) {
+        _hasUnsupportedAccess = true;
+        return;
+    }
+
+    TR::Node *address = node->getFirstChild();
+    if (address->getOpCodeValue() != TR::aladd || address->getFirstChild()->getOpCodeValue() != TR::aload
+        || !address->getFirstChild()->getSymbol()->isAutoOrParm()) {
+        _hasUnsupportedAccess = true;
+        return;
+    }
+
+    ArrayAccess access;
+    access._node = node;
+    access._base = address->getFirstChild()->getSymbolReference();
+    if (!decomposeOffset(address->getSecondChild(), access._offset)) {
+        _hasUnsupportedAccess = true;
+        return;
+    }
+
+    _accesses->push_back(access);
+}
+
+bool TR_LoopAliasRefiner::decomposeOffset(TR::Node *node, LinearOffset &offset)
+{
+    offset._index = NULL;
+    offset._scale = 0;
+    offset._displacement = 0;
+    offset._adjustment = 0;
+
+    switch (node->getOpCodeValue()) {
+        case TR::lconst:
+            offset._displacement = node->getLongInt();
+            break;
+
+        case TR::i2l: {
+            TR::Node *child = node->getFirstChild();
+            TR::ILOpCodes childOp = child->getOpCodeValue();
+            if (childOp == TR::iconst) {
+                offset._displacement = child->getInt();
+            } else if (isIntLoad(child)) {
+                offset._index = child->getSymbolReference();
+                offset._scale = 1;
+            } else if ((childOp == TR::iadd || childOp == TR::isub) && isIntLoad(child->getFirstChild())
+                && child->getSecondChild()->getOpCodeValue() == TR::iconst) {
+                int32_t adjustment = child->getSecondChild()->getInt();
+                if (childOp == TR::isub) {
+                    if (adjustment == TR::getMinSigned<TR::Int32>())
+                        return false;
+                    adjustment = -adjustment;
+                }
+                offset._index = child->getFirstChild()->getSymbolReference();
+                offset._scale = 1;
+                offset._displacement = adjustment;
+                offset._adjustment = adjustment;
+            } else {
+                return false;
+            }
+            break;
+        }
+
+        case TR::lmul:
+        case TR::lshl: {
+            TR::Node *factorNode = node->getSecondChild();
+            int64_t factor;
+            if (node->getOpCodeValue() == TR::lmul) {
+                if (factorNode->getOpCodeValue() != TR::lconst)
+                    return false;
+                factor = factorNode->getLongInt();
+                if (factor > MAX_SCALE || factor < -MAX_SCALE)
+                    return false;
+            } else {
+                if (factorNode->getOpCodeValue() != TR::iconst || factorNode->getInt() < 0
+                    || factorNode->getInt() > 20)
+                    return false;
+                factor = (int64_t)1 << factorNode->getInt();
+            }
+
+            if (!decomposeOffset(node->getFirstChild(), offset))
+                return false;
+            offset._scale *= factor;
+            offset._displacement *= factor;
+            break;
+        }
+
+        case TR::ladd:
+        case TR::lsub: {
+            LinearOffset other;
+            if (!decomposeOffset(node->getFirstChild(), offset) || !decomposeOffset(node->getSecondChild(), other))
+                return false;
+
+            if (node->getOpCodeValue() == TR::lsub) {
+                if (other._index)
+                    return false;
+                offset._displacement -= other._displacement;
+            } else {
+                if (offset._index && other._index)
+                    return false;
+                if (other._index) {
+                    offset._index = other._index;
+                    offset._scale = other._scale;
+                    offset._adjustment = other._adjustment;
+                }
+                offset._displacement += other._displacement;
+            }
+            break;
+        }
+
+        default:
+            return false;
+    }
+
+    return offset._scale <= MAX_SCALE && offset._scale >= -MAX_SCALE && offset._displacement <= MAX_DISPLACEMENT
+        && offset._displacement >= -MAX_DISPLACEMENT;
+}
+
+bool TR_LoopAliasRefiner::findInductionVariable()
+{
+    TR::Node *loopTest = _loopTestTree ? _loopTestTree->getNode() : NULL;
+    if (!loopTest || !loopTest->getOpCode().isIf() || loopTest->getNumChildren() != 2)
+        return false;
+
+    TR::Node *lhs = loopTest->getFirstChild();
+    TR::Node *ivLoad = (lhs->getOpCodeValue() == TR::iadd || lhs->getOpCodeValue() == TR::isub)
+        ? lhs->getFirstChild()
+        : lhs;
+    if (!isIntLoad(ivLoad))
+        return false;
+
+    TR::SymbolReference *iv = ivLoad->getSymbolReference();
+    ListElement<int32_t> *usableIV = _versionableInductionVariables.getListHead();
+    while (usableIV && *usableIV->getData() != iv->getReferenceNumber())
+        usableIV = usableIV->getNextElement();
+
+    TR::TreeTop *storeTree = usableIV ? _storeTrees[iv->getReferenceNumber()] : NULL;
+    if (!storeTree)
+        return false;
+
+    // The loop test has to compare the induction variable before or after
+    // its update, which makes every value the induction variable takes in
+    // the loop at most two steps beyond the limit
+    TR::Node *newValue = storeTree->getNode()->getFirstChild();
+    if (lhs != ivLoad && lhs != newValue)
+        return false;
+
+    TR::ILOpCodes incOp = newValue->getOpCodeValue();
+    if ((incOp != TR::iadd && incOp != TR::isub) || newValue->getFirstChild()->getOpCodeValue() != TR::iload
+        || newValue->getFirstChild()->getSymbolReference() != iv
+        || newValue->getSecondChild()->getOpCodeValue() != TR::iconst)
+        return false;
+
+    int32_t step = newValue->getSecondChild()->getInt();
+    if (incOp == TR::isub) {
+        if (step == TR::getMinSigned<TR::Int32>())
+            return false;
+        step = -step;
+    }
+
+    // Find the condition for staying in the loop
+    TR::ILOpCodes keepLoopingOp = loopTest->getOpCodeValue();
+    TR::Block *target = loopTest->getBranchDestination()->getNode()->getBlock();
+    if (target != _currentNaturalLoop->getEntryBlock()) {
+        if (_currentNaturalLoop->contains(target->getStructureOf()))
+            return false;
+        keepLoopingOp = loopTest->getOpCode().getOpCodeForReverseBranch();
+    }
+
+    switch (keepLoopingOp) {
+        case TR::ificmplt:
+        case TR::ificmple:
+            if (step <= 0)
+                return false;
+            _increasing = true;
+            break;
+        case TR::ificmpgt:
+        case TR::ificmpge:
+            if (step >= 0)
+                return false;
+            _increasing = false;
+            break;
+        default:
+            return false;
+    }
+
+    _inclusiveLimit = keepLoopingOp == TR::ificmple || keepLoopingOp == TR::ificmpge;
+    _inductionVariable = iv;
+    _step = step;
+    return true;
+}
+
+bool TR_LoopAliasRefiner::loopContainsCall()
+{
+    TR_ScratchList<TR::Block> blocks(trMemory());
+    _currentNaturalLoop->getBlocks(&blocks);
+    ListIterator<TR::Block> it(&blocks);
+    for (TR::Block *block = it.getFirst(); block; block = it.getNext()) {
+        for (TR::TreeTop *tt = block->getEntry()->getNextTreeTop(); tt != block->getExit(); tt = tt->getNextTreeTop()) {
+            TR::Node *node = tt->getNode();
+            if (node->getOpCode().isCall() || (node->getNumChildren() > 0 && node->getFirstChild()->getOpCode().isCall()))
+                return true;
+        }
+    }
+    return false;
+}
+
+bool TR_LoopAliasRefiner::processArrayAliasCandidates()
+{
+    OMR::Logger *log = comp()->log();
+    _refineCurrentLoop = false;
+
+    if (_candidatesLoop != _currentNaturalLoop || _hasUnsupportedAccess || _accesses->size() < 2) {
+        logprintf(trace(), log, "Loop %d has no candidates for alias refinement\n", _currentNaturalLoop->getNumber());
+        return false;
+    }
+
+    if (!comp()->target().is64Bit() || !_loopConditionInvariant || !findInductionVariable() || loopContainsCall()) {
+        logprintf(trace(), log, "Loop %d is not a counted loop suitable for alias refinement\n",
+            _currentNaturalLoop->getNumber());
+        return false;
+    }
+
+    // Every array access in the loop has to be refined, otherwise an
+    // access left on the general array shadow could be moved past one of
+    // the refined accesses
+    ListIterator<TR::Node> arrayIt(_arrayAccesses);
+    for (TR::Node *node = arrayIt.getFirst(); node; node = arrayIt.getNext()) {
+        bool found = false;
+        for (size_t i = 0; i < _accesses->size() && !found; i++)
+            found = (*_accesses)[i]._node == node;
+        if (!found)
+            return false;
+    }
+
+    _bases->clear();
+    _lowestAdjustment = 0;
+    _highestAdjustment = 0;
+    bool hasStore = false;
+    for (size_t i = 0; i < _accesses->size(); i++) {
+        ArrayAccess &access = (*_accesses)[i];
+        TR::Node *node = access._node;
+        if ((access._offset._index && access._offset._index != _inductionVariable)
+            || !isExprInvariant(node->getFirstChild()->getFirstChild())) {
+            logprintf(trace(), log, "Array access n%dn is not linear in induction variable #%d\n",
+                node->getGlobalIndex(), _inductionVariable->getReferenceNumber());
+            return false;
+        }
+
+        if (access._offset._adjustment < _lowestAdjustment)
+            _lowestAdjustment = access._offset._adjustment;
+        if (access._offset._adjustment > _highestAdjustment)
+            _highestAdjustment = access._offset._adjustment;
+
+        int64_t end = access._offset._displacement
+            + TR::DataType::getSize(node->getSymbol()->getDataType());
+        bool isStore = node->getOpCode().isStore();
+        hasStore = hasStore || isStore;
+
+        size_t b = 0;
+        while (b < _bases->size() && (*_bases)[b]._base != access._base)
+            b++;
+
+        if (b == _bases->size()) {
+            if (b == MAX_BASES)
+                return false;
+
+            ArrayBase base;
+            base._base = access._base;
+            base._shadow = node->getSymbolReference();
+            base._refinedShadow = NULL;
+            base._scale = access._offset._scale;
+            base._lowestDisplacement = access._offset._displacement;
+            base._highestEnd = end;
+            base._isStored = isStore;
+            _bases->push_back(base);
+            continue;
+        }
+
+        ArrayBase &base = (*_bases)[b];
+        if (base._shadow != node->getSymbolReference() || base._scale != access._offset._scale) {
+            logprintf(trace(), log, "Array access n%dn does not match the other accesses through #%d\n",
+                node->getGlobalIndex(), access._base->getReferenceNumber());
+            return false;
+        }
+
+        if (access._offset._displacement < base._lowestDisplacement)
+            base._lowestDisplacement = access._offset._displacement;
+        if (end > base._highestEnd)
+            base._highestEnd = end;
+        base._isStored = base._isStored || isStore;
+    }
+
+    if (_bases->size() < 2 || !hasStore)
+        return false;
+
+    _refineCurrentLoop = performTransformation(comp(), "%sVersioning loop %d to refine aliases of %d arrays\n",
+        optDetailString(), _currentNaturalLoop->getNumber(), (int32_t)_bases->size());
+    return _refineCurrentLoop;
+}
+
+/**
+ * Create the lowest (or highest) value of the induction variable seen by
+ * any load of it in the loop, widened to 64 bits. One end of the range is
+ * the value on entry and the other is derived from the loop limit.
+ */
+TR::Node *TR_LoopAliasRefiner::createIndexBound(TR::Node *originNode, bool lowBound)
+{
+    if (lowBound == _increasing)
+        return TR::Node::create(originNode, TR::i2l, 1, TR::Node::createLoad(originNode, _inductionVariable));
+
+    int64_t bias = 2 * (int64_t)_step;
+    if (!_inclusiveLimit)
+        bias += _increasing ? -1 : 1;
+
+    TR::Node *limit = TR::Node::create(originNode, TR::i2l, 1, originNode->getSecondChild()->duplicateTree());
+    return TR::Node::create(originNode, TR::ladd, 2, limit, TR::Node::lconst(originNode, bias));
+}
+
+/**
+ * Create the address of the first byte (or one past the last byte) that
+ * the loop can access through the given base pointer.
+ */
+TR::Node *TR_LoopAliasRefiner::createRangeEnd(TR::Node *originNode, const ArrayBase &base, bool lowEnd)
+{
+    TR::Node *index = createIndexBound(originNode, lowEnd == (base._scale >= 0));
+    TR::Node *offset
+        = TR::Node::create(originNode, TR::lmul, 2, index, TR::Node::lconst(originNode, base._scale));
+    offset = TR::Node::create(originNode, TR::ladd, 2, offset,
+        TR::Node::lconst(originNode, lowEnd ? base._lowestDisplacement : base._highestEnd));
+
+    TR::Node *address
+        = TR::Node::create(originNode, TR::a2l, 1, TR::Node::createLoad(originNode, base._base));
+    return TR::Node::create(originNode, TR::ladd, 2, address, offset);
+}
+
+void TR_LoopAliasRefiner::buildAliasRefinementComparisonTrees(List<TR::TreeTop> *nullCheckTrees,
+    List<TR::TreeTop> *divCheckTrees, List<TR::TreeTop> *checkCastTrees, List<TR::TreeTop> *arrayStoreCheckTrees,
+    TR_ScratchList<TR::Node> *comparisonTrees, TR::Block *exitGotoBlock)
+{
+    if (!_refineCurrentLoop)
+        return;
+
+    OMR::Logger *log = comp()->log();
+    TR::Node *loopTest = _loopTestTree->getNode();
+    TR::TreeTop *slowLoop = exitGotoBlock->getEntry();
+
+    // A loop that starts beyond its limit still runs once
+    TR::Node *initial = TR::Node::createLoad(loopTest, _inductionVariable);
+    TR::Node *limit = loopTest->getSecondChild()->duplicateTree();
+    comparisonTrees->add(TR::Node::createif(_increasing ? TR::ificmpgt : TR::ificmplt, initial, limit, slowLoop));
+
+    // The indices are computed in 32 bits inside the loop, so none of them
+    // may wrap around for the ranges below to hold
+    if (_increasing || _highestAdjustment > 0) {
+        TR::Node *highest = TR::Node::create(loopTest, TR::ladd, 2, createIndexBound(loopTest, false),
+            TR::Node::lconst(loopTest, _highestAdjustment));
+        comparisonTrees->add(TR::Node::createif(TR::iflcmpgt, highest,
+            TR::Node::lconst(loopTest, TR::getMaxSigned<TR::Int32>()), slowLoop));
+    }
+    if (!_increasing || _lowestAdjustment < 0) {
+        TR::Node *lowest = TR::Node::create(loopTest, TR::ladd, 2, createIndexBound(loopTest, true),
+            TR::Node::lconst(loopTest, _lowestAdjustment));
+        comparisonTrees->add(TR::Node::createif(TR::iflcmplt, lowest,
+            TR::Node::lconst(loopTest, TR::getMinSigned<TR::Int32>()), slowLoop));
+    }
+
+    for (size_t i = 0; i < _bases->size(); i++) {
+        for (size_t j = i + 1; j < _bases->size(); j++) {
+            const ArrayBase &first = (*_bases)[i];
+            const ArrayBase &second = (*_bases)[j];
+            if (!first._isStored && !second._isStored)
+                continue;
+
+            TR::Node *firstBelowSecond = TR::Node::create(loopTest, TR::lcmplt, 2,
+                createRangeEnd(loopTest, first, true), createRangeEnd(loopTest, second, false));
+            TR::Node *secondBelowFirst = TR::Node::create(loopTest, TR::lcmplt, 2,
+                createRangeEnd(loopTest, second, true), createRangeEnd(loopTest, first, false));
+            TR::Node *overlap = TR::Node::create(loopTest, TR::iand, 2, firstBelowSecond, secondBelowFirst);
+            TR::Node *test
+                = TR::Node::createif(TR::ificmpne, overlap, TR::Node::iconst(loopTest, 0), slowLoop);
+            comparisonTrees->add(test);
+
+            logprintf(trace(), log, "Created overlap test n%dn for arrays through #%d and #%d\n",
+                test->getGlobalIndex(), first._base->getReferenceNumber(), second._base->getReferenceNumber());
+        }
+    }
+}
+
+void TR_LoopAliasRefiner::refineArrayAliases(TR_RegionStructure *loop)
+{
+    if (!_refineCurrentLoop || loop != _candidatesLoop)
+        return;
+
+    OMR::Logger *log = comp()->log();
+    TR::SymbolReferenceTable *symRefTab = comp()->getSymRefTab();
+    for (size_t i = 0; i < _bases->size(); i++) {
+        ArrayBase &base = (*_bases)[i];
+        base._refinedShadow = symRefTab->createRefinedArrayShadowSymbolRef(base._shadow->getSymbol()->getDataType());
+        for (size_t j = 0; j < i; j++)
+            base._refinedShadow->makeIndependent(symRefTab, (*_bases)[j]._refinedShadow);
+
+        logprintf(trace(), log, "Accesses through #%d in loop %d use refined array shadow #%d\n",
+            base._base->getReferenceNumber(), loop->getNumber(), base._refinedShadow->getReferenceNumber());
+    }
+
+    for (size_t i = 0; i < _accesses->size(); i++) {
+        ArrayAccess &access = (*_accesses)[i];
+        size_t b = 0;
+        while ((*_bases)[b]._base != access._base)
+            b++;
+        access._node->setSymbolReference((*_bases)[b]._refinedShadow);
+    }
+
+    _invalidateAliasSets = true;
+    _refineCurrentLoop = false;
+}
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef LOOPALIASREFINER_INCL
+#define LOOPALIASREFINER_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/LoopVersioner.hpp"
+
+namespace TR {
+class Block;
+class Node;
+class OptimizationManager;
+class SymbolReference;
+} // namespace TR
+class TR_RegionStructure;
+
+/**
+ * Class TR_LoopAliasRefiner
+ * =========================
+ *
+ * The loop alias refiner versions a counted loop whose array accesses all
+ * go through loop invariant base pointers at offsets linear in the loop
+ * driving induction variable. The range of addresses each base pointer
+ * covers over the whole loop is computed outside the loop, and the loop
+ * is only entered when the ranges of stored arrays do not overlap with
+ * the ranges of any other array; otherwise the unmodified duplicate loop
+ * runs. In the loop that is entered, the accesses through each base
+ * pointer get their own array shadow, independent of the shadows of the
+ * other base pointers, so that later loop optimizations such as unrolling
+ * can move and common accesses to different arrays.
+ */
+class TR_LoopAliasRefiner : public TR_LoopVersioner {
+public:
+    TR_LoopAliasRefiner(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) TR_LoopAliasRefiner(manager);
+    }
+
+    virtual const char *optDetailString() const throw();
+
+protected:
+    virtual bool processArrayAliasCandidates();
+    virtual void collectArrayAliasCandidates(TR::Node *node, vcount_t visitCount);
+    virtual void buildAliasRefinementComparisonTrees(List<TR::TreeTop> *nullCheckTrees,
+        List<TR::TreeTop> *divCheckTrees, List<TR::TreeTop> *checkCastTrees,
+        List<TR::TreeTop> *arrayStoreCheckTrees, TR_ScratchList<TR::Node> *comparisonTrees,
+        TR::Block *exitGotoBlock);
+    virtual void initAdditionalDataStructures();
+    virtual void refineArrayAliases(TR_RegionStructure *loop);
+
+private:
+    /// An address offset of the form scale * (index + adjustment) + displacement
+    struct LinearOffset {
+        TR::SymbolReference *_index;
+        int64_t _scale;
+        int64_t _displacement;
+        int32_t _adjustment;
+    };
+
+    /// An array load or store whose address is base + offset
+    struct ArrayAccess {
+        TR::Node *_node;
+        TR::SymbolReference *_base;
+        LinearOffset _offset;
+    };
+
+    /// The array accesses in the loop that go through one base pointer
+    struct ArrayBase {
+        TR::SymbolReference *_base;
+        TR::SymbolReference *_shadow;
+        TR::SymbolReference *_refinedShadow;
+        int64_t _scale;
+        int64_t _lowestDisplacement;
+        int64_t _highestEnd;
+        bool _isStored;
+    };
+
+    bool decomposeOffset(TR::Node *node, LinearOffset &offset);
+    bool findInductionVariable();
+    bool loopContainsCall();
+
+    TR::Node *createIndexBound(TR::Node *originNode, bool lowBound);
+    TR::Node *createRangeEnd(TR::Node *originNode, const ArrayBase &base, bool lowEnd);
+
+    /// The loop that the accesses below were collected from
+    TR_RegionStructure *_candidatesLoop;
+    TR::vector<ArrayAccess, TR::Region &> *_accesses;
+    TR::vector<ArrayBase, TR::Region &> *_bases;
+
+    /// Set when an indirect access in the loop cannot be described by an \ref ArrayAccess
+    bool _hasUnsupportedAccess;
+
+    /// Whether the current loop is being versioned to refine its aliases
+    bool _refineCurrentLoop;
+
+    TR::SymbolReference *_inductionVariable;
+    int32_t _step;
+    bool _increasing;
+    bool _inclusiveLimit;
+
+    /// Smallest and largest constant added to the induction variable before it is widened
+    int32_t _lowestAdjustment;
+    int32_t _highestAdjustment;
+};
+
+#endif
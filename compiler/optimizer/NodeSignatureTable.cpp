@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/NodeSignatureTable.hpp"
+
+#include <string.h>
+#include "env/Region.hpp"
+
+TR::NodeSignatureTable::NodeSignatureTable(TR::Region &region, uint32_t expectedEntries)
+    : _region(region)
+    , _signatures(NULL)
+    , _nodes(NULL)
+    , _numLive(0)
+    , _numUsed(0)
+{
+    // Keep the table at most half full
+    uint32_t capacity = 16;
+    while (capacity < expectedEntries * 2 + 2)
+        capacity <<= 1;
+    allocateArrays(capacity);
+}
+
+TR::NodeSignatureTable::~NodeSignatureTable()
+{
+    _region.deallocate(_signatures, _capacity * sizeof(uint32_t));
+    _region.deallocate(_nodes, _capacity * sizeof(TR::Node *));
+}
+
+void TR::NodeSignatureTable::allocateArrays(uint32_t capacity)
+{
+    _capacity = capacity;
+    _mask = capacity - 1;
+    _shift = 32;
+    for (uint32_t c = capacity; c > 1; c >>= 1)
+        _shift--;
+
+    _signatures = static_cast<uint32_t *>(_region.allocate(capacity * sizeof(uint32_t)));
+    _nodes = static_cast<TR::Node **>(_region.allocate(capacity * sizeof(TR::Node *)));
+    memset(_signatures, 0xff, capacity * sizeof(uint32_t));
+}
+
+void TR::NodeSignatureTable::add(uint32_t signature, TR::Node *node)
+{
+    if ((_numUsed + 1) * 2 > _capacity)
+        rehash((_numLive + 1) * 4 > _capacity ? _capacity * 2 : _capacity);
+
+    // New entries never take the place of a tombstone, so the nodes with a
+    // given signature are always found in the order they were added
+    uint32_t key = stored(signature);
+    uint32_t slot = home(key);
+    while (_signatures[slot] != EMPTY)
+        slot = (slot + 1) & _mask;
+
+    _signatures[slot] = key;
+    _nodes[slot] = node;
+    _numLive++;
+    _numUsed++;
+}
+
+int32_t TR::NodeSignatureTable::find(uint32_t signature, uint32_t slot) const
+{
+    uint32_t key = stored(signature);
+    while (true) {
+        uint32_t s = _signatures[slot];
+        if (s == key)
+            return static_cast<int32_t>(slot);
+        if (s == EMPTY)
+            return -1;
+        slot = (slot + 1) & _mask;
+    }
+}
+
+int32_t TR::NodeSignatureTable::last(uint32_t signature) const
+{
+    int32_t found = -1;
+    for (int32_t slot = first(signature); slot >= 0; slot = next(signature, slot))
+        found = slot;
+    return found;
+}
+
+void TR::NodeSignatureTable::removeAt(int32_t slot)
+{
+    _signatures[slot] = TOMBSTONE;
+    _nodes[slot] = NULL;
+    _numLive--;
+
+    uint32_t following = (slot + 1) & _mask;
+    if (_signatures[following] == EMPTY)
+        reclaimTombstonesBefore(following);
+}
+
+TR::Node *TR::NodeSignatureTable::removeAll(uint32_t signature)
+{
+    uint32_t key = stored(signature);
+    uint32_t slot = home(key);
+    TR::Node *newest = NULL;
+    for (; _signatures[slot] != EMPTY; slot = (slot + 1) & _mask) {
+        if (_signatures[slot] == key) {
+            newest = _nodes[slot];
+            _signatures[slot] = TOMBSTONE;
+            _nodes[slot] = NULL;
+            _numLive--;
+        }
+    }
+
+    if (newest)
+        reclaimTombstonesBefore(slot);
+    return newest;
+}
+
+void TR::NodeSignatureTable::reclaimTombstonesBefore(uint32_t slot)
+{
+    // No probe sequence runs through a tombstone that is followed by an
+    // empty slot, so it can be emptied too
+    for (slot = (slot - 1) & _mask; _signatures[slot] == TOMBSTONE; slot = (slot - 1) & _mask) {
+        _signatures[slot] = EMPTY;
+        _numUsed--;
+    }
+}
+
+void TR::NodeSignatureTable::clear()
+{
+    if (_numUsed > 0)
+        memset(_signatures, 0xff, _capacity * sizeof(uint32_t));
+    _numLive = 0;
+    _numUsed = 0;
+}
+
+void TR::NodeSignatureTable::rehash(uint32_t newCapacity)
+{
+    uint32_t *oldSignatures = _signatures;
+    TR::Node **oldNodes = _nodes;
+    uint32_t oldCapacity = _capacity;
+    uint32_t oldMask = _mask;
+
+    allocateArrays(newCapacity);
+    _numLive = 0;
+    _numUsed = 0;
+
+    // Start right after an empty slot so that no run of occupied slots is
+    // split by the wrap around, which keeps nodes with the same signature
+    // in the order they were added
+    uint32_t start = 0;
+    while (oldSignatures[start] != EMPTY)
+        start++;
+
+    for (uint32_t i = 1; i <= oldCapacity; i++) {
+        uint32_t slot = (start + i) & oldMask;
+        uint32_t key = oldSignatures[slot];
+        if (key == EMPTY || key == TOMBSTONE)
+            continue;
+
+        uint32_t newSlot = home(key);
+        while (_signatures[newSlot] != EMPTY)
+            newSlot = (newSlot + 1) & _mask;
+        _signatures[newSlot] = key;
+        _nodes[newSlot] = oldNodes[slot];
+        _numLive++;
+        _numUsed++;
+    }
+
+    _region.deallocate(oldSignatures, oldCapacity * sizeof(uint32_t));
+    _region.deallocate(oldNodes, oldCapacity * sizeof(TR::Node *));
+}
+
+uint32_t TR::NodeSignatureTable::longestCluster() const
+{
+    uint32_t longest = 0;
+    uint32_t run = 0;
+    // Count twice around the table so a run that wraps is measured whole
+    for (uint32_t i = 0; i < 2 * _capacity; i++) {
+        if (_signatures[i & _mask] == EMPTY) {
+            run = 0;
+        } else if (++run > longest) {
+            longest = run;
+        }
+    }
+    return longest > _capacity ? _capacity : longest;
+}
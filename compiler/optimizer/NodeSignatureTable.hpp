@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef NODESIGNATURETABLE_HPP
+#define NODESIGNATURETABLE_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace TR {
+class Node;
+class Region;
+} // namespace TR
+
+namespace TR {
+
+/**
+ * Multimap from 32-bit node signatures to nodes, used by local CSE and value
+ * numbering to find candidate equivalent nodes.
+ *
+ * The table uses open addressing with linear probing. Signatures and nodes
+ * are kept in two parallel flat arrays, so finding the candidates for a
+ * signature scans consecutive 32-bit words and only touches a node once its
+ * signature matches. The probe loop has no dependence on the nodes, and the
+ * compiler is free to vectorize the comparisons.
+ *
+ * Several nodes may share a signature; they are visited in the order they
+ * were added. Removing a node leaves a tombstone so later entries stay
+ * reachable. Tombstones at the end of a probe sequence are reclaimed at once,
+ * and the rest are dropped the next time the table is rehashed.
+ *
+ * A slot number returned by first(), next() or last() stays valid until the
+ * next call to add() or clear().
+ */
+class NodeSignatureTable {
+public:
+    /**
+     * @param region the region the table's arrays are allocated in
+     * @param expectedEntries a hint for the number of live entries
+     */
+    NodeSignatureTable(TR::Region &region, uint32_t expectedEntries = 16);
+
+    ~NodeSignatureTable();
+
+    void add(uint32_t signature, TR::Node *node);
+
+    /**
+     * @return the slot of the oldest node with the signature, or -1
+     */
+    int32_t first(uint32_t signature) const { return find(signature, home(stored(signature))); }
+
+    /**
+     * @return the slot of the next node with the signature after \p slot, or -1
+     */
+    int32_t next(uint32_t signature, int32_t slot) const { return find(signature, (slot + 1) & _mask); }
+
+    /**
+     * @return the slot of the newest node with the signature, or -1
+     */
+    int32_t last(uint32_t signature) const;
+
+    TR::Node *nodeAt(int32_t slot) const { return _nodes[slot]; }
+
+    void removeAt(int32_t slot);
+
+    /**
+     * Remove every node with the signature.
+     *
+     * @return the newest node removed, or NULL if there was none
+     */
+    TR::Node *removeAll(uint32_t signature);
+
+    void clear();
+
+    uint32_t size() const { return _numLive; }
+
+    uint32_t capacity() const { return _capacity; }
+
+    /**
+     * @return the length of the longest run of occupied slots, a measure of
+     *         the worst lookup in the table
+     */
+    uint32_t longestCluster() const;
+
+private:
+    static const uint32_t EMPTY = 0xffffffff;
+    static const uint32_t TOMBSTONE = 0xfffffffe;
+
+    /// The two reserved values are folded onto the two below them, which
+    /// only adds candidates that the caller rejects
+    static uint32_t stored(uint32_t signature) { return signature < TOMBSTONE ? signature : signature - 2; }
+
+    /// Fibonacci hashing spreads the small, dense signatures used by local
+    /// CSE (often symbol reference numbers) over the whole table
+    uint32_t home(uint32_t signature) const { return (signature * 0x9e3779b9u) >> _shift; }
+
+    int32_t find(uint32_t signature, uint32_t slot) const;
+
+    void allocateArrays(uint32_t capacity);
+    void rehash(uint32_t newCapacity);
+    void reclaimTombstonesBefore(uint32_t slot);
+
+    TR::Region &_region;
+    uint32_t *_signatures;
+    TR::Node **_nodes;
+    uint32_t _capacity;
+    uint32_t _mask;
+    uint32_t _shift;
+    uint32_t _numLive;
+    uint32_t _numUsed; ///< live entries and tombstones
+};
+
+} // namespace TR
+
+#endif
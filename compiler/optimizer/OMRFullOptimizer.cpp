@@ -87,6 +87,7 @@
 #include "optimizer/LocalLiveRangeReducer.hpp"
 #include "optimizer/LocalOpts.hpp"
 #include "optimizer/LocalReordering.hpp"
+#include "optimizer/LoopAliasRefiner.hpp"
 #include "optimizer/LoopCanonicalizer.hpp"
 #include "optimizer/LoopReducer.hpp"
 #include "optimizer/LoopReplicator.hpp"
@@ -294,6 +295,13 @@ static const OptimizationStrategy lastLoopVersionerOpts[] = {
     { OMR::endGroup }
 };
 
+static const OptimizationStrategy loopAliasRefinerOpts[] = {
+    { OMR::inductionVariableAnalysis, OMR::IfLoops },
+    { OMR::loopCanonicalization },
+    { OMR::loopAliasRefiner },
+    { OMR::endGroup }
+};
+
 static const OptimizationStrategy loopSpecializerOpts[] = {
     { OMR::inductionVariableAnalysis, OMR::IfLoops },
     { OMR::loopCanonicalization },
@@ -454,6 +462,7 @@ static const OptimizationStrategy fullHotStrategyOpts[] = {
     { OMR::globalDeadStoreElimination },
     { OMR::inductionVariableAnalysis },
     { OMR::loopSpecializerGroup },
+    { OMR::loopAliasRefinerGroup }, // version array loops whose arrays do not overlap at runtime
     { OMR::inductionVariableAnalysis },
     { OMR::generalLoopUnroller }, // unroll Loops
     { OMR::blockSplitter, OMR::MarkLastRun },
@@ -593,6 +602,8 @@ OMR::FullOptimizer::FullOptimizer(TR::Compilation *comp, TR::ResolvedMethodSymbo
         TR::OptimizationManager(self(), TR::TrivialDeadStoreElimination::create, OMR::trivialDeadStoreElimination);
     _opts[OMR::loopSpecializer]
         = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopSpecializer::create, OMR::loopSpecializer);
+    _opts[OMR::loopAliasRefiner]
+        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopAliasRefiner::create, OMR::loopAliasRefiner);
     // NOTE: Please add new OMR optimizations here!
 
     // initialize OMR optimization groups
@@ -620,6 +631,8 @@ OMR::FullOptimizer::FullOptimizer(TR::Compilation *comp, TR::ResolvedMethodSymbo
         OMR::veryExpensiveGlobalValuePropagationGroup, veryExpensiveGlobalValuePropagationOpts);
     _opts[OMR::loopSpecializerGroup]
         = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::loopSpecializerGroup, loopSpecializerOpts);
+    _opts[OMR::loopAliasRefinerGroup] = new (comp->allocator())
+        TR::OptimizationManager(self(), NULL, OMR::loopAliasRefinerGroup, loopAliasRefinerOpts);
     _opts[OMR::lateLocalGroup]
         = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::lateLocalGroup, lateLocalOpts);
     _opts[OMR::eachLocalAnalysisPassGroup] = new (comp->allocator())
@@ -293,10 +293,12 @@ void OMR::LocalCSE::transformBlock(TR::TreeTop *entryTree, TR::TreeTop *exitTree
     memset(_replacedNodesAsArray, 0, _numNodes * sizeof(TR::Node *));
     memset(_replacedNodesByAsArray, 0, _numNodes * sizeof(TR::Node *));
 
-    _hashTable = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
-    _hashTableWithSyms = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
-    _hashTableWithCalls = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
-    _hashTableWithConsts = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
+    // Most of the block's nodes end up in one of the first two tables, so
+    // start them large enough to rarely need to grow
+    _hashTable = new (stackMemoryRegion) HashTable(stackMemoryRegion, _numNodes / 2);
+    _hashTableWithSyms = new (stackMemoryRegion) HashTable(stackMemoryRegion, _numNodes / 2);
+    _hashTableWithCalls = new (stackMemoryRegion) HashTable(stackMemoryRegion);
+    _hashTableWithConsts = new (stackMemoryRegion) HashTable(stackMemoryRegion);
 
     _nextReplacedNode = 0;
     TR_BitVector seenAvailableLoadedSymbolReferences(stackMemoryRegion);
@@ -1201,10 +1203,8 @@ TR::Node *OMR::LocalCSE::getAvailableExpression(TR::Node *parent, TR::Node *node
         hashTable = _hashTable;
 
     int32_t hashValue = hash(parent, node);
-    auto range = hashTable->equal_range(hashValue);
-
-    for (auto it = range.first; it != range.second;) {
-        TR::Node *other = it->second;
+    for (int32_t slot = hashTable->first(hashValue); slot >= 0; slot = hashTable->next(hashValue, slot)) {
+        TR::Node *other = hashTable->nodeAt(slot);
         bool remove = false;
         if (areSyntacticallyEquivalent(other, node, &remove)) {
             logprintf(trace(), log, "node %p is syntactically equivalent to other %p\n", node, other);
@@ -1213,13 +1213,8 @@ TR::Node *OMR::LocalCSE::getAvailableExpression(TR::Node *parent, TR::Node *node
 
         if (remove) {
             logprintf(trace(), log, "remove is true, removing entry %p\n", other);
-            auto nextIt = it;
-            ++nextIt;
-            hashTable->erase(it);
-            it = nextIt;
+            hashTable->removeAt(slot);
             _killedNodes.set(other->getGlobalIndex());
-        } else {
-            ++it;
         }
     }
 
@@ -1330,14 +1325,9 @@ void OMR::LocalCSE::killAvailableExpressionsUsingBitVector(HashTable *hashTable,
     TR_BitVectorIterator bvi(vec);
     while (bvi.hasMoreElements()) {
         int32_t nextSymRefNum = bvi.getNextElement();
-        auto range = hashTable->equal_range(nextSymRefNum);
-        if (range.first != range.second) {
-            auto lastItem = range.second;
-            --lastItem;
-            _killedNodes.set(lastItem->second->getGlobalIndex());
-
-            hashTable->erase(range.first, range.second);
-        }
+        TR::Node *lastItem = hashTable->removeAll(nextSymRefNum);
+        if (lastItem)
+            _killedNodes.set(lastItem->getGlobalIndex());
     }
 }
 
@@ -1519,26 +1509,23 @@ void OMR::LocalCSE::addToHashTable(TR::Node *node, int32_t hashValue)
         _arrayRefNodes->add(node);
     }
 
-    auto pair = std::make_pair(hashValue, node);
-
     if (node->getOpCode().hasSymbolReference() && ((node->getOpCodeValue() != TR::loadaddr) || _loadaddrAsLoad)) {
         if (node->getOpCode().isCall()) {
-            _hashTableWithCalls->insert(pair);
+            _hashTableWithCalls->add(hashValue, node);
             _availableCallExprs.set(node->getSymbolReference()->getReferenceNumber());
         } else {
-            _hashTableWithSyms->insert(pair);
+            _hashTableWithSyms->add(hashValue, node);
             _availableLoadExprs.set(node->getSymbolReference()->getReferenceNumber());
         }
     } else if (node->getOpCode().isLoadConst())
-        _hashTableWithConsts->insert(pair);
+        _hashTableWithConsts->add(hashValue, node);
     else
-        _hashTable->insert(pair);
+        _hashTable->add(hashValue, node);
 }
 
 void OMR::LocalCSE::removeFromHashTable(HashTable *hashTable, int32_t hashValue)
 {
-    auto range = hashTable->equal_range(hashValue);
-    hashTable->erase(range.first, range.second);
+    hashTable->removeAll(hashValue);
 }
 
 // Returns true if the two subtrees are exactly the same syntactically
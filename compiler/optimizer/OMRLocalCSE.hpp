@@ -32,6 +32,7 @@
 #include "il/SymbolReference.hpp"
 #include "infra/Array.hpp"
 #include "infra/List.hpp"
+#include "optimizer/NodeSignatureTable.hpp"
 #include "optimizer/Optimization.hpp"
 
 class TR_UseDefAliasSetInterface;
@@ -83,8 +84,7 @@ public:
     virtual void postPerformOnBlocks();
     virtual const char *optDetailString() const throw();
 
-    typedef TR::typed_allocator<std::pair<const int32_t, TR::Node *>, TR::Region &> HashTableAllocator;
-    typedef std::multimap<int32_t, TR::Node *, std::less<int32_t>, HashTableAllocator> HashTable;
+    typedef TR::NodeSignatureTable HashTable;
 
 protected:
     virtual bool shouldTransformBlock(TR::Block *block);
@@ -111,6 +111,9 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
         case OMR::globalCopyPropagation:
             _flags.set(requiresStructure | requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs);
             break;
+        case OMR::escapeAnalysis:
+            _flags.set(requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs | canAddSymbolReference);
+            break;
         case OMR::globalDeadStoreElimination:
             _flags.set(requiresStructure);
             _flags.set(requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs);
@@ -171,6 +174,7 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
             _flags.set(requiresStructure);
             break;
         case OMR::loopSpecializer:
+        case OMR::loopAliasRefiner:
             _flags.set(requiresStructure | checkStructure | dumpStructure);
             break;
         case OMR::generalStoreSinking:
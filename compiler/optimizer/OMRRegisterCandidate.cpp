@@ -229,6 +229,7 @@ OMR::RegisterCandidates::RegisterCandidates(TR::Compilation *comp)
     , _trMemory(comp->trMemory())
     , _candidateRegion(_trMemory->heapMemoryRegion())
     , _referencedAutoSymRefsInBlock(NULL)
+    , _useLinearScan(false)
 {
     _candidateForSymRefs = 0;
 }
@@ -1900,6 +1901,82 @@ static void assign_candidate_loop_trace_increment(TR::Compilation *comp, TR::Reg
     }
 }
 
+bool OMR::RegisterCandidates::prepareCandidateForAssignment(TR::RegisterCandidate *rc, TR::Block **blocks,
+    TR_BitVector &catchBlocks, TR_BitVector &catchBlockLiveLocals, TR_BitVector &nonOSRCatchBlockLiveLocals,
+    bool catchBlockLiveLocalsExist, TR_BitVector &temp)
+{
+    TR::CodeGenerator *cg = comp()->cg();
+    OMR::Logger *log = comp()->log();
+    bool trace = comp()->getOptions()->trace(OMR::tacticalGlobalRegisterAllocator);
+
+    TR::DataType type = rc->getType();
+    TR::DataType dt = rc->getDataType();
+
+    if (type.isInt64() && cg->getDisableLongGRA()) {
+        logprints(trace, log, "Leaving candidate because LongGRA is disabled and candidate is 64 bit\n");
+        return false;
+    }
+
+    if (dt == TR::Aggregate && (1 || rc->getSymbolReference()->getSymbol()->getSize() > 8)) {
+        logprints(trace, log, "Leaving candidate because its an aggregate and > 64 bits\n");
+        return false;
+    }
+
+    if ((!rc->getSymbolReference()->getSymbol()->isAutoOrParm())
+        || rc->getSymbolReference()->getSymbol()->holdsMonitoredObject()) {
+        logprints(trace, log, "Leaving candidate because it holdsMonitoredObject\n");
+        return false; // todo: handle statics and fields?
+    }
+
+    // exclude symbols that can define other symbols
+    if (aliasesPreventAllocation(comp(), rc->getSymbolReference())) {
+        logprints(trace, log, "Leaving candidate because it has use_def_aliases\n");
+        return false;
+    }
+
+    if ((dt.isVector() || dt.isMask()) && !comp()->cg()->hasGlobalVRF()) {
+        logprintf(trace, log, "Leaving candidate because it has %s type but no global vector registers provided\n",
+            TR::DataType::getName(dt));
+        TR_ASSERT(!comp()->target().cpu.isZ(), "ed : debug : Should never get here for vector GRA on z");
+        return false;
+    }
+
+    // don't put this auto into a global register if it can be accessed from a catch clause
+    //
+    temp = rc->getBlocksLiveOnEntry();
+    temp &= catchBlocks;
+
+    if (((catchBlockLiveLocalsExist && rc->getSymbolReference()->getSymbol()->isAuto()
+             && catchBlockLiveLocals.get(
+                 rc->getSymbolReference()->getSymbol()->getAutoSymbol()->getLiveLocalIndex()))
+            || ((!catchBlockLiveLocalsExist || !rc->getSymbolReference()->getSymbol()->isAuto())
+                && !rc->getSymbolReference()->getUseonlyAliases().isZero(comp())))
+        && (!comp()->penalizePredsOfOSRCatchBlocksInGRA()
+            || ((catchBlockLiveLocalsExist && rc->getSymbolReference()->getSymbol()->isAuto()
+                    && nonOSRCatchBlockLiveLocals.get(
+                        rc->getSymbolReference()->getSymbol()->getAutoSymbol()->getLiveLocalIndex()))
+                || ((!catchBlockLiveLocalsExist || !rc->getSymbolReference()->getSymbol()->isAuto())
+                    && !comp()->getSymRefTab()->aliasBuilder.hasUseonlyAliasesOnlyDueToOSRCatchBlocks(
+                        rc->getSymbolReference())))))
+        // TODO:GRA Decide if this fix is OK -- without it on zemulator we would have a useonlyalias set for
+        // metadata and so we would set this propert
+        //  and then later on not get rid of the store ot metadata, and create a new store to global reg
+        rc->setLiveAcrossExceptionEdge(true);
+
+    if (!temp.isEmpty()) {
+        TR_BitVectorIterator bvi(rc->getBlocksLiveOnEntry());
+        while (bvi.hasMoreElements()) {
+            int32_t nextElement = bvi.getNextElement();
+            TR::Block *b = blocks[nextElement];
+            if (!b->getExceptionPredecessors().empty())
+                rc->getBlocksLiveOnEntry().reset(nextElement);
+        }
+        // return false;
+    }
+
+    return true;
+}
+
 bool OMR::RegisterCandidates::assign(TR::Block **cfgBlocks, int32_t numberOfBlocks, int32_t &lowestNumber,
     int32_t &highestNumber)
 {
@@ -2196,6 +2273,20 @@ bool OMR::RegisterCandidates::assign(TR::Block **cfgBlocks, int32_t numberOfBloc
     }
     cg->setUnavailableRegistersUsage(_liveOnEntryUsage, _liveOnExitUsage);
 
+    if (_useLinearScan) {
+        TR::vector<TR::RegisterCandidate *, TR::Region &> assignable(comp()->trMemory()->currentStackRegion());
+        for (rc = first; rc; rc = rc->getNext()) {
+            if (prepareCandidateForAssignment(rc, blocks, catchBlocks, catchBlockLiveLocals, nonOSRCatchBlockLiveLocals,
+                    catchBlockLiveLocalsExist, temp))
+                assignable.push_back(rc);
+        }
+
+        _candidates.setFirst(0);
+        _candidateForSymRefs->clear();
+        return assignLinearScan(assignable, blocks, numberOfBlocks, maxGPRsLiveOnExit, maxFPRsLiveOnExit,
+            maxVRFsLiveOnExit, lowestNumber, highestNumber);
+    }
+
     _liveOnEntryConflicts.init(trMemory(), numberOfGlobalRegisters, true, stackAlloc);
     _liveOnExitConflicts.init(trMemory(), numberOfGlobalRegisters, true, stackAlloc);
     _entryExitConflicts.init(trMemory(), numberOfGlobalRegisters, true, stackAlloc);
@@ -2263,70 +2354,11 @@ bool OMR::RegisterCandidates::assign(TR::Block **cfgBlocks, int32_t numberOfBloc
             }
         }
 
-        TR::DataType type = rc->getType();
-        TR::DataType dt = rc->getDataType();
-
-        if (type.isInt64() && cg->getDisableLongGRA()) {
-            logprints(trace, log, "Leaving candidate because LongGRA is disabled and candidate is 64 bit\n");
-            continue;
-        }
-
-        if (dt == TR::Aggregate && (1 || rc->getSymbolReference()->getSymbol()->getSize() > 8)) {
-            logprints(trace, log, "Leaving candidate because its an aggregate and > 64 bits\n");
+        if (!prepareCandidateForAssignment(rc, blocks, catchBlocks, catchBlockLiveLocals, nonOSRCatchBlockLiveLocals,
+                catchBlockLiveLocalsExist, temp))
             continue;
-        }
-
-        if ((!rc->getSymbolReference()->getSymbol()->isAutoOrParm())
-            || rc->getSymbolReference()->getSymbol()->holdsMonitoredObject()) {
-            logprints(trace, log, "Leaving candidate because it holdsMonitoredObject\n");
-            continue; // todo: handle statics and fields?
-        }
 
-        // exclude symbols that can define other symbols
-        if (aliasesPreventAllocation(comp(), rc->getSymbolReference())) {
-            logprints(trace, log, "Leaving candidate because it has use_def_aliases\n");
-            continue;
-        }
-
-        if ((dt.isVector() || dt.isMask()) && !comp()->cg()->hasGlobalVRF()) {
-            logprintf(trace, log, "Leaving candidate because it has %s type but no global vector registers provided\n",
-                TR::DataType::getName(dt));
-            TR_ASSERT(!comp()->target().cpu.isZ(), "ed : debug : Should never get here for vector GRA on z");
-            continue;
-        }
-
-        // don't put this auto into a global register if it can be accessed from a catch clause
-        //
-        temp = rc->getBlocksLiveOnEntry();
-        temp &= catchBlocks;
-
-        if (((catchBlockLiveLocalsExist && rc->getSymbolReference()->getSymbol()->isAuto()
-                 && catchBlockLiveLocals.get(
-                     rc->getSymbolReference()->getSymbol()->getAutoSymbol()->getLiveLocalIndex()))
-                || ((!catchBlockLiveLocalsExist || !rc->getSymbolReference()->getSymbol()->isAuto())
-                    && !rc->getSymbolReference()->getUseonlyAliases().isZero(comp())))
-            && (!comp()->penalizePredsOfOSRCatchBlocksInGRA()
-                || ((catchBlockLiveLocalsExist && rc->getSymbolReference()->getSymbol()->isAuto()
-                        && nonOSRCatchBlockLiveLocals.get(
-                            rc->getSymbolReference()->getSymbol()->getAutoSymbol()->getLiveLocalIndex()))
-                    || ((!catchBlockLiveLocalsExist || !rc->getSymbolReference()->getSymbol()->isAuto())
-                        && !comp()->getSymRefTab()->aliasBuilder.hasUseonlyAliasesOnlyDueToOSRCatchBlocks(
-                            rc->getSymbolReference())))))
-            // TODO:GRA Decide if this fix is OK -- without it on zemulator we would have a useonlyalias set for
-            // metadata and so we would set this propert
-            //  and then later on not get rid of the store ot metadata, and create a new store to global reg
-            rc->setLiveAcrossExceptionEdge(true);
-
-        if (!temp.isEmpty()) {
-            TR_BitVectorIterator bvi(rc->getBlocksLiveOnEntry());
-            while (bvi.hasMoreElements()) {
-                int32_t nextElement = bvi.getNextElement();
-                TR::Block *b = blocks[nextElement];
-                if (!b->getExceptionPredecessors().empty())
-                    rc->getBlocksLiveOnEntry().reset(nextElement);
-            }
-            // continue;
-        }
+        TR::DataType dt = rc->getDataType();
 
         bool isFloat = (dt == TR::Float || dt == TR::Double);
         bool isVector = dt.isVector() || dt.isMask();
@@ -3212,6 +3244,442 @@ bool OMR::RegisterCandidates::assign(TR::Block **cfgBlocks, int32_t numberOfBloc
     return globalFPAssignmentDone;
 }
 
+/*
+ * Linear scan assignment
+ * ======================
+ *
+ * A cheaper alternative to the priority based assignment in assign(). Each
+ * candidate's live range is approximated by the interval of block positions,
+ * in tree order, between the first and the last block it is live on entry to
+ * or on exit from. The intervals are visited in order of their start. A
+ * candidate gets any register of its kind that the code generator allows in
+ * its blocks and that no interval overlapping it holds. When there is none,
+ * the lightest overlapping interval is evicted if the current one is heavier.
+ *
+ * Unlike assign() there is no reprioritization, live range trimming, overlap
+ * analysis within blocks or register pressure simulation, so the cost is
+ * roughly linear in the total size of the candidates' live ranges. The price
+ * is that candidates whose blocks merely lie between another candidate's
+ * blocks are treated as interfering, and that a candidate is either assigned
+ * over its whole live range or not at all.
+ */
+namespace {
+
+enum LiveIntervalKind {
+    LiveIntervalGPR,
+    LiveIntervalFPR,
+    LiveIntervalVRF,
+    NumLiveIntervalKinds
+};
+
+struct LiveInterval {
+    TR::RegisterCandidate *_candidate;
+    int32_t _start; // position of the first block the candidate is live in
+    int32_t _end; // position of the last block the candidate is live in
+    int32_t _firstRegister;
+    int32_t _lastRegister;
+    LiveIntervalKind _kind;
+    bool _needs2Regs;
+    TR_GlobalRegisterNumber _lowRegister; // -1 while unassigned
+    TR_GlobalRegisterNumber _highRegister;
+};
+
+struct LiveIntervalStartOrder {
+    bool operator()(const LiveInterval *a, const LiveInterval *b) const
+    {
+        if (a->_start != b->_start)
+            return a->_start < b->_start;
+        if (a->_candidate->getWeight() != b->_candidate->getWeight())
+            return a->_candidate->getWeight() > b->_candidate->getWeight();
+        return a->_candidate->getSymbolReference()->getReferenceNumber()
+            < b->_candidate->getSymbolReference()->getReferenceNumber();
+    }
+};
+
+typedef TR::vector<LiveInterval *, TR::Region &> LiveIntervalsByRegister;
+
+static bool registerIsHeld(LiveIntervalsByRegister &holders, TR::CodeGenerator *cg, bool enableVectorGRA,
+    TR_GlobalRegisterNumber reg, int32_t position)
+{
+    if (holders[reg] && holders[reg]->_end >= position)
+        return true;
+
+    // FPRs and VRFs can overlap
+    if (enableVectorGRA && (cg->isGlobalFPR(reg) || cg->isGlobalVRF(reg)) && cg->isAliasedGRN(reg)) {
+        TR_GlobalRegisterNumber alias = cg->getOverlappedAliasForGRN(reg);
+        if (holders[alias] && holders[alias]->_end >= position)
+            return true;
+    }
+
+    return false;
+}
+
+static TR_GlobalRegisterNumber firstRegisterIn(TR_BitVector &registers, TR_BitVector *include, TR_BitVector *exclude)
+{
+    TR_BitVectorIterator bvi(registers);
+    while (bvi.hasMoreElements()) {
+        int32_t reg = bvi.getNextElement();
+        if ((!include || include->isSet(reg)) && (!exclude || !exclude->isSet(reg)))
+            return reg;
+    }
+    return -1;
+}
+
+} // namespace
+
+TR_GlobalRegisterNumber OMR::RegisterCandidates::pickLinearScanRegister(TR::RegisterCandidate *rc,
+    TR_BitVector &freeRegisters, TR_GlobalRegisterNumber linkageRegister, bool liveAcrossCall)
+{
+    // Same preferences as the pressure insensitive pickRegister: a parameter's own linkage register, then
+    // preserved registers for candidates live across calls and volatile ones otherwise
+    if (linkageRegister != -1 && freeRegisters.isSet(linkageRegister))
+        return linkageRegister;
+
+    TR::CodeGenerator *cg = comp()->cg();
+    TR::DataType dt = rc->getDataType();
+    TR_BitVector *preservedRegisters = NULL;
+    if (dt == TR::Float || dt == TR::Double)
+        preservedRegisters = cg->getGlobalFPRsPreservedAcrossCalls();
+    else if (!dt.isVector() && !dt.isMask())
+        preservedRegisters = cg->getGlobalGPRsPreservedAcrossCalls();
+
+    // Leave the linkage registers to the parameters arriving in them if possible
+    TR_BitVector *linkageRegisters = NULL;
+    if (linkageRegister == -1)
+        linkageRegisters = cg->getGlobalRegisters(TR_linkageSpill, comp()->getJittedMethodSymbol()->getLinkageConvention());
+
+    TR_GlobalRegisterNumber reg = -1;
+    if (preservedRegisters) {
+        if (liveAcrossCall)
+            reg = firstRegisterIn(freeRegisters, preservedRegisters, linkageRegisters);
+        else
+            reg = firstRegisterIn(freeRegisters, NULL, preservedRegisters);
+    }
+
+    if (reg == -1)
+        reg = firstRegisterIn(freeRegisters, NULL, linkageRegisters);
+
+    if (reg == -1)
+        reg = firstRegisterIn(freeRegisters, NULL, NULL);
+
+    return reg;
+}
+
+bool OMR::RegisterCandidates::assignLinearScan(TR::vector<TR::RegisterCandidate *, TR::Region &> &candidates,
+    TR::Block **blocks, int32_t numberOfBlocks, TR_Array<int32_t> &maxGPRsLiveOnExit,
+    TR_Array<int32_t> &maxFPRsLiveOnExit, TR_Array<int32_t> &maxVRFsLiveOnExit, int32_t &lowestNumber,
+    int32_t &highestNumber)
+{
+    LexicalTimer t("assignLinearScan", comp()->phaseTimer());
+
+    TR::Region &region = comp()->trMemory()->currentStackRegion();
+    TR::CodeGenerator *cg = comp()->cg();
+    OMR::Logger *log = comp()->log();
+    bool trace = comp()->getOptions()->trace(OMR::tacticalGlobalRegisterAllocator);
+    bool enableVectorGRA = cg->getSupportsVectorRegisters() && !comp()->getOption(TR_DisableVectorRegGRA);
+    bool globalFPAssignmentDone = false;
+
+    // Number the blocks in tree order
+    //
+    TR::vector<int32_t, TR::Region &> position(numberOfBlocks, -1, region);
+    int32_t numberOfPositions = 0;
+    for (TR::Block *b = comp()->getStartBlock(); b; b = b->getNextBlock())
+        position[b->getNumber()] = numberOfPositions++;
+
+    // Build the live intervals
+    //
+    TR::vector<LiveInterval, TR::Region &> intervals(region);
+    intervals.reserve(candidates.size());
+    for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        TR::RegisterCandidate *rc = *it;
+        TR::DataType dt = rc->getDataType();
+
+        LiveInterval interval;
+        interval._candidate = rc;
+        interval._needs2Regs = rc->rcNeeds2Regs(comp());
+        interval._lowRegister = -1;
+        interval._highRegister = -1;
+
+        if (dt == TR::Float || dt == TR::Double) {
+            if (cg->getDisableFloatingPointGRA())
+                continue;
+
+            interval._kind = LiveIntervalFPR;
+            interval._firstRegister = cg->getFirstGlobalFPR();
+            interval._lastRegister = cg->getLastGlobalFPR();
+        } else if (dt.isVector() || dt.isMask()) {
+            interval._kind = LiveIntervalVRF;
+#if defined(TR_TARGET_POWER) && defined(TR_TARGET_64BIT)
+            interval._firstRegister = cg->getFirstGlobalFPR();
+#else
+            interval._firstRegister = cg->getFirstGlobalVRF();
+#endif
+            interval._lastRegister = cg->getLastGlobalVRF();
+        } else {
+            interval._kind = LiveIntervalGPR;
+            interval._firstRegister = cg->getFirstGlobalGPR();
+            interval._lastRegister = cg->getLastGlobalGPR();
+        }
+
+        interval._start = numberOfPositions;
+        interval._end = -1;
+
+        TR_BitVector liveBlocks(rc->getBlocksLiveOnEntry());
+        liveBlocks |= rc->getBlocksLiveOnExit();
+        TR_BitVectorIterator bvi(liveBlocks);
+        bool isInTreeOrder = true;
+        while (bvi.hasMoreElements()) {
+            int32_t blockPosition = position[bvi.getNextElement()];
+            if (blockPosition < 0) {
+                isInTreeOrder = false;
+                break;
+            }
+            interval._start = std::min(interval._start, blockPosition);
+            interval._end = std::max(interval._end, blockPosition);
+        }
+
+        if (!isInTreeOrder || interval._end < 0) {
+            logprintf(trace, log, "Leaving candidate #%d because it is not live across any block boundary\n",
+                rc->getSymbolReference()->getReferenceNumber());
+            continue;
+        }
+
+        intervals.push_back(interval);
+    }
+
+    TR::vector<LiveInterval *, TR::Region &> order(region);
+    order.reserve(intervals.size());
+    for (auto it = intervals.begin(); it != intervals.end(); ++it)
+        order.push_back(&*it);
+    std::sort(order.begin(), order.end(), LiveIntervalStartOrder());
+
+    // Scan
+    //
+    int32_t numberOfGlobalRegisters = cg->getNumberOfGlobalRegisters();
+    LiveIntervalsByRegister holders(numberOfGlobalRegisters, NULL, region);
+    TR::vector<int32_t, TR::Region &> liveOnExitCount(NumLiveIntervalKinds * numberOfBlocks, 0, region);
+    TR_Array<int32_t> *maxLiveOnExit[NumLiveIntervalKinds]
+        = { &maxGPRsLiveOnExit, &maxFPRsLiveOnExit, &maxVRFsLiveOnExit };
+
+    TR_BitVector *vmThreadRegisters
+        = cg->getGlobalRegisters(TR_vmThreadSpill, comp()->getMethodSymbol()->getLinkageConvention());
+    TR_BitVector *linkageRegisters = cg->getGlobalRegisters(TR_linkageSpill, TR_System);
+    TR_BitVector *blocksWithCalls = cg->getBlocksWithCalls();
+    int32_t entryBlockNumber = comp()->getStartTree()->getNode()->getBlock()->getNumber();
+
+    unsigned iterationCount = 0;
+    for (auto it = order.begin(); it != order.end(); ++it) {
+        LiveInterval *current = *it;
+        TR::RegisterCandidate *rc = current->_candidate;
+        TR::Symbol *rcSymbol = rc->getSymbolReference()->getSymbol();
+        int32_t numRegs = current->_needs2Regs ? 2 : 1;
+
+        if (((++iterationCount & 0xf) == 0) && comp()->compilationShouldBeInterrupted(GRA_ASSIGN_CONTEXT))
+            comp()->failCompilation<TR::CompilationInterrupted>("interrupted in GRA");
+
+        // A candidate live on exit from a block where the code generator can't carry
+        // any more registers of its kind across the edge can't be assigned
+        //
+        int32_t *exitCount = &liveOnExitCount[current->_kind * numberOfBlocks];
+        TR_Array<int32_t> &maxExitCount = *maxLiveOnExit[current->_kind];
+        bool exceedsLiveOnExitLimit = false;
+        TR_BitVectorIterator bvi(rc->getBlocksLiveOnExit());
+        while (bvi.hasMoreElements() && !exceedsLiveOnExitLimit) {
+            int32_t blockNumber = bvi.getNextElement();
+            exceedsLiveOnExitLimit = exitCount[blockNumber] + numRegs > maxExitCount[blockNumber];
+        }
+
+        if (exceedsLiveOnExitLimit) {
+            logprintf(trace, log, "Leaving candidate #%d because too many registers are live on some exit\n",
+                rc->getSymbolReference()->getReferenceNumber());
+            continue;
+        }
+
+        // Registers the candidate could use if no other candidate held them
+        //
+        TR_BitVector legalRegisters(current->_lastRegister + 1, trMemory(), stackAlloc);
+        for (int32_t i = current->_firstRegister; i <= current->_lastRegister; ++i) {
+            if (_liveOnEntryUsage[i].intersects(rc->getBlocksLiveOnEntry())
+                || _liveOnEntryUsage[i].intersects(rc->getBlocksLiveOnExit())
+                || _liveOnExitUsage[i].intersects(rc->getBlocksLiveOnEntry())
+                || _liveOnExitUsage[i].intersects(rc->getBlocksLiveOnExit()))
+                continue;
+
+            if (cg->isGlobalRegisterAvailable(i, rc->getDataType()))
+                legalRegisters.set(i);
+        }
+
+        if (vmThreadRegisters)
+            legalRegisters -= *vmThreadRegisters;
+
+        // A parameter live on method entry can't take another parameter's linkage register
+        TR_GlobalRegisterNumber linkageRegister = -1;
+        if (rcSymbol->isParm() && rcSymbol->getParmSymbol()->getLinkageRegisterIndex() >= 0) {
+            linkageRegister = cg->getLinkageGlobalRegisterNumber(rcSymbol->getParmSymbol()->getLinkageRegisterIndex(),
+                rcSymbol->getDataType());
+            if (rc->getBlocksLiveOnEntry().get(entryBlockNumber) && linkageRegisters) {
+                bool ownRegisterIsLegal = linkageRegister != -1 && legalRegisters.isSet(linkageRegister);
+                legalRegisters -= *linkageRegisters;
+                if (ownRegisterIsLegal)
+                    legalRegisters.set(linkageRegister);
+            }
+        }
+
+        cg->removeUnavailableRegisters(rc, blocks, legalRegisters);
+
+        TR_BitVector freeRegisters(legalRegisters);
+        TR_BitVectorIterator regIt(legalRegisters);
+        while (regIt.hasMoreElements()) {
+            int32_t reg = regIt.getNextElement();
+            if (registerIsHeld(holders, cg, enableVectorGRA, reg, current->_start))
+                freeRegisters.reset(reg);
+        }
+
+        bool liveAcrossCall = rc->getBlocksLiveOnEntry().intersects(*blocksWithCalls);
+        TR_GlobalRegisterNumber lowRegister = pickLinearScanRegister(rc, freeRegisters, linkageRegister, liveAcrossCall);
+        TR_GlobalRegisterNumber highRegister = -1;
+        if (lowRegister != -1 && current->_needs2Regs) {
+            freeRegisters.reset(lowRegister);
+            highRegister = pickLinearScanRegister(rc, freeRegisters, -1, liveAcrossCall);
+            if (highRegister == -1)
+                lowRegister = -1;
+        }
+
+        if (lowRegister == -1 && !current->_needs2Regs) {
+            // Evict the lightest interval holding a register this candidate could use
+            //
+            LiveInterval *victim = NULL;
+            regIt.setBitVector(legalRegisters);
+            while (regIt.hasMoreElements()) {
+                int32_t reg = regIt.getNextElement();
+                LiveInterval *holder = holders[reg];
+                if (holder && holder->_end >= current->_start && !holder->_needs2Regs
+                    && holder->_candidate->getWeight() < rc->getWeight()
+                    && (!victim || holder->_candidate->getWeight() < victim->_candidate->getWeight())) {
+                    // The register must be free once the holder is gone, including its aliases
+                    holders[reg] = NULL;
+                    bool isFreeWithoutHolder = !registerIsHeld(holders, cg, enableVectorGRA, reg, current->_start);
+                    holders[reg] = holder;
+                    if (isFreeWithoutHolder) {
+                        victim = holder;
+                        lowRegister = reg;
+                    }
+                }
+            }
+
+            if (victim) {
+                logprintf(trace, log, "Candidate #%d (weight %d) evicts candidate #%d (weight %d) from register %d\n",
+                    rc->getSymbolReference()->getReferenceNumber(), rc->getWeight(),
+                    victim->_candidate->getSymbolReference()->getReferenceNumber(), victim->_candidate->getWeight(),
+                    lowRegister);
+
+                int32_t *victimExitCount = &liveOnExitCount[victim->_kind * numberOfBlocks];
+                bvi.setBitVector(victim->_candidate->getBlocksLiveOnExit());
+                while (bvi.hasMoreElements())
+                    victimExitCount[bvi.getNextElement()]--;
+
+                holders[victim->_lowRegister] = NULL;
+                victim->_lowRegister = -1;
+            }
+        }
+
+        if (lowRegister == -1) {
+            logprintf(trace, log, "No register for candidate #%d live in blocks at positions [%d, %d]\n",
+                rc->getSymbolReference()->getReferenceNumber(), current->_start, current->_end);
+            continue;
+        }
+
+        current->_lowRegister = lowRegister;
+        current->_highRegister = highRegister;
+        holders[lowRegister] = current;
+        if (highRegister != -1)
+            holders[highRegister] = current;
+
+        bvi.setBitVector(rc->getBlocksLiveOnExit());
+        while (bvi.hasMoreElements())
+            exitCount[bvi.getNextElement()] += numRegs;
+
+        logprintf(trace, log, "Candidate #%d live in blocks at positions [%d, %d] gets register %d\n",
+            rc->getSymbolReference()->getReferenceNumber(), current->_start, current->_end, lowRegister);
+    }
+
+    // Record the assignments, in priority order
+    //
+    highestNumber = -1;
+    lowestNumber = INT_MAX;
+    for (auto it = intervals.begin(); it != intervals.end(); ++it) {
+        LiveInterval &interval = *it;
+        if (interval._lowRegister == -1)
+            continue;
+
+        TR::RegisterCandidate *rc = interval._candidate;
+        TR_GlobalRegisterNumber registerNumber = interval._lowRegister;
+        TR_GlobalRegisterNumber highRegisterNumber = interval._highRegister;
+
+        if (interval._needs2Regs) {
+            if (!performTransformation(comp(), "%s assign auto #%d to low reg %d and high reg %d (linear scan)\n",
+                    OPT_DETAILS, rc->getSymbolReference()->getReferenceNumber(), registerNumber, highRegisterNumber))
+                continue;
+        } else {
+            if (!performTransformation(comp(), "%s assign auto #%d to reg %d (%s) (linear scan)\n", OPT_DETAILS,
+                    rc->getSymbolReference()->getReferenceNumber(), registerNumber,
+                    comp()->getDebug() ? comp()->getDebug()->getGlobalRegisterName(registerNumber) : "?"))
+                continue;
+        }
+
+        if (interval._kind == LiveIntervalFPR)
+            globalFPAssignmentDone = true;
+
+        _candidates.add(rc);
+        (*_candidateForSymRefs)[GET_INDEX_FOR_CANDIDATE_FOR_SYMREF(rc->getSymbolReference())] = rc;
+
+        if (interval._needs2Regs) {
+            rc->setLowGlobalRegisterNumber(registerNumber);
+            rc->setHighGlobalRegisterNumber(highRegisterNumber);
+        } else
+            rc->setGlobalRegisterNumber(registerNumber);
+
+        rc->setIs8BitGlobalGPR(cg->is8BitGlobalGPR(registerNumber));
+
+        if (registerNumber > highestNumber)
+            highestNumber = registerNumber;
+        if (registerNumber < lowestNumber)
+            lowestNumber = registerNumber;
+
+        if (highRegisterNumber != -1) {
+            if (highRegisterNumber > highestNumber)
+                highestNumber = highRegisterNumber;
+            if (highRegisterNumber < lowestNumber)
+                lowestNumber = highRegisterNumber;
+        }
+
+        TR_BitVectorIterator bvi(rc->getBlocksLiveOnEntry());
+        while (bvi.hasMoreElements()) {
+            TR::Block *b = blocks[bvi.getNextElement()];
+            b->getGlobalRegisters(comp())[registerNumber].setRegisterCandidateOnEntry(rc);
+            if (highRegisterNumber != -1)
+                b->getGlobalRegisters(comp())[highRegisterNumber].setRegisterCandidateOnEntry(rc);
+        }
+
+        bvi.setBitVector(rc->getBlocksLiveOnExit());
+        while (bvi.hasMoreElements()) {
+            TR::Block *b = blocks[bvi.getNextElement()];
+            b->getGlobalRegisters(comp())[registerNumber].setRegisterCandidateOnExit(rc);
+            if (highRegisterNumber != -1)
+                b->getGlobalRegisters(comp())[highRegisterNumber].setRegisterCandidateOnExit(rc);
+        }
+
+        _liveOnEntryUsage[registerNumber] |= rc->getBlocksLiveOnEntry();
+        _liveOnExitUsage[registerNumber] |= rc->getBlocksLiveOnExit();
+        if (highRegisterNumber != -1) {
+            _liveOnEntryUsage[highRegisterNumber] |= rc->getBlocksLiveOnEntry();
+            _liveOnExitUsage[highRegisterNumber] |= rc->getBlocksLiveOnExit();
+        }
+    }
+
+    return globalFPAssignmentDone;
+}
+
 static void ComputeOverlaps(TR::Node *node, TR::Compilation *comp, OMR::RegisterCandidates::Coordinates &overlaps,
     uint32_t &seqno)
 {
@@ -37,6 +37,7 @@
 #include "infra/Flags.hpp"
 #include "infra/Link.hpp"
 #include "infra/List.hpp"
+#include "infra/vector.hpp"
 #include <map>
 
 class TR_GlobalRegisterAllocator;
@@ -370,6 +371,15 @@ public:
     TR_BitVector *getBlocksReferencingSymRef(uint32_t symRefNum);
 
     virtual bool assign(TR::Block **, int32_t, int32_t &, int32_t &);
+
+    /**
+     * \brief Select the linear scan mode of \ref assign, which trades code quality for
+     *        compile time on methods where the full assignment is too expensive
+     */
+    void setUseLinearScan(bool b) { _useLinearScan = b; }
+
+    bool getUseLinearScan() { return _useLinearScan; }
+
     virtual void computeAvailableRegisters(TR::RegisterCandidate *, int32_t, int32_t, TR::Block **, TR_BitVector *);
 
     static int32_t getWeightForType(TR_RegisterCandidateTypes type) { return _candidateTypeWeights[type]; }
@@ -405,6 +415,14 @@ protected:
     bool candidatesOverlap(TR::Block *, TR::RegisterCandidate *, TR::RegisterCandidate *, bool);
     void lookForCandidates(TR::Node *, TR::Symbol *, TR::Symbol *, bool &, bool &);
     bool prioritizeCandidate(TR::RegisterCandidate *, TR::RegisterCandidate *&);
+    bool prepareCandidateForAssignment(TR::RegisterCandidate *, TR::Block **, TR_BitVector &catchBlocks,
+        TR_BitVector &catchBlockLiveLocals, TR_BitVector &nonOSRCatchBlockLiveLocals, bool catchBlockLiveLocalsExist,
+        TR_BitVector &temp);
+    bool assignLinearScan(TR::vector<TR::RegisterCandidate *, TR::Region &> &, TR::Block **, int32_t,
+        TR_Array<int32_t> &maxGPRsLiveOnExit, TR_Array<int32_t> &maxFPRsLiveOnExit,
+        TR_Array<int32_t> &maxVRFsLiveOnExit, int32_t &lowestNumber, int32_t &highestNumber);
+    TR_GlobalRegisterNumber pickLinearScanRegister(TR::RegisterCandidate *, TR_BitVector &freeRegisters,
+        TR_GlobalRegisterNumber linkageRegister, bool liveAcrossCall);
     TR::RegisterCandidate *reprioritizeCandidates(TR::RegisterCandidate *, TR::Block **, int32_t *, int32_t,
         TR::Block *, TR::Compilation *, bool reprioritizeFP, bool onlyReprioritizeLongs, TR_BitVector *referencedBlocks,
         TR_Array<int32_t> &blockGPRCount, TR_Array<int32_t> &blockFPRCount, TR_Array<int32_t> &blockVRFCount,
@@ -419,6 +437,7 @@ protected:
     TR::GlobalSet *_referencedAutoSymRefsInBlock;
 
     SymRefCandidateMap *_candidateForSymRefs;
+    bool _useLinearScan;
     TR_Array<TR::Block *> _startOfExtendedBBForBB;
 
     // scratch arrays for calculating register conflicts
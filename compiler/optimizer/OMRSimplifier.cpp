@@ -74,6 +74,7 @@
 #include "optimizer/Optimization_inlines.hpp"
 #include "optimizer/OptimizationManager.hpp"
 #include "optimizer/Optimizations.hpp"
+#include "optimizer/OptimizationStatistics.hpp"
 #include "optimizer/Optimizer.hpp"
 #include "optimizer/Structure.hpp"
 #include "optimizer/TransformUtil.hpp"
@@ -158,6 +159,8 @@ OMR::Simplifier::Simplifier(TR::OptimizationManager *manager)
 
     _withReassociation = false;
     _enableFullReassociation = false;
+    _applyRewriteRules = !comp()->getOption(TR_DisableSimplifierRewriteRules);
+    _nodesVisited = 0;
 
     _containingStructure = NULL;
 
@@ -237,12 +240,17 @@ int32_t OMR::Simplifier::perform()
         cleanupFlags(tt->getNode());
 
     visitCount = comp()->incVisitCount();
+    _nodesVisited = 0;
     tt = comp()->getStartTree();
     while (tt)
         tt = simplifyExtendedBlock(tt);
 
     comp()->getFlowGraph()->removeUnreachableBlocks();
 
+    TR::OptimizationStatistics::MethodStatistics *optStats = TR::OptimizationStatistics::methodStatistics(comp());
+    if (optStats)
+        optStats->pass(id())._nodesVisited += _nodesVisited;
+
     if (manager()->numPassesCompleted() == 0)
         manager()->incNumPassesCompleted();
 
@@ -510,15 +518,31 @@ TR::Node *OMR::Simplifier::simplify(TR::Node *node, TR::Block *block)
         return node;
     }
 
+    _nodesVisited++;
+
     // Simplify this node.
     // Note that the processing routine for the node is responsible for
     // simplifying its children.
     //
     preSimplification(node);
-    TR::Node *newNode = simplifierOpts[node->getOpCodeValue()](node, block, (TR::Simplifier *)this);
+
+    // The rewrite rules see the simplified children. A node rewritten in
+    // place goes on to the handler of its new opcode; a node replaced by one
+    // of its operands is done, since the operand has been simplified.
+    //
+    TR::Node *newNode = NULL;
+    bool rewritten = false;
+    if (_applyRewriteRules && hasRewriteRules(node->getOpCodeValue())) {
+        simplifyChildren(node, block);
+        newNode = applyRewriteRules(node);
+        rewritten = newNode != NULL;
+    }
+
+    if (newNode == NULL || newNode == node)
+        newNode = simplifierOpts[node->getOpCodeValue()](node, block, (TR::Simplifier *)this);
     if (newNode)
         postSimplification(newNode);
-    if ((node != newNode)
+    if (rewritten || (node != newNode)
         || (newNode
             && ((newNode->getOpCodeValue() != node->getOpCodeValue())
                 || (newNode->getNumChildren() != node->getNumChildren()))))
@@ -638,6 +662,43 @@ void OMR::Simplifier::prepareToReplaceNode(TR::Node *node)
     _alteredBlock = true;
 }
 
+bool OMR::Simplifier::performRewrite(const char *rule, TR::Node *node)
+{
+    return performTransformation(comp(), "%sApplied rewrite rule %s to node [" POINTER_PRINTF_FORMAT "] %s\n",
+        optDetailString(), rule, node, node->getOpCode().getName());
+}
+
+TR::Node *OMR::Simplifier::rewriteToNode(TR::Node *node, TR::Node *replacement)
+{
+    _alteredBlock = true;
+    return replaceNode(node, replacement, _curTree);
+}
+
+TR::Node *OMR::Simplifier::rewriteInPlace(TR::Node *node, TR::ILOpCodes op, int32_t numChildren, TR::Node *first,
+    TR::Node *second, TR::Node *third)
+{
+    TR::Node *newChildren[] = { first, second, third };
+    TR::Node *oldChildren[3];
+    int32_t numOldChildren = node->getNumChildren();
+    TR_ASSERT_FATAL(numChildren <= 3 && numOldChildren <= 3, "Rewrite rules handle at most three children");
+
+    // Reference the new children before releasing the old ones, which may be
+    // their parents
+    for (int32_t i = 0; i < numOldChildren; i++)
+        oldChildren[i] = node->getChild(i);
+
+    TR::Node::recreate(node, op);
+    node->setNumChildren(numChildren);
+    for (int32_t i = 0; i < numChildren; i++)
+        node->setAndIncChild(i, newChildren[i]);
+
+    for (int32_t i = 0; i < numOldChildren; i++)
+        oldChildren[i]->recursivelyDecReferenceCount();
+
+    _alteredBlock = true;
+    return node;
+}
+
 void OMR::Simplifier::anchorOrderDependentNodesInSubtree(TR::Node *node, TR::Node *replacement, TR::TreeTop *anchorTree)
 {
     if (node == replacement)
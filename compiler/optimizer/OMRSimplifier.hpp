@@ -274,6 +274,32 @@ public:
 
     virtual void postSimplification(TR::Node *node) {}
 
+    /**
+     * Checks whether any rewrite rule has a pattern rooted at the given opcode.
+     *
+     * This and applyRewriteRules are generated from OMRSimplifierRules.rules
+     * by tools/compiler/scripts/generateSimplifierRules.pl.
+     */
+    bool hasRewriteRules(TR::ILOpCodes op);
+
+    /**
+     * Applies the first rewrite rule that matches node. The children of node
+     * must already have been simplified.
+     *
+     * @param[in/out] node The tree node that is being checked and transformed
+     * @return Returns node if it was rewritten in place, the node that
+     * replaces it if it was replaced, or NULL if no rule applied
+     */
+    TR::Node *applyRewriteRules(TR::Node *node);
+
+    /**
+     * Support for the generated rewrite rules.
+     */
+    bool performRewrite(const char *rule, TR::Node *node);
+    TR::Node *rewriteToNode(TR::Node *node, TR::Node *replacement);
+    TR::Node *rewriteInPlace(TR::Node *node, TR::ILOpCodes op, int32_t numChildren, TR::Node *first,
+        TR::Node *second = NULL, TR::Node *third = NULL);
+
     TR::TreeTop *_curTree;
     TR_UseDefInfo *_useDefInfo; // Cached use/def info
     TR_ValueNumberInfo *_valueNumberInfo; // Cached value number info
@@ -284,6 +310,8 @@ public:
     bool _blockRemoved;
     bool _withReassociation;
     bool _enableFullReassociation;
+    bool _applyRewriteRules;
+    uint64_t _nodesVisited; // reported to TR::OptimizationStatistics
     TR_RegionStructure *_containingStructure;
     TR_HashTabInt _hashTable; // used by reassociation
     TR_HashTabInt _ccHashTab; // used by zEmulator
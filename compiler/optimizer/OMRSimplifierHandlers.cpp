@@ -9088,16 +9088,9 @@ TR::Node *inegSimplifier(TR::Node *node, TR::Block *block, TR::Simplifier *s)
         return node;
     }
 
+    // An ineg of an ineg is removed by the inegOfIneg rewrite rule
     TR::ILOpCodes opCode = firstChild->getOpCodeValue();
-    if (opCode == TR::ineg) {
-        if (performTransformation(s->comp(),
-                "%sCancelled out ineg with ineg child in node [" POINTER_PRINTF_FORMAT "]\n", s->optDetailString(),
-                node)) {
-            TR::Node *grandChild = firstChild->getFirstChild();
-            node = s->replaceNode(node, grandChild, s->_curTree);
-            s->_alteredBlock = true;
-        }
-    } else if (opCode == TR::isub) {
+    if (opCode == TR::isub) {
         if (performTransformation(s->comp(),
                 "%sReduced ineg with isub child in node [" POINTER_PRINTF_FORMAT "] to isub\n", s->optDetailString(),
                 node)) {
@@ -9141,27 +9134,8 @@ TR::Node *lnegSimplifier(TR::Node *node, TR::Block *block, TR::Simplifier *s)
         return node;
     }
 
-    TR::ILOpCodes opCode = firstChild->getOpCodeValue();
-    if (opCode == TR::lneg) {
-        if (performTransformation(s->comp(), "%sCancelled lneg with lneg child in node [" POINTER_PRINTF_FORMAT "]\n",
-                s->optDetailString(), node)) {
-            TR::Node *grandChild = firstChild->getFirstChild();
-            node = s->replaceNode(node, grandChild, s->_curTree);
-            s->_alteredBlock = true;
-        }
-    } else if (opCode == TR::lsub) {
-        if (performTransformation(s->comp(),
-                "%sReduced lneg with lsub child in node [" POINTER_PRINTF_FORMAT "]\n to lsub", s->optDetailString(),
-                node)) {
-            TR::Node::recreate(node, TR::lsub);
-            node->setNumChildren(2);
-            node->setAndIncChild(0, firstChild->getSecondChild());
-            node->setAndIncChild(1, firstChild->getFirstChild());
-            firstChild->recursivelyDecReferenceCount();
-            node->setVisitCount(0);
-            s->_alteredBlock = true;
-        }
-    }
+    // An lneg of an lneg or of an lsub is rewritten by the lnegOfLneg and
+    // lnegOfLsub rewrite rules
     return node;
 }
 
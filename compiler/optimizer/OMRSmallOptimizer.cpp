@@ -79,6 +79,7 @@
 #include "optimizer/LocalCSE.hpp"
 #include "optimizer/LocalDeadStoreElimination.hpp"
 #include "optimizer/LocalOpts.hpp"
+#include "optimizer/LoopAliasRefiner.hpp"
 #include "optimizer/LoopCanonicalizer.hpp"
 #include "optimizer/OrderBlocks.hpp"
 #include "optimizer/Simplifier.hpp"
@@ -89,9 +90,11 @@
 #include "optimizer/GlobalValuePropagation.hpp"
 #include "optimizer/LocalValuePropagation.hpp"
 #include "optimizer/RegDepCopyRemoval.hpp"
+#include "optimizer/AggregateEscapeAnalysis.hpp"
 #include "optimizer/GlobalRegisterAllocator.hpp"
 #include "optimizer/SwitchAnalyzer.hpp"
 #include "env/RegionProfiler.hpp"
+#include "optimizer/OptimizationStatistics.hpp"
 
 namespace TR {
 class AutomaticSymbol;
@@ -146,6 +149,7 @@ static const OptimizationStrategy smallWarmStrategyOpts[] = {
     { OMR::globalCopyPropagation },
     { OMR::globalDeadStoreElimination, OMR::IfMoreThanOneBlock },
     { OMR::deadTreesElimination },
+    { OMR::escapeAnalysis, OMR::IfEAOpportunities }, // after copy propagation has forwarded stored addresses
     { OMR::treeSimplification },
     { OMR::basicBlockHoisting },
     { OMR::treeSimplification },
@@ -175,11 +179,52 @@ static const OptimizationStrategy smallWarmStrategyOpts[] = {
     { OMR::endOpts },
 };
 
+static const OptimizationStrategy smallHotStrategyOpts[] = {
+    { OMR::deadTreesElimination },
+    { OMR::inlining },
+    { OMR::treeSimplification },
+    { OMR::localCSE },
+    { OMR::basicBlockOrdering }, // straighten goto's
+    { OMR::globalCopyPropagation },
+    { OMR::globalDeadStoreElimination, OMR::IfMoreThanOneBlock },
+    { OMR::deadTreesElimination },
+    { OMR::escapeAnalysis, OMR::IfEAOpportunities }, // after copy propagation has forwarded stored addresses
+    { OMR::treeSimplification },
+    { OMR::basicBlockHoisting },
+    { OMR::treeSimplification },
+    { OMR::globalValuePropagation, OMR::IfMoreThanOneBlock },
+    { OMR::localValuePropagation, OMR::IfOneBlock },
+    { OMR::switchAnalyzer },
+    { OMR::localCSE },
+    { OMR::treeSimplification },
+    { OMR::trivialDeadTreeRemoval, OMR::IfEnabled },
+    { OMR::basicBlockOrdering, OMR::IfLoops }, // clean up block order for loop canonicalization, if it will run
+    { OMR::loopCanonicalization,
+     OMR::IfLoops }, // canonicalization must run before inductionVariableAnalysis else indvar data gets messed up
+    { OMR::inductionVariableAnalysis, OMR::IfLoops },
+    { OMR::loopAliasRefiner, OMR::IfLoops }, // version loops to give each array its own alias set
+    { OMR::inductionVariableAnalysis, OMR::IfLoops }, // needed for loop unroller
+    { OMR::generalLoopUnroller, OMR::IfLoops },
+    { OMR::basicBlockExtension, OMR::MarkLastRun }, // clean up order and extend blocks now
+    { OMR::treeSimplification },
+    { OMR::localCSE },
+    { OMR::treeSimplification, OMR::IfEnabled },
+    { OMR::trivialDeadTreeRemoval, OMR::IfEnabled },
+    { OMR::cheapTacticalGlobalRegisterAllocatorGroup },
+    { OMR::globalDeadStoreGroup },
+    { OMR::redundantGotoElimination, OMR::IfEnabled }, // if global register allocator created new block
+    { OMR::rematerialization },
+    { OMR::deadTreesElimination, OMR::IfEnabled }, // remove dead anchors created by check/store removal
+    { OMR::deadTreesElimination, OMR::IfEnabled }, // remove dead RegStores produced by previous deadTrees pass
+    { OMR::regDepCopyRemoval },
+    { OMR::endOpts },
+};
+
 const OptimizationStrategy *smallOptimizationStrategies[] = {
     smallNoOptStrategyOpts,
     smallColdStrategyOpts,
     smallWarmStrategyOpts,
-    smallWarmStrategyOpts,
+    smallHotStrategyOpts,
 };
 
 void OMR::SmallOptimizer::useCustomStrategy(int32_t srcStrategySize, int32_t *srcStrategy)
@@ -269,6 +314,8 @@ OMR::SmallOptimizer::SmallOptimizer(TR::Compilation *comp, TR::ResolvedMethodSym
     _opts[OMR::localCSE] = new (comp->allocator()) TR::OptimizationManager(self(), TR::LocalCSE::create, OMR::localCSE);
     _opts[OMR::localDeadStoreElimination] = new (comp->allocator())
         TR::OptimizationManager(self(), TR::LocalDeadStoreElimination::create, OMR::localDeadStoreElimination);
+    _opts[OMR::loopAliasRefiner] = new (comp->allocator())
+        TR::OptimizationManager(self(), TR_LoopAliasRefiner::create, OMR::loopAliasRefiner);
     _opts[OMR::loopCanonicalization] = new (comp->allocator())
         TR::OptimizationManager(self(), TR_LoopCanonicalizer::create, OMR::loopCanonicalization);
     _opts[OMR::redundantGotoElimination] = new (comp->allocator())
@@ -293,6 +340,8 @@ OMR::SmallOptimizer::SmallOptimizer(TR::Compilation *comp, TR::ResolvedMethodSym
         TR::OptimizationManager(self(), TR_GlobalRegisterAllocator::create, OMR::tacticalGlobalRegisterAllocator);
     _opts[OMR::switchAnalyzer]
         = new (comp->allocator()) TR::OptimizationManager(self(), TR::SwitchAnalyzer::create, OMR::switchAnalyzer);
+    _opts[OMR::escapeAnalysis] = new (comp->allocator())
+        TR::OptimizationManager(self(), TR::AggregateEscapeAnalysis::create, OMR::escapeAnalysis);
     // NOTE: Please add new OMR optimizations here!
 
     // initialize OMR small optimization groups
@@ -964,6 +1013,7 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
     //
     // This is a real optimization.
     //
+    TR::OptimizationStatistics::MethodStatistics *optStats = TR::OptimizationStatistics::methodStatistics(comp());
     TR::RegionProfiler rp(comp()->trMemory()->heapMemoryRegion(), *comp(), "opt/%s/%s",
         comp()->getHotnessName(comp()->getMethodHotness()), getOptimizationName(optNum));
 
@@ -1264,6 +1314,7 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
         int32_t origNodeCount = comp()->getNodeCount();
         int32_t origCfgNodeCount = comp()->getFlowGraph()->getNextNodeNumber();
         int32_t origOptMsgIndex = self()->getOptMessageIndex();
+        uint64_t optStartTicks = optStats ? TR::Compiler->vm.getHighResClock(comp()) : 0;
 
         if (comp()->isOutermostMethod() && (comp()->getFlowGraph()->getMaxFrequency() < 0)
             && !manager->getDoNotSetFrequencies()) {
@@ -1398,6 +1449,16 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
         if (comp()->getFlowGraph()->getMightHaveUnreachableBlocks())
             comp()->getFlowGraph()->removeUnreachableBlocks();
 
+        if (optStats) {
+            TR::OptimizationPassStatistics &passStats = optStats->pass(optNum);
+            passStats._invocations++;
+            passStats._elapsedTicks += TR::Compiler->vm.getHighResClock(comp()) - optStartTicks;
+            passStats._regionBytesAllocated += rp.regionBytesAllocated();
+            passStats._segmentBytesAllocated += rp.segmentBytesAllocated();
+            passStats._nodeCountDelta += (int64_t)comp()->getNodeCount() - origNodeCount;
+            passStats._transformations += finalOptMsgIndex - origOptMsgIndex;
+        }
+
 #ifdef OPT_TIMING
         if (doTiming) {
             myTimer.stopTiming(comp());
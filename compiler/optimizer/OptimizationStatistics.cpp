@@ -0,0 +1,311 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/OptimizationStatistics.hpp"
+
+#include <new>
+#include <stdio.h>
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentAllocator.hpp"
+#include "env/Region.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include "optimizer/Optimizer.hpp"
+
+TR::OptimizationStatistics *TR::OptimizationStatistics::_instance = NULL;
+
+namespace {
+
+bool hasSuffix(const char *s, const char *suffix)
+{
+    size_t length = strlen(s);
+    size_t suffixLength = strlen(suffix);
+    return length >= suffixLength && strcmp(s + length - suffixLength, suffix) == 0;
+}
+
+double microseconds(uint64_t ticks, uint64_t ticksPerSecond)
+{
+    return ticksPerSecond ? (double)ticks * 1000000.0 / (double)ticksPerSecond : 0.0;
+}
+
+/**
+ * Write a string as a double-quoted CSV field, doubling embedded quotes.
+ */
+void printCSVString(::FILE *file, const char *s)
+{
+    fputc('"', file);
+    for (; *s; s++) {
+        if (*s == '"')
+            fputc('"', file);
+        fputc(*s, file);
+    }
+    fputc('"', file);
+}
+
+void printJSONString(::FILE *file, const char *s)
+{
+    fputc('"', file);
+    for (; *s; s++) {
+        unsigned char c = static_cast<unsigned char>(*s);
+        if (c == '"' || c == '\\')
+            fprintf(file, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(file, "\\u%04x", c);
+        else
+            fputc(c, file);
+    }
+    fputc('"', file);
+}
+
+void printCSVRow(::FILE *file, const char *scope, const char *method, const char *hotness, const char *optimization,
+    const TR::OptimizationPassStatistics &stats, uint64_t ticksPerSecond)
+{
+    fprintf(file, "%s,", scope);
+    printCSVString(file, method);
+    fprintf(file, ",%s,%s,%llu,%.3f,%llu,%llu,%lld,%llu,%llu\n", hotness, optimization,
+        (unsigned long long)stats._invocations, microseconds(stats._elapsedTicks, ticksPerSecond),
+        (unsigned long long)stats._regionBytesAllocated, (unsigned long long)stats._segmentBytesAllocated,
+        (long long)stats._nodeCountDelta, (unsigned long long)stats._transformations,
+        (unsigned long long)stats._nodesVisited);
+}
+
+void printJSONPass(::FILE *file, const char *indent, const char *optimization,
+    const TR::OptimizationPassStatistics &stats, uint64_t ticksPerSecond)
+{
+    fprintf(file,
+        "%s{\"optimization\": \"%s\", \"invocations\": %llu, \"timeUs\": %.3f, \"regionBytes\": %llu, "
+        "\"segmentBytes\": %llu, \"nodeCountDelta\": %lld, \"transformations\": %llu, \"nodesVisited\": %llu}",
+        indent, optimization, (unsigned long long)stats._invocations, microseconds(stats._elapsedTicks, ticksPerSecond),
+        (unsigned long long)stats._regionBytesAllocated, (unsigned long long)stats._segmentBytesAllocated,
+        (long long)stats._nodeCountDelta, (unsigned long long)stats._transformations,
+        (unsigned long long)stats._nodesVisited);
+}
+
+} // namespace
+
+TR::OptimizationStatistics::MethodStatistics::MethodStatistics() {}
+
+TR::OptimizationStatistics::OptimizationStatistics(const char *fileName, TR::Monitor *monitor)
+    : _fileName(fileName)
+    , _monitor(monitor)
+    , _ticksPerSecond(TR::Compiler->vm.getHighResClockResolution())
+    , _firstMethod(NULL)
+    , _lastMethod(NULL)
+{
+    memset(_methodsCompiled, 0, sizeof(_methodsCompiled));
+}
+
+bool TR::OptimizationStatistics::initialize(const char *fileName)
+{
+    if (fileName == NULL || _instance != NULL)
+        return true;
+
+    TR::Monitor *monitor = TR::Monitor::create("JIT-OptimizationStatisticsMonitor");
+    if (!monitor)
+        return false;
+
+    void *storage = TR::Compiler->persistentAllocator().allocate(sizeof(TR::OptimizationStatistics), std::nothrow);
+    if (!storage) {
+        TR::Monitor::destroy(monitor);
+        return false;
+    }
+
+    _instance = new (storage) TR::OptimizationStatistics(fileName, monitor);
+    return true;
+}
+
+void TR::OptimizationStatistics::shutdown()
+{
+    TR::OptimizationStatistics *stats = _instance;
+    if (!stats)
+        return;
+
+    _instance = NULL;
+    stats->dump();
+    stats->freeMethodRecords();
+    TR::Monitor::destroy(stats->_monitor);
+    stats->~OptimizationStatistics();
+    TR::Compiler->persistentAllocator().deallocate(stats);
+}
+
+TR::OptimizationStatistics::MethodStatistics *TR::OptimizationStatistics::methodStatistics(TR::Compilation *comp)
+{
+    if (!_instance)
+        return NULL;
+
+    MethodStatistics *stats = comp->getOptimizationStatistics();
+    if (!stats) {
+        stats = new (comp->region()) MethodStatistics();
+        comp->setOptimizationStatistics(stats);
+    }
+    return stats;
+}
+
+void TR::OptimizationStatistics::methodCompleted(TR::Compilation *comp, MethodStatistics *stats)
+{
+    uint32_t numPasses = 0;
+    for (int32_t i = 0; i < OMR::numOpts; i++) {
+        if (stats->_passes[i]._invocations > 0)
+            numPasses++;
+    }
+
+    TR_Hotness hotness = comp->getMethodHotness();
+    if (hotness < minHotness || hotness >= numHotnessLevels)
+        hotness = unknownHotness;
+
+    // The record is allocated outside the critical section. If persistent
+    // memory is exhausted the method still counts towards the process totals.
+    //
+    TR::PersistentAllocator &allocator = TR::Compiler->persistentAllocator();
+    const char *signature = comp->signature() ? comp->signature() : "";
+    size_t signatureSize = strlen(signature) + 1;
+    size_t size = sizeof(MethodRecord) + numPasses * (sizeof(OptimizationPassStatistics) + sizeof(OMR::Optimizations))
+        + signatureSize;
+    MethodRecord *record = static_cast<MethodRecord *>(allocator.allocate(size, std::nothrow));
+    if (record) {
+        record->_next = NULL;
+        record->_hotness = hotness;
+        record->_numPasses = numPasses;
+        record->_passes = reinterpret_cast<OptimizationPassStatistics *>(record + 1);
+        record->_optimizations = reinterpret_cast<OMR::Optimizations *>(record->_passes + numPasses);
+        record->_signature = reinterpret_cast<char *>(record->_optimizations + numPasses);
+        memcpy(record->_signature, signature, signatureSize);
+
+        uint32_t pass = 0;
+        for (int32_t i = 0; i < OMR::numOpts; i++) {
+            if (stats->_passes[i]._invocations > 0) {
+                record->_optimizations[pass] = static_cast<OMR::Optimizations>(i);
+                record->_passes[pass] = stats->_passes[i];
+                pass++;
+            }
+        }
+    }
+
+    OMR::CriticalSection methodCompletedCS(_monitor);
+
+    for (int32_t i = 0; i < OMR::numOpts; i++) {
+        if (stats->_passes[i]._invocations > 0)
+            _processTotals[hotness][i].accumulate(stats->_passes[i]);
+    }
+    _methodsCompiled[hotness]++;
+
+    if (record) {
+        if (_lastMethod)
+            _lastMethod->_next = record;
+        else
+            _firstMethod = record;
+        _lastMethod = record;
+    }
+}
+
+void TR::OptimizationStatistics::freeMethodRecords()
+{
+    MethodRecord *record = _firstMethod;
+    while (record) {
+        MethodRecord *next = record->_next;
+        TR::Compiler->persistentAllocator().deallocate(record);
+        record = next;
+    }
+    _firstMethod = NULL;
+    _lastMethod = NULL;
+}
+
+void TR::OptimizationStatistics::dump()
+{
+    ::FILE *file = fopen(_fileName, "w");
+    if (!file) {
+        fprintf(stderr, "JIT: unable to open optimization statistics file %s\n", _fileName);
+        return;
+    }
+
+    if (hasSuffix(_fileName, ".json"))
+        dumpJSON(file);
+    else
+        dumpCSV(file);
+
+    fclose(file);
+}
+
+void TR::OptimizationStatistics::dumpCSV(::FILE *file)
+{
+    fprintf(file, "scope,method,hotness,optimization,invocations,timeUs,regionBytes,segmentBytes,nodeCountDelta,"
+                  "transformations,nodesVisited\n");
+
+    for (int32_t h = 0; h < numHotnessLevels; h++) {
+        for (int32_t i = 0; i < OMR::numOpts; i++) {
+            if (_processTotals[h][i]._invocations > 0)
+                printCSVRow(file, "process", "", TR::Compilation::getHotnessName(static_cast<TR_Hotness>(h)),
+                    TR::Optimizer::getOptimizationName(static_cast<OMR::Optimizations>(i)), _processTotals[h][i],
+                    _ticksPerSecond);
+        }
+    }
+
+    for (MethodRecord *record = _firstMethod; record; record = record->_next) {
+        const char *hotness = TR::Compilation::getHotnessName(record->_hotness);
+        for (uint32_t p = 0; p < record->_numPasses; p++)
+            printCSVRow(file, "method", record->_signature, hotness,
+                TR::Optimizer::getOptimizationName(record->_optimizations[p]), record->_passes[p], _ticksPerSecond);
+    }
+}
+
+void TR::OptimizationStatistics::dumpJSON(::FILE *file)
+{
+    fprintf(file, "{\n  \"clockResolution\": %llu,\n  \"process\": [", (unsigned long long)_ticksPerSecond);
+
+    bool firstHotness = true;
+    for (int32_t h = 0; h < numHotnessLevels; h++) {
+        if (_methodsCompiled[h] == 0)
+            continue;
+
+        fprintf(file, "%s\n    {\"hotness\": \"%s\", \"methods\": %llu, \"passes\": [", firstHotness ? "" : ",",
+            TR::Compilation::getHotnessName(static_cast<TR_Hotness>(h)), (unsigned long long)_methodsCompiled[h]);
+        firstHotness = false;
+
+        bool firstPass = true;
+        for (int32_t i = 0; i < OMR::numOpts; i++) {
+            if (_processTotals[h][i]._invocations == 0)
+                continue;
+            fprintf(file, "%s\n", firstPass ? "" : ",");
+            printJSONPass(file, "      ", TR::Optimizer::getOptimizationName(static_cast<OMR::Optimizations>(i)),
+                _processTotals[h][i], _ticksPerSecond);
+            firstPass = false;
+        }
+        fprintf(file, "\n    ]}");
+    }
+
+    fprintf(file, "\n  ],\n  \"methods\": [");
+
+    for (MethodRecord *record = _firstMethod; record; record = record->_next) {
+        fprintf(file, "%s\n    {\"method\": ", record == _firstMethod ? "" : ",");
+        printJSONString(file, record->_signature);
+        fprintf(file, ", \"hotness\": \"%s\", \"passes\": [", TR::Compilation::getHotnessName(record->_hotness));
+        for (uint32_t p = 0; p < record->_numPasses; p++) {
+            fprintf(file, "%s\n", p == 0 ? "" : ",");
+            printJSONPass(file, "      ", TR::Optimizer::getOptimizationName(record->_optimizations[p]),
+                record->_passes[p], _ticksPerSecond);
+        }
+        fprintf(file, "\n    ]}");
+    }
+
+    fprintf(file, "\n  ]\n}\n");
+}
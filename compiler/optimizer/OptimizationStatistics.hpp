@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OPTIMIZATIONSTATISTICS_HPP
+#define OPTIMIZATIONSTATISTICS_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "compile/CompilationTypes.hpp"
+#include "optimizer/Optimizations.hpp"
+
+namespace TR {
+class Compilation;
+class Monitor;
+} // namespace TR
+
+namespace TR {
+
+/**
+ * Cost of one optimization pass, summed over all the times it ran.
+ */
+struct OptimizationPassStatistics {
+    OptimizationPassStatistics()
+        : _invocations(0)
+        , _elapsedTicks(0)
+        , _regionBytesAllocated(0)
+        , _segmentBytesAllocated(0)
+        , _nodeCountDelta(0)
+        , _transformations(0)
+        , _nodesVisited(0)
+    {}
+
+    void accumulate(const OptimizationPassStatistics &other)
+    {
+        _invocations += other._invocations;
+        _elapsedTicks += other._elapsedTicks;
+        _regionBytesAllocated += other._regionBytesAllocated;
+        _segmentBytesAllocated += other._segmentBytesAllocated;
+        _nodeCountDelta += other._nodeCountDelta;
+        _transformations += other._transformations;
+        _nodesVisited += other._nodesVisited;
+    }
+
+    uint64_t _invocations;
+
+    /// Wall time, in units of TR::Compiler->vm.getHighResClockResolution()
+    uint64_t _elapsedTicks;
+
+    /// Growth of the compilation's heap memory region
+    uint64_t _regionBytesAllocated;
+
+    /// Growth of the segment provider backing the compilation, which includes
+    /// scratch memory taken by the optimization's stack memory regions
+    uint64_t _segmentBytesAllocated;
+
+    int64_t _nodeCountDelta;
+
+    /// Number of performTransformation calls made by the pass
+    uint64_t _transformations;
+
+    /// Number of nodes the pass examined, for passes that count them
+    uint64_t _nodesVisited;
+};
+
+/**
+ * Per-optimization compile time and memory accounting.
+ *
+ * When the optStatsFile=<filename> option is given, the optimizer records an
+ * OptimizationPassStatistics for every optimization pass it performs. The
+ * records are first collected per compilation in the compilation's heap
+ * region. When the compilation ends they are added to the process-wide totals
+ * (one set per hotness level) and kept as a per-method record. Everything is
+ * written to the file at shutdown, as JSON if the file name ends in ".json"
+ * and as CSV otherwise.
+ *
+ * The per-pass cost when the facility is disabled is a single null check.
+ */
+class OptimizationStatistics {
+public:
+    /**
+     * Per-compilation collector, allocated in the compilation's heap region.
+     */
+    class MethodStatistics {
+    public:
+        MethodStatistics();
+
+        OptimizationPassStatistics &pass(OMR::Optimizations opt) { return _passes[opt]; }
+
+    private:
+        friend class OptimizationStatistics;
+        OptimizationPassStatistics _passes[OMR::numOpts];
+    };
+
+    /**
+     * Create the process-wide instance. Does nothing if fileName is NULL.
+     * Returns false if the instance could not be created.
+     */
+    static bool initialize(const char *fileName);
+
+    /**
+     * Write the collected statistics to the file and free the process-wide
+     * instance. Safe to call when the facility was never initialized.
+     */
+    static void shutdown();
+
+    static OptimizationStatistics *instance() { return _instance; }
+
+    /**
+     * Return the collector for the given compilation, creating it on first
+     * use. Returns NULL when the facility is disabled.
+     */
+    static MethodStatistics *methodStatistics(TR::Compilation *comp);
+
+    /**
+     * Add the compilation's records to the process-wide statistics. Called
+     * once when the compilation ends, whether or not it succeeded.
+     */
+    void methodCompleted(TR::Compilation *comp, MethodStatistics *stats);
+
+private:
+    struct MethodRecord {
+        MethodRecord *_next;
+        char *_signature;
+        TR_Hotness _hotness;
+        uint32_t _numPasses;
+        OMR::Optimizations *_optimizations;
+        OptimizationPassStatistics *_passes;
+    };
+
+    OptimizationStatistics(const char *fileName, TR::Monitor *monitor);
+
+    void freeMethodRecords();
+
+    void dump();
+    void dumpCSV(::FILE *file);
+    void dumpJSON(::FILE *file);
+
+    static OptimizationStatistics *_instance;
+
+    const char *_fileName;
+    TR::Monitor *_monitor;
+    uint64_t _ticksPerSecond;
+
+    OptimizationPassStatistics _processTotals[numHotnessLevels][OMR::numOpts];
+    uint64_t _methodsCompiled[numHotnessLevels];
+
+    MethodRecord *_firstMethod;
+    MethodRecord *_lastMethod;
+};
+
+} // namespace TR
+
+#endif
@@ -48,6 +48,9 @@
 #include "infra/List.hpp"
 #include "infra/CfgEdge.hpp"
 #include "infra/CfgNode.hpp"
+#include "infra/map.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/LocalOpts.hpp"
 #include "optimizer/Optimization_inlines.hpp"
 #include "optimizer/OptimizationManager.hpp"
 #include "optimizer/Optimizations.hpp"
@@ -1656,6 +1659,581 @@ void TR_OrderBlocks::generateNewOrder(TR_BlockList &newBlockOrder)
     TR_ASSERT(_coldPathList.isEmpty(), "Error: blocks left on cold path list");
 }
 
+/*
+ * Ext-TSP block layout
+ * ====================
+ *
+ * Global block layout in the style of Pettis-Hansen chain merging, scored
+ * with the Extended TSP objective (Newell and Pupyrev, "Improved Basic Block
+ * Reordering"). Every hot block starts in its own chain. Chains are merged
+ * greedily, always picking the merge with the best gain in
+ *
+ *    sum over edges (src,dst) of weight(src,dst) * k(distance)
+ *
+ * where k is 1 for a fall-through, decays linearly with the distance of short
+ * forward and backward jumps, and is 0 for long jumps. Unlike the local
+ * heuristics in generateNewOrder this takes every edge of the method into
+ * account, so it also optimizes for i-cache locality.
+ *
+ * Blocks that cold block outlining would move away are kept out of the chains
+ * entirely and appended after all hot chains in their original order.
+ */
+namespace {
+
+class ExtTSPLayout {
+public:
+    ExtTSPLayout(TR::Compilation *comp, TR::Region &region, bool trace)
+        : _comp(comp)
+        , _trace(trace)
+        , _blocks(region)
+        , _edges(region)
+        , _chains(region)
+        , _blockIndex(region)
+        , _offsets(region)
+        , _gainCache(region)
+        , _region(region)
+        , _work(0)
+    {}
+
+    bool buildGraph(int32_t maxBlocks);
+    void mergeChains(int64_t workBudget);
+    void generateOrder(TR_BlockList &newBlockOrder);
+
+    int32_t numHotBlocks() const { return _numHotBlocks; }
+
+    int64_t work() const { return _work; }
+
+private:
+    // Tuning parameters of the Ext-TSP objective; the same values as used by LLVM's CodeLayout
+    static const int32_t FORWARD_DISTANCE = 1024;
+    static const int32_t BACKWARD_DISTANCE = 640;
+    static const int32_t MAX_SPLIT_CHAIN_LENGTH = 128;
+    static const int32_t BYTES_PER_TREE = 8;
+
+    struct LayoutBlock {
+        TR::Block *_block;
+        int32_t _size; // estimated code size in bytes
+        int64_t _frequency;
+        int32_t _chain;
+        bool _hot;
+        bool _gluedToPrevious; // must stay immediately after the previous block in original order
+    };
+
+    struct LayoutEdge {
+        int32_t _src;
+        int32_t _dst;
+        int64_t _weight;
+    };
+
+    struct LayoutChain {
+        LayoutChain(TR::Region &region)
+            : _blocks(region)
+            , _edges(region)
+            , _score(0.0)
+            , _frequency(0)
+            , _size(0)
+            , _version(0)
+            , _alive(true)
+            , _hasEntry(false)
+        {}
+
+        TR::vector<int32_t, TR::Region &> _blocks;
+        TR::vector<int32_t, TR::Region &> _edges; // edges with at least one end in this chain
+        double _score;
+        int64_t _frequency;
+        int64_t _size;
+        int32_t _version;
+        bool _alive;
+        bool _hasEntry;
+    };
+
+    enum MergeKind {
+        mergeXY, // X Y
+        mergeYX, // Y X
+        mergeX1YX2 // X[0, split) Y X[split, end)
+    };
+
+    struct MergeGain {
+        MergeGain()
+            : _gain(0.0)
+            , _kind(mergeXY)
+            , _split(0)
+            , _xVersion(-1)
+            , _yVersion(-1)
+        {}
+
+        double _gain;
+        MergeKind _kind;
+        int32_t _split;
+        int32_t _xVersion;
+        int32_t _yVersion;
+    };
+
+    static double edgeScore(int64_t srcEnd, int64_t dstOffset, int64_t weight);
+
+    MergeGain computeMergeGain(int32_t x, int32_t y);
+    double scoreOfMerge(int32_t x, int32_t y, MergeKind kind, int32_t split);
+    void applyMerge(int32_t x, int32_t y, const MergeGain &gain);
+    void appendSegment(TR::vector<int32_t, TR::Region &> &to, const TR::vector<int32_t, TR::Region &> &from,
+        int32_t begin, int32_t end);
+    bool canSplitAt(int32_t chain, int32_t split);
+
+    TR::Compilation *_comp;
+    bool _trace;
+    int32_t _numHotBlocks;
+
+    TR::vector<LayoutBlock, TR::Region &> _blocks; // in original tree order
+    TR::vector<LayoutEdge, TR::Region &> _edges;
+    TR::vector<LayoutChain *, TR::Region &> _chains;
+    TR::vector<int32_t, TR::Region &> _blockIndex; // block number -> index in _blocks
+    TR::vector<int64_t, TR::Region &> _offsets; // scratch for scoring candidate merges
+    TR::map<std::pair<int32_t, int32_t>, MergeGain> _gainCache;
+    TR::Region &_region;
+
+    int64_t _work; // units of work done, checked against the compile-time budget
+};
+
+double ExtTSPLayout::edgeScore(int64_t srcEnd, int64_t dstOffset, int64_t weight)
+{
+    if (srcEnd == dstOffset)
+        return static_cast<double>(weight);
+
+    if (srcEnd < dstOffset) {
+        int64_t distance = dstOffset - srcEnd;
+        if (distance <= FORWARD_DISTANCE)
+            return 0.1 * weight * (1.0 - static_cast<double>(distance) / FORWARD_DISTANCE);
+    } else {
+        int64_t distance = srcEnd - dstOffset;
+        if (distance <= BACKWARD_DISTANCE)
+            return 0.1 * weight * (1.0 - static_cast<double>(distance) / BACKWARD_DISTANCE);
+    }
+
+    return 0.0;
+}
+
+bool ExtTSPLayout::buildGraph(int32_t maxBlocks)
+{
+    TR::CFG *cfg = _comp->getFlowGraph();
+    _blockIndex.assign(cfg->getNextNodeNumber(), -1);
+    _numHotBlocks = 0;
+
+    TR::Block *entryBlock = _comp->getStartBlock();
+    for (TR::Block *block = entryBlock; block; block = block->getNextBlock()) {
+        LayoutBlock layoutBlock;
+        layoutBlock._block = block;
+        layoutBlock._size = (block->getNumberOfRealTreeTops() + 1) * BYTES_PER_TREE;
+        layoutBlock._frequency = std::max<int32_t>(block->getFrequency(), 0);
+        layoutBlock._hot = block == entryBlock || !TR_ColdBlockOutlining::isOutliningCandidate(block, _comp);
+        layoutBlock._gluedToPrevious = block->isExtensionOfPreviousBlock() && block != entryBlock;
+        layoutBlock._chain = -1;
+
+        _blockIndex[block->getNumber()] = static_cast<int32_t>(_blocks.size());
+        _blocks.push_back(layoutBlock);
+    }
+
+    // An extended block has to be placed or outlined as a whole, so it is hot if any part of it is
+    for (size_t i = _blocks.size(); i-- > 1;) {
+        if (_blocks[i]._gluedToPrevious && _blocks[i]._hot)
+            _blocks[i - 1]._hot = true;
+    }
+    for (size_t i = 1; i < _blocks.size(); i++) {
+        if (_blocks[i]._gluedToPrevious && _blocks[i - 1]._hot)
+            _blocks[i]._hot = true;
+    }
+
+    for (size_t i = 0; i < _blocks.size(); i++) {
+        if (_blocks[i]._hot)
+            _numHotBlocks++;
+    }
+
+    if (_numHotBlocks > maxBlocks)
+        return false;
+
+    // Initial chains: one per hot block, or one per run of blocks glued together by block extension
+    for (size_t i = 0; i < _blocks.size(); i++) {
+        LayoutBlock &layoutBlock = _blocks[i];
+        if (!layoutBlock._hot)
+            continue;
+
+        if (layoutBlock._gluedToPrevious && i > 0) {
+            layoutBlock._chain = _blocks[i - 1]._chain;
+        } else {
+            layoutBlock._chain = static_cast<int32_t>(_chains.size());
+            _chains.push_back(new (_region) LayoutChain(_region));
+        }
+
+        LayoutChain *chain = _chains[layoutBlock._chain];
+        chain->_blocks.push_back(static_cast<int32_t>(i));
+        chain->_frequency += layoutBlock._frequency;
+        chain->_size += layoutBlock._size;
+        if (i == 0)
+            chain->_hasEntry = true;
+    }
+
+    for (size_t i = 0; i < _blocks.size(); i++) {
+        if (!_blocks[i]._hot)
+            continue;
+
+        TR::Block *block = _blocks[i]._block;
+        TR::CFGEdgeList &successors = block->getSuccessors();
+        for (auto edgeIt = successors.begin(); edgeIt != successors.end(); ++edgeIt) {
+            TR::CFGNode *to = (*edgeIt)->getTo();
+            int32_t dst = _blockIndex[to->getNumber()];
+            if (dst < 0 || !_blocks[dst]._hot)
+                continue;
+
+            // Prefer the profiled edge frequency; estimate it from the block frequencies otherwise
+            int64_t weight = (*edgeIt)->getFrequency();
+            if (weight <= 0)
+                weight = std::min(_blocks[i]._frequency, _blocks[dst]._frequency);
+            if (weight <= 0)
+                continue;
+
+            LayoutEdge edge;
+            edge._src = static_cast<int32_t>(i);
+            edge._dst = dst;
+            edge._weight = weight;
+
+            int32_t edgeIndex = static_cast<int32_t>(_edges.size());
+            _edges.push_back(edge);
+            _chains[_blocks[i]._chain]->_edges.push_back(edgeIndex);
+            if (_blocks[dst]._chain != _blocks[i]._chain)
+                _chains[_blocks[dst]._chain]->_edges.push_back(edgeIndex);
+        }
+    }
+
+    _offsets.assign(_blocks.size(), 0);
+
+    // Score the initial chains; glued runs already contribute their fall-throughs
+    for (size_t c = 0; c < _chains.size(); c++) {
+        LayoutChain *chain = _chains[c];
+        int64_t offset = 0;
+        for (size_t b = 0; b < chain->_blocks.size(); b++) {
+            _offsets[chain->_blocks[b]] = offset;
+            offset += _blocks[chain->_blocks[b]]._size;
+        }
+        for (size_t e = 0; e < chain->_edges.size(); e++) {
+            const LayoutEdge &edge = _edges[chain->_edges[e]];
+            if (_blocks[edge._src]._chain == (int32_t)c && _blocks[edge._dst]._chain == (int32_t)c)
+                chain->_score
+                    += edgeScore(_offsets[edge._src] + _blocks[edge._src]._size, _offsets[edge._dst], edge._weight);
+        }
+    }
+
+    return true;
+}
+
+bool ExtTSPLayout::canSplitAt(int32_t chain, int32_t split)
+{
+    // Splitting between an extended block and its predecessor would break the extension
+    return !_blocks[_chains[chain]->_blocks[split]]._gluedToPrevious;
+}
+
+void ExtTSPLayout::appendSegment(TR::vector<int32_t, TR::Region &> &to, const TR::vector<int32_t, TR::Region &> &from,
+    int32_t begin, int32_t end)
+{
+    for (int32_t i = begin; i < end; i++)
+        to.push_back(from[i]);
+}
+
+double ExtTSPLayout::scoreOfMerge(int32_t x, int32_t y, MergeKind kind, int32_t split)
+{
+    LayoutChain *chainX = _chains[x];
+    LayoutChain *chainY = _chains[y];
+    int32_t lengthX = static_cast<int32_t>(chainX->_blocks.size());
+    int32_t lengthY = static_cast<int32_t>(chainY->_blocks.size());
+
+    // Lay out the merged chain by assigning offsets to its blocks
+    const TR::vector<int32_t, TR::Region &> *segments[3];
+    int32_t begins[3], ends[3];
+    int32_t numSegments = 0;
+    switch (kind) {
+        case mergeXY:
+            segments[0] = &chainX->_blocks, begins[0] = 0, ends[0] = lengthX;
+            segments[1] = &chainY->_blocks, begins[1] = 0, ends[1] = lengthY;
+            numSegments = 2;
+            break;
+        case mergeYX:
+            segments[0] = &chainY->_blocks, begins[0] = 0, ends[0] = lengthY;
+            segments[1] = &chainX->_blocks, begins[1] = 0, ends[1] = lengthX;
+            numSegments = 2;
+            break;
+        case mergeX1YX2:
+            segments[0] = &chainX->_blocks, begins[0] = 0, ends[0] = split;
+            segments[1] = &chainY->_blocks, begins[1] = 0, ends[1] = lengthY;
+            segments[2] = &chainX->_blocks, begins[2] = split, ends[2] = lengthX;
+            numSegments = 3;
+            break;
+    }
+
+    int64_t offset = 0;
+    for (int32_t s = 0; s < numSegments; s++) {
+        for (int32_t i = begins[s]; i < ends[s]; i++) {
+            int32_t block = (*segments[s])[i];
+            _offsets[block] = offset;
+            offset += _blocks[block]._size;
+        }
+    }
+
+    // Edges between X and Y are on both edge lists; count them from X only
+    double score = 0.0;
+    for (size_t e = 0; e < chainX->_edges.size(); e++) {
+        const LayoutEdge &edge = _edges[chainX->_edges[e]];
+        int32_t srcChain = _blocks[edge._src]._chain;
+        int32_t dstChain = _blocks[edge._dst]._chain;
+        if ((srcChain == x || srcChain == y) && (dstChain == x || dstChain == y))
+            score += edgeScore(_offsets[edge._src] + _blocks[edge._src]._size, _offsets[edge._dst], edge._weight);
+    }
+    for (size_t e = 0; e < chainY->_edges.size(); e++) {
+        const LayoutEdge &edge = _edges[chainY->_edges[e]];
+        if (_blocks[edge._src]._chain == y && _blocks[edge._dst]._chain == y)
+            score += edgeScore(_offsets[edge._src] + _blocks[edge._src]._size, _offsets[edge._dst], edge._weight);
+    }
+
+    _work += lengthX + lengthY + chainX->_edges.size() + chainY->_edges.size();
+    return score;
+}
+
+ExtTSPLayout::MergeGain ExtTSPLayout::computeMergeGain(int32_t x, int32_t y)
+{
+    LayoutChain *chainX = _chains[x];
+    LayoutChain *chainY = _chains[y];
+    double currentScore = chainX->_score + chainY->_score;
+
+    MergeGain best;
+    best._xVersion = chainX->_version;
+    best._yVersion = chainY->_version;
+
+    // The method entry must stay at the front of its chain
+    if (!chainY->_hasEntry) {
+        double gain = scoreOfMerge(x, y, mergeXY, 0) - currentScore;
+        if (gain > best._gain) {
+            best._gain = gain;
+            best._kind = mergeXY;
+        }
+    }
+
+    if (!chainX->_hasEntry) {
+        double gain = scoreOfMerge(x, y, mergeYX, 0) - currentScore;
+        if (gain > best._gain) {
+            best._gain = gain;
+            best._kind = mergeYX;
+        }
+    }
+
+    int32_t lengthX = static_cast<int32_t>(chainX->_blocks.size());
+    if (lengthX <= MAX_SPLIT_CHAIN_LENGTH) {
+        for (int32_t split = 1; split < lengthX; split++) {
+            if (!canSplitAt(x, split))
+                continue;
+
+            double gain = scoreOfMerge(x, y, mergeX1YX2, split) - currentScore;
+            if (gain > best._gain) {
+                best._gain = gain;
+                best._kind = mergeX1YX2;
+                best._split = split;
+            }
+        }
+    }
+
+    return best;
+}
+
+void ExtTSPLayout::applyMerge(int32_t x, int32_t y, const MergeGain &gain)
+{
+    LayoutChain *chainX = _chains[x];
+    LayoutChain *chainY = _chains[y];
+    int32_t lengthX = static_cast<int32_t>(chainX->_blocks.size());
+    int32_t lengthY = static_cast<int32_t>(chainY->_blocks.size());
+
+    TR::vector<int32_t, TR::Region &> merged(_region);
+    merged.reserve(lengthX + lengthY);
+    switch (gain._kind) {
+        case mergeXY:
+            appendSegment(merged, chainX->_blocks, 0, lengthX);
+            appendSegment(merged, chainY->_blocks, 0, lengthY);
+            break;
+        case mergeYX:
+            appendSegment(merged, chainY->_blocks, 0, lengthY);
+            appendSegment(merged, chainX->_blocks, 0, lengthX);
+            break;
+        case mergeX1YX2:
+            appendSegment(merged, chainX->_blocks, 0, gain._split);
+            appendSegment(merged, chainY->_blocks, 0, lengthY);
+            appendSegment(merged, chainX->_blocks, gain._split, lengthX);
+            break;
+    }
+
+    if (_trace)
+        _comp->log()->printf("\tExt-TSP: merging chain %d (block_%d...) with chain %d (block_%d...), kind %d, gain %.2f\n",
+            x, _blocks[chainX->_blocks[0]]._block->getNumber(), y, _blocks[chainY->_blocks[0]]._block->getNumber(),
+            gain._kind, gain._gain);
+
+    // Edges between X and Y are already on X's list
+    for (size_t e = 0; e < chainY->_edges.size(); e++) {
+        const LayoutEdge &edge = _edges[chainY->_edges[e]];
+        if (_blocks[edge._src]._chain != x && _blocks[edge._dst]._chain != x)
+            chainX->_edges.push_back(chainY->_edges[e]);
+    }
+
+    chainX->_blocks.swap(merged);
+    for (int32_t i = 0; i < lengthY; i++)
+        _blocks[chainY->_blocks[i]]._chain = x;
+
+    chainX->_score += chainY->_score + gain._gain;
+    chainX->_frequency += chainY->_frequency;
+    chainX->_size += chainY->_size;
+    chainX->_hasEntry = chainX->_hasEntry || chainY->_hasEntry;
+    chainX->_version++;
+
+    chainY->_alive = false;
+    chainY->_blocks.clear();
+    chainY->_edges.clear();
+}
+
+void ExtTSPLayout::mergeChains(int64_t workBudget)
+{
+    TR::vector<int32_t, TR::Region &> visited(_chains.size(), -1, _region);
+
+    while (true) {
+        int32_t bestX = -1, bestY = -1;
+        MergeGain best;
+
+        for (int32_t x = 0; x < (int32_t)_chains.size(); x++) {
+            LayoutChain *chainX = _chains[x];
+            if (!chainX->_alive)
+                continue;
+
+            for (size_t e = 0; e < chainX->_edges.size(); e++) {
+                const LayoutEdge &edge = _edges[chainX->_edges[e]];
+                int32_t y = _blocks[edge._src]._chain == x ? _blocks[edge._dst]._chain : _blocks[edge._src]._chain;
+                if (y == x || visited[y] == x)
+                    continue;
+                visited[y] = x;
+
+                // Each unordered pair is evaluated once; computeMergeGain tries both orders
+                int32_t first = std::min(x, y), second = std::max(x, y);
+                std::pair<int32_t, int32_t> key(first, second);
+                auto cached = _gainCache.find(key);
+                MergeGain gain;
+                if (cached != _gainCache.end() && cached->second._xVersion == _chains[first]->_version
+                    && cached->second._yVersion == _chains[second]->_version) {
+                    gain = cached->second;
+                } else {
+                    gain = computeMergeGain(first, second);
+                    _gainCache[key] = gain;
+                }
+
+                if (gain._gain > best._gain) {
+                    best = gain;
+                    bestX = first;
+                    bestY = second;
+                }
+            }
+        }
+
+        if (bestX < 0)
+            break;
+
+        applyMerge(bestX, bestY, best);
+        std::fill(visited.begin(), visited.end(), -1);
+
+        if (_work > workBudget) {
+            if (_trace)
+                _comp->log()->printf("\tExt-TSP: compile-time budget of %lld exhausted, stopping chain merging\n",
+                    (long long)workBudget);
+            break;
+        }
+    }
+}
+
+void ExtTSPLayout::generateOrder(TR_BlockList &newBlockOrder)
+{
+    TR::CFG *cfg = _comp->getFlowGraph();
+
+    // Hot chains after the entry chain go in order of decreasing execution density
+    TR::vector<int32_t, TR::Region &> hotChains(_region);
+    int32_t entryChain = -1;
+    for (int32_t c = 0; c < (int32_t)_chains.size(); c++) {
+        if (!_chains[c]->_alive)
+            continue;
+        if (_chains[c]->_hasEntry)
+            entryChain = c;
+        else
+            hotChains.push_back(c);
+    }
+
+    for (size_t i = 1; i < hotChains.size(); i++) {
+        int32_t chain = hotChains[i];
+        size_t j = i;
+        while (j > 0) {
+            LayoutChain *candidate = _chains[chain];
+            LayoutChain *previous = _chains[hotChains[j - 1]];
+            double candidateDensity = static_cast<double>(candidate->_frequency) / std::max<int64_t>(candidate->_size, 1);
+            double previousDensity = static_cast<double>(previous->_frequency) / std::max<int64_t>(previous->_size, 1);
+            bool isDenser = candidateDensity > previousDensity
+                || (candidateDensity == previousDensity && candidate->_blocks[0] < previous->_blocks[0]);
+            if (!isDenser)
+                break;
+            hotChains[j] = hotChains[j - 1];
+            j--;
+        }
+        hotChains[j] = chain;
+    }
+
+    TR_ASSERT(entryChain >= 0, "Ext-TSP layout lost the chain with the method entry");
+
+    ListElement<TR::CFGNode> *last = newBlockOrder.addAfter(cfg->getStart(), NULL);
+    LayoutChain *chain = _chains[entryChain];
+    for (size_t b = 0; b < chain->_blocks.size(); b++)
+        last = newBlockOrder.addAfter(_blocks[chain->_blocks[b]]._block, last);
+
+    for (size_t c = 0; c < hotChains.size(); c++) {
+        chain = _chains[hotChains[c]];
+        for (size_t b = 0; b < chain->_blocks.size(); b++)
+            last = newBlockOrder.addAfter(_blocks[chain->_blocks[b]]._block, last);
+    }
+
+    // Cold blocks keep their original relative order at the end of the method
+    for (size_t i = 0; i < _blocks.size(); i++) {
+        if (!_blocks[i]._hot)
+            last = newBlockOrder.addAfter(_blocks[i]._block, last);
+    }
+
+    last = newBlockOrder.addAfter(cfg->getEnd(), last);
+}
+
+} // namespace
+
+bool TR_OrderBlocks::generateExtTSPOrder(TR_BlockList &newBlockOrder)
+{
+    // Budgets that keep the layout from dominating the compile of huge methods. Past the block
+    // limit the local heuristics are used instead; past the work limit chain merging stops early.
+    static const char *maxBlocksEnv = feGetEnv("TR_ExtTSPMaxBlocks");
+    static const int32_t maxBlocks = maxBlocksEnv ? atoi(maxBlocksEnv) : 2000;
+    static const char *workBudgetEnv = feGetEnv("TR_ExtTSPWorkBudget");
+    static const int64_t workBudget = workBudgetEnv ? atoll(workBudgetEnv) : 20000000;
+
+    OMR::Logger *log = comp()->log();
+    ExtTSPLayout layout(comp(), comp()->trMemory()->currentStackRegion(), trace());
+
+    if (!layout.buildGraph(maxBlocks)) {
+        logprintf(trace(), log, "Ext-TSP: %d hot blocks exceeds the limit of %d, using local ordering heuristics\n",
+            layout.numHotBlocks(), maxBlocks);
+        return false;
+    }
+
+    if (!performTransformation(comp(), "%s Reordering blocks using Ext-TSP layout\n", OPT_DETAILS))
+        return false;
+
+    layout.mergeChains(workBudget);
+    layout.generateOrder(newBlockOrder);
+
+    logprintf(trace(), log, "Ext-TSP: laid out %d hot blocks with %lld units of work\n", layout.numHotBlocks(),
+        (long long)layout.work());
+    return true;
+}
+
 // prevBlock's fall-through successor used to be "origSucc" but now it is some other block
 // so: insert a block following prevBLock that contains a goto node to "origSucc"
 TR::Block *TR_BlockOrderingOptimization::insertGotoFallThroughBlock(TR::TreeTop *fallThroughTT, TR::Node *node,
@@ -1892,7 +2470,9 @@ void TR_OrderBlocks::doReordering()
     _visitCount = comp()->incVisitCount();
 
     TR_BlockList newBlockOrder(trMemory());
-    generateNewOrder(newBlockOrder);
+    if (_superColdBlockOnly || !comp()->getOption(TR_EnableExtTSPBlockOrdering)
+        || !generateExtTSPOrder(newBlockOrder))
+        generateNewOrder(newBlockOrder);
 
     // if (performTransformation(comp(), "%s Reordering blocks to optimize fall-through paths\n", OPT_DETAILS))
     connectTreesAccordingToOrder(newBlockOrder);
@@ -148,6 +148,7 @@ private:
 
     void initialize();
     void generateNewOrder(TR_BlockList &newBlockOrder);
+    bool generateExtTSPOrder(TR_BlockList &newBlockOrder);
     bool doBlockExtension();
 
     // instance variables
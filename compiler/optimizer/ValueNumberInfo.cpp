@@ -46,6 +46,7 @@
 #include "infra/Assert.hpp"
 #include "infra/BitVector.hpp"
 #include "infra/List.hpp"
+#include "optimizer/NodeSignatureTable.hpp"
 #include "optimizer/Optimizer.hpp"
 #include "optimizer/UseDefInfo.hpp"
 #include "ras/Debug.hpp"
@@ -56,6 +57,7 @@ TR_ValueNumberInfo::TR_ValueNumberInfo(TR::Compilation *comp)
     , _nodes(comp->allocator())
     , _valueNumbers(comp->allocator())
     , _nextInRing(comp->allocator())
+    , _signatureTable(NULL)
 {}
 
 TR_ValueNumberInfo::TR_ValueNumberInfo(TR::Compilation *comp, TR::Optimizer *optimizer, bool requiresGlobals,
@@ -66,6 +68,7 @@ TR_ValueNumberInfo::TR_ValueNumberInfo(TR::Compilation *comp, TR::Optimizer *opt
     , _nodes(comp->allocator())
     , _valueNumbers(comp->allocator())
     , _nextInRing(comp->allocator())
+    , _signatureTable(NULL)
 {
     OMR::Logger *log = comp->log();
     dumpOptDetails(comp, "PREPARTITION VN   (Building value number info)\n");
@@ -134,16 +137,16 @@ TR_ValueNumberInfo::TR_ValueNumberInfo(TR::Compilation *comp, TR::Optimizer *opt
     // Any stack allocations past this point will die when the function returns
     TR::StackMemoryRegion stackMemoryRegion(*trMemory());
 
-    // Allocate hash table for nodes
+    // Allocate the signature table for nodes. It holds the first node of
+    // each set of matching nodes.
     //
-    _hashTable._numBuckets = 1023;
-    _hashTable._buckets = (CollisionEntry **)trMemory()->allocateStackMemory(
-        _hashTable._numBuckets * sizeof(CollisionEntry *), TR_Memory::ValueNumberInfo);
-    memset(_hashTable._buckets, 0, _hashTable._numBuckets * sizeof(CollisionEntry *));
+    TR::NodeSignatureTable signatureTable(stackMemoryRegion, _numberOfNodes / 4);
+    _signatureTable = &signatureTable;
     _matchingNodes = new (trStackMemory()) TR_Array<CollisionEntry *>(trMemory(), _numberOfNodes, false, stackAlloc);
     _matchingNodes->setSize(_numberOfNodes);
 
     buildValueNumberInfo();
+    _signatureTable = NULL;
 
     int32_t i;
     if (trace()) {
@@ -168,25 +171,10 @@ TR_ValueNumberInfo::TR_ValueNumberInfo(TR::Compilation *comp, TR::Optimizer *opt
 
         log->prints("\nEnding ValueNumbering\n");
 
-        // Get hash table statistics
+        // Get signature table statistics
         //
-        int32_t numEntries = 0;
-        int32_t numBucketsUsed = 0;
-        int32_t maxBucketSize = 0;
-        for (i = _hashTable._numBuckets - 1; i >= 0; i--) {
-            if (_hashTable._buckets[i] != NULL) {
-                numBucketsUsed++;
-                int32_t numInBucket = 0;
-                for (CollisionEntry *entry = _hashTable._buckets[i]; entry; entry = entry->_next)
-                    for (NodeEntry *nodeEntry = entry->_nodes; nodeEntry; nodeEntry = nodeEntry->_next)
-                        numInBucket++;
-                numEntries += numInBucket;
-                if (numInBucket > maxBucketSize)
-                    maxBucketSize = numInBucket;
-            }
-        }
-        log->printf("   HashTable entries = %d, buckets used = %d, max bucket size = %d\n", numEntries, numBucketsUsed,
-            maxBucketSize);
+        log->printf("   Signature table entries = %u, capacity = %u, longest cluster = %u\n", signatureTable.size(),
+            signatureTable.capacity(), signatureTable.longestCluster());
     }
 
     if (trace()) {
@@ -400,12 +388,12 @@ void TR_ValueNumberInfo::initializeNode(TR::Node *node, int32_t &negativeValueNu
     // TODO: replace this with a call to congruentNodes
     _valueNumbers.ElementAt(index) = -1;
 
-    int32_t hashValue = hash(node);
+    uint32_t signature = hash(node);
     NodeEntry *newEntry = new (trStackMemory()) NodeEntry;
     newEntry->_node = node;
-    CollisionEntry *entry;
-    for (entry = _hashTable._buckets[hashValue]; entry; entry = entry->_next) {
-        TR::Node *entryNode = entry->_nodes->_node;
+    int32_t slot;
+    for (slot = _signatureTable->first(signature); slot >= 0; slot = _signatureTable->next(signature, slot)) {
+        TR::Node *entryNode = _signatureTable->nodeAt(slot);
         if (node->getOpCodeValue() != entryNode->getOpCodeValue()
             || node->getNumChildren() != entryNode->getNumChildren())
             continue;
@@ -534,15 +522,16 @@ void TR_ValueNumberInfo::initializeNode(TR::Node *node, int32_t &negativeValueNu
             break;
     }
 
-    if (entry) {
+    CollisionEntry *entry;
+    if (slot >= 0) {
+        entry = _matchingNodes->element(_signatureTable->nodeAt(slot)->getGlobalIndex());
         newEntry->_next = entry->_nodes;
         entry->_nodes = newEntry;
     } else {
         entry = new (trStackMemory()) CollisionEntry;
         entry->_nodes = newEntry;
         newEntry->_next = NULL;
-        entry->_next = _hashTable._buckets[hashValue];
-        _hashTable._buckets[hashValue] = entry;
+        _signatureTable->add(signature, node);
     }
 
     _matchingNodes->element(index) = entry;
@@ -551,7 +540,7 @@ void TR_ValueNumberInfo::initializeNode(TR::Node *node, int32_t &negativeValueNu
 /**
  * Hash on the opcode, number of children, and symbol information
  */
-int32_t TR_ValueNumberInfo::hash(TR::Node *node)
+uint32_t TR_ValueNumberInfo::hash(TR::Node *node)
 {
     uint32_t h, g;
     int32_t numChildren = node->getNumChildren();
@@ -583,7 +572,7 @@ int32_t TR_ValueNumberInfo::hash(TR::Node *node)
             h ^= g >> 24;
         }
     }
-    return (h ^ g) % _hashTable._numBuckets;
+    return h ^ g;
 }
 
 /**
@@ -1284,9 +1273,8 @@ TR_HashValueNumberInfo::VNHashKey::VNHashKey(TR::Node *node, TR_ValueNumberInfo
     }
 }
 
-bool TR_HashValueNumberInfo::VNHashKey::operator==(const VNHashKey &other) const
+bool TR_HashValueNumberInfo::VNHashKey::matches(TR::Node *otherNode) const
 {
-    TR::Node *otherNode = other._node;
     if (_node->getOpCodeValue() == otherNode->getOpCodeValue()
         && _node->getNumChildren() == otherNode->getNumChildren()) {
         bool childVNEqual = true;
@@ -1306,7 +1294,6 @@ bool TR_HashValueNumberInfo::VNHashKey::operator==(const VNHashKey &other) const
 TR_HashValueNumberInfo::TR_HashValueNumberInfo(TR::Compilation *comp, TR::Optimizer *optimizer, bool requiresGlobals,
     bool prefersGlobals, bool noUseDefInfo)
     : TR_ValueNumberInfo(comp)
-    , _nodeHash(comp->allocator())
 {
     _compilation = comp;
     _optimizer = optimizer;
@@ -1378,7 +1365,10 @@ TR_HashValueNumberInfo::TR_HashValueNumberInfo(TR::Compilation *comp, TR::Optimi
     // Any stack allocations made past this point will die when the function returns
     TR::StackMemoryRegion stackMemoryRegion(*trMemory());
 
+    TR::NodeSignatureTable signatureTable(stackMemoryRegion, _numberOfNodes / 4);
+    _signatureTable = &signatureTable;
     buildValueNumberInfo();
+    _signatureTable = NULL;
 
     int32_t i;
     if (trace()) {
@@ -1418,7 +1408,6 @@ TR_HashValueNumberInfo::TR_HashValueNumberInfo(TR::Compilation *comp, TR::Optimi
         }
         log->prints("\nEnded ValueNumbering\n");
     }
-    _nodeHash.MakeEmpty();
 }
 
 void TR_HashValueNumberInfo::initializeNode(TR::Node *node, int32_t &negativeValueNumber)
@@ -1554,17 +1543,19 @@ void TR_HashValueNumberInfo::allocateValueNumber(TR::Node *node)
         }
         if (isValidToLookIntoHash) {
             VNHashKey nodeKey(node, this);
-            CS2::HashIndex loc;
-            if (_nodeHash.Locate(nodeKey, loc)) {
-                int32_t otherNodeIndex = _nodeHash.DataAt(loc);
-                TR::Node *otherNode = _nodes.ElementAt(otherNodeIndex);
-                TR_ASSERT((otherNode != NULL), "HASHVN :Non-null nodeTable entry expected for globalIndex:%d",
-                    otherNodeIndex);
+            TR::Node *otherNode = NULL;
+            for (int32_t slot = _signatureTable->first(nodeKey._hashVal); slot >= 0;
+                 slot = _signatureTable->next(nodeKey._hashVal, slot)) {
+                if (nodeKey.matches(_signatureTable->nodeAt(slot))) {
+                    otherNode = _signatureTable->nodeAt(slot);
+                    break;
+                }
+            }
 
+            if (otherNode) {
                 setValueNumber(node, otherNode);
             } else {
-                bool added = _nodeHash.Add(nodeKey, node->getGlobalIndex());
-                TR_ASSERT(added, "HASHVN: Unexpected collision for node %p", node);
+                _signatureTable->add(nodeKey._hashVal, node);
                 changeValueNumber(node, _nextValue++);
             }
         } else {
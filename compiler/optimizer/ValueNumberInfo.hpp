@@ -34,6 +34,7 @@
 class TR_UseDefInfo;
 
 namespace TR {
+class NodeSignatureTable;
 class Optimizer;
 class ParameterSymbol;
 } // namespace TR
@@ -169,6 +170,9 @@ protected:
     bool _trace;
     int32_t _recursionDepth;
 
+    /** Temporary field, only used during building value number info */
+    TR::NodeSignatureTable *_signatureTable;
+
 private:
     struct NodeEntry {
         TR_ALLOC(TR_Memory::ValuePropagation)
@@ -176,22 +180,17 @@ private:
         TR::Node *_node;
     };
 
+    /** Nodes that may match each other, found through the signature table by
+     *  their first node */
     struct CollisionEntry {
         TR_ALLOC(TR_Memory::ValuePropagation)
-        CollisionEntry *_next;
         NodeEntry *_nodes;
     };
 
-    struct HashTable {
-        int32_t _numBuckets;
-        CollisionEntry **_buckets;
-    };
-
-    int32_t hash(TR::Node *);
+    uint32_t hash(TR::Node *);
 
     /** Temporary field, only used during building value number info */
     TR_Array<CollisionEntry *> *_matchingNodes;
-    HashTable _hashTable;
 };
 
 class TR_HashValueNumberInfo : public TR_ValueNumberInfo {
@@ -202,7 +201,11 @@ public:
     class VNHashKey {
     public:
         VNHashKey(TR::Node *node, TR_ValueNumberInfo *VN);
-        bool operator==(const VNHashKey &v2) const;
+        bool operator==(const VNHashKey &v2) const { return matches(v2._node); }
+
+        /** Whether the other node computes the same value as this key's node */
+        bool matches(TR::Node *other) const;
+
         uint32_t _hashVal;
 
     private:
@@ -226,22 +229,9 @@ public:
         TR_ValueNumberInfo *_VN;
     };
 
-    struct VNHashFunc {
-        static CS2::HashValue Hash(const VNHashKey &v1, const CS2::HashValue hv = CS2::CS2_DEFAULT_INITIALHASHVALUE)
-        {
-            return v1._hashVal;
-        }
-
-        static bool Equal(const VNHashKey &v1, const VNHashKey &v2) { return (v1 == v2); }
-    };
-
 protected:
     void initializeNode(TR::Node *node, int32_t &negativeValueNumber);
     void allocateValueNumber(TR::Node *);
-
-private:
-    typedef CS2::HashTable<VNHashKey, int32_t, TR::Allocator, VNHashFunc> VNHashTable;
-    VNHashTable _nodeHash;
 };
 
 #endif
@@ -28,7 +28,8 @@
 
 namespace TR {
 class PotentialOptimizationPredicate;
-}
+class PotentialOptimizationVPPredicate;
+} // namespace TR
 
 namespace TR {
 
@@ -57,6 +58,19 @@ public:
 
     void addPotentialOptimizationByArgument(TR::PotentialOptimizationPredicate *predicate, uint32_t argPos);
 
+    /**
+     * @return one more than the highest argument position with a predicate
+     */
+    uint32_t getNumArguments() { return static_cast<uint32_t>(_optsByArg.size()); }
+
+    uint32_t getNumPredicates(uint32_t argPos)
+    {
+        return argPos < _optsByArg.size() && _optsByArg[argPos] ? static_cast<uint32_t>(_optsByArg[argPos]->size())
+                                                                : 0;
+    }
+
+    TR::PotentialOptimizationPredicate *getPredicate(uint32_t argPos, uint32_t i) { return (*_optsByArg[argPos])[i]; }
+
 private:
     TR::Region &region() { return _region; }
 
@@ -94,6 +108,10 @@ public:
 
     uint32_t getBytecodeIndex() { return _bytecodeIndex; }
 
+    TR::PotentialOptimizationPredicate::Kind getKind() { return _kind; }
+
+    virtual TR::PotentialOptimizationVPPredicate *asVPPredicate() { return NULL; }
+
 protected:
     uint32_t _bytecodeIndex;
     TR::PotentialOptimizationPredicate::Kind _kind;
@@ -111,6 +129,10 @@ public:
     virtual bool test(TR::AbsValue *value);
     virtual void trace(TR::Compilation *comp);
 
+    virtual TR::PotentialOptimizationVPPredicate *asVPPredicate() { return this; }
+
+    TR::VPConstraint *getConstraint() { return _constraint; }
+
 private:
     bool holdPartialOrderRelation(TR::VPConstraint *valueConstraint, TR::VPConstraint *testConstraint);
 
@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/abstractinterpreter/InliningSummaryCache.hpp"
+
+#include <new>
+#include <string.h>
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentAllocator.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include "optimizer/VPConstraint.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummary.hpp"
+
+TR::InliningSummaryCache *TR::InliningSummaryCache::_instance = NULL;
+
+TR::InliningSummaryCache::InliningSummaryCache(uint32_t maxEntries, TR::Monitor *monitor)
+    : _monitor(monitor)
+    , _maxEntries(maxEntries)
+    , _numEntries(0)
+    , _hits(0)
+    , _misses(0)
+{
+    memset(_buckets, 0, sizeof(_buckets));
+}
+
+TR::InliningSummaryCache *TR::InliningSummaryCache::create(uint32_t maxEntries)
+{
+    TR::Monitor *monitor = TR::Monitor::create("JIT-InliningSummaryCacheMonitor");
+    if (!monitor)
+        return NULL;
+
+    void *storage = TR::Compiler->persistentAllocator().allocate(sizeof(TR::InliningSummaryCache), std::nothrow);
+    if (!storage) {
+        TR::Monitor::destroy(monitor);
+        return NULL;
+    }
+
+    return new (storage) TR::InliningSummaryCache(maxEntries, monitor);
+}
+
+void TR::InliningSummaryCache::destroy(TR::InliningSummaryCache *cache)
+{
+    if (!cache)
+        return;
+
+    cache->freeEntries();
+    TR::Monitor::destroy(cache->_monitor);
+    TR::Compiler->persistentAllocator().deallocate(cache);
+}
+
+bool TR::InliningSummaryCache::initialize(uint32_t maxEntries)
+{
+    if (_instance != NULL)
+        return true;
+
+    _instance = create(maxEntries);
+    return _instance != NULL;
+}
+
+void TR::InliningSummaryCache::shutdown()
+{
+    TR::InliningSummaryCache *cache = _instance;
+    _instance = NULL;
+    destroy(cache);
+}
+
+uint32_t TR::InliningSummaryCache::bucketFor(TR_OpaqueMethodBlock *method)
+{
+    // Method blocks are at least pointer aligned, so the low bits carry no information
+    uintptr_t key = reinterpret_cast<uintptr_t>(method) >> 3;
+    key ^= key >> 8;
+    key ^= key >> 16;
+    return static_cast<uint32_t>(key % NUM_BUCKETS);
+}
+
+bool TR::InliningSummaryCache::store(TR_OpaqueMethodBlock *method, uint32_t bytecodeSize,
+    TR::InliningMethodSummary *summary)
+{
+    if (!method || !summary)
+        return false;
+
+    // Translate the summary into records first, without holding the monitor,
+    // so that an uncacheable summary costs nothing but this walk.
+    uint32_t numPredicates = 0;
+    for (uint32_t argPos = 0; argPos < summary->getNumArguments(); argPos++)
+        numPredicates += summary->getNumPredicates(argPos);
+
+    size_t entrySize = sizeof(Entry) + (numPredicates > 0 ? numPredicates - 1 : 0) * sizeof(PredicateRecord);
+    Entry *entry = static_cast<Entry *>(TR::Compiler->persistentAllocator().allocate(entrySize, std::nothrow));
+    if (!entry)
+        return false;
+
+    entry->_next = NULL;
+    entry->_method = method;
+    entry->_bytecodeSize = bytecodeSize;
+    entry->_numPredicates = numPredicates;
+
+    uint32_t n = 0;
+    for (uint32_t argPos = 0; argPos < summary->getNumArguments(); argPos++) {
+        for (uint32_t i = 0; i < summary->getNumPredicates(argPos); i++) {
+            TR::PotentialOptimizationVPPredicate *predicate = summary->getPredicate(argPos, i)->asVPPredicate();
+            TR::VPConstraint *constraint = predicate ? predicate->getConstraint() : NULL;
+            PredicateRecord &record = entry->_predicates[n++];
+
+            record._argPos = argPos;
+            record._bytecodeIndex = predicate ? predicate->getBytecodeIndex() : 0;
+            record._kind = predicate ? static_cast<uint8_t>(predicate->getKind()) : 0;
+            record._low = 0;
+            record._high = 0;
+
+            if (constraint && constraint->asIntConstraint()) {
+                record._constraintKind = IntRange;
+                record._low = constraint->getLowInt();
+                record._high = constraint->getHighInt();
+            } else if (constraint && constraint->asClassPresence() && constraint->isNullObject()) {
+                record._constraintKind = NullObject;
+            } else if (constraint && constraint->asClassPresence() && constraint->isNonNullObject()) {
+                record._constraintKind = NonNullObject;
+            } else {
+                // Class tests refer to classes that may not outlive the compilation
+                TR::Compiler->persistentAllocator().deallocate(entry);
+                return false;
+            }
+        }
+    }
+
+    OMR::CriticalSection storing(_monitor);
+
+    uint32_t bucket = bucketFor(method);
+    bool stored = false;
+    if (_numEntries < _maxEntries) {
+        stored = true;
+        for (Entry *e = _buckets[bucket]; e; e = e->_next) {
+            if (e->_method == method) {
+                stored = false;
+                break;
+            }
+        }
+    }
+
+    if (!stored) {
+        TR::Compiler->persistentAllocator().deallocate(entry);
+        return false;
+    }
+
+    entry->_next = _buckets[bucket];
+    _buckets[bucket] = entry;
+    _numEntries++;
+    return true;
+}
+
+TR::InliningMethodSummary *TR::InliningSummaryCache::lookup(TR_OpaqueMethodBlock *method, uint32_t bytecodeSize,
+    TR::Region &region, TR::ValuePropagation *vp)
+{
+    if (!method || !vp)
+        return NULL;
+
+    OMR::CriticalSection lookingUp(_monitor);
+
+    Entry *entry = _buckets[bucketFor(method)];
+    while (entry && entry->_method != method)
+        entry = entry->_next;
+
+    if (!entry || entry->_bytecodeSize != bytecodeSize) {
+        _misses++;
+        return NULL;
+    }
+
+    _hits++;
+
+    TR::InliningMethodSummary *summary = new (region) TR::InliningMethodSummary(region);
+    for (uint32_t i = 0; i < entry->_numPredicates; i++) {
+        PredicateRecord &record = entry->_predicates[i];
+        TR::VPConstraint *constraint = NULL;
+        switch (record._constraintKind) {
+            case IntRange:
+                constraint = TR::VPIntRange::create(vp, record._low, record._high);
+                break;
+            case NullObject:
+                constraint = TR::VPNullObject::create(vp);
+                break;
+            case NonNullObject:
+                constraint = TR::VPNonNullObject::create(vp);
+                break;
+            default:
+                TR_ASSERT_FATAL(false, "Unexpected constraint kind %d", record._constraintKind);
+        }
+
+        TR::PotentialOptimizationPredicate *predicate = new (region)
+            TR::PotentialOptimizationVPPredicate(constraint, record._bytecodeIndex,
+                static_cast<TR::PotentialOptimizationPredicate::Kind>(record._kind), vp);
+        summary->addPotentialOptimizationByArgument(predicate, record._argPos);
+    }
+
+    return summary;
+}
+
+void TR::InliningSummaryCache::invalidate(TR_OpaqueMethodBlock *method)
+{
+    OMR::CriticalSection invalidating(_monitor);
+
+    Entry **link = &_buckets[bucketFor(method)];
+    while (*link) {
+        Entry *entry = *link;
+        if (entry->_method == method) {
+            *link = entry->_next;
+            TR::Compiler->persistentAllocator().deallocate(entry);
+            _numEntries--;
+            return;
+        }
+        link = &entry->_next;
+    }
+}
+
+void TR::InliningSummaryCache::purge()
+{
+    OMR::CriticalSection purging(_monitor);
+    freeEntries();
+}
+
+void TR::InliningSummaryCache::freeEntries()
+{
+    for (uint32_t bucket = 0; bucket < NUM_BUCKETS; bucket++) {
+        Entry *entry = _buckets[bucket];
+        while (entry) {
+            Entry *next = entry->_next;
+            TR::Compiler->persistentAllocator().deallocate(entry);
+            entry = next;
+        }
+        _buckets[bucket] = NULL;
+    }
+    _numEntries = 0;
+}
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef INLINING_SUMMARY_CACHE_INCL
+#define INLINING_SUMMARY_CACHE_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+
+class TR_OpaqueMethodBlock;
+
+namespace TR {
+class InliningMethodSummary;
+class Monitor;
+class Region;
+class ValuePropagation;
+} // namespace TR
+
+namespace TR {
+
+/**
+ * Process-wide cache of inlining method summaries.
+ *
+ * Building the IDT abstract interprets every candidate callee, and the same
+ * small callees are interpreted again by every compilation that reaches them.
+ * Once the IDT builder has interpreted a callee that makes no calls of its
+ * own, the summary it produced depends only on the callee's bytecodes, so it
+ * is recorded here and later IDT builds reuse it instead of interpreting the
+ * callee again.
+ *
+ * Summaries live in compilation regions and refer to constraints owned by a
+ * particular ValuePropagation, so they are not shared directly. Each predicate
+ * is stored as a small persistent record (argument, bytecode index, kind and
+ * an integer range or nullness), and a lookup rebuilds the summary in the
+ * caller's region with the caller's ValuePropagation. Summaries with predicates
+ * that cannot be described this way, such as class tests, are not cached.
+ *
+ * Entries are keyed by the method's persistent identifier and its bytecode
+ * size. A runtime that can redefine or unload methods must call invalidate()
+ * or purge() when it does so.
+ */
+class InliningSummaryCache {
+public:
+    static const uint32_t DEFAULT_MAX_ENTRIES = 4096;
+
+    /**
+     * Create the process-wide instance. Returns false if it could not be
+     * created.
+     */
+    static bool initialize(uint32_t maxEntries = DEFAULT_MAX_ENTRIES);
+
+    /**
+     * Free the process-wide instance. Safe to call when the cache was never
+     * initialized.
+     */
+    static void shutdown();
+
+    static InliningSummaryCache *instance() { return _instance; }
+
+    /**
+     * Allocate a cache in persistent memory. Returns NULL on failure.
+     */
+    static InliningSummaryCache *create(uint32_t maxEntries);
+    static void destroy(InliningSummaryCache *cache);
+
+    /**
+     * Record the summary computed for a method.
+     *
+     * @return true if the summary was cached; false if it cannot be described
+     *         by the cache, the method is already cached or the cache is full
+     */
+    bool store(TR_OpaqueMethodBlock *method, uint32_t bytecodeSize, TR::InliningMethodSummary *summary);
+
+    /**
+     * Rebuild the summary cached for a method.
+     *
+     * @param region the region to allocate the summary in
+     * @param vp the ValuePropagation that will own the summary's constraints
+     * @return the summary, or NULL if the method is not cached
+     */
+    TR::InliningMethodSummary *lookup(TR_OpaqueMethodBlock *method, uint32_t bytecodeSize, TR::Region &region,
+        TR::ValuePropagation *vp);
+
+    /**
+     * Remove the entry for a method, if any.
+     */
+    void invalidate(TR_OpaqueMethodBlock *method);
+
+    /**
+     * Remove every entry.
+     */
+    void purge();
+
+    uint32_t size() const { return _numEntries; }
+
+    uint64_t hits() const { return _hits; }
+
+    uint64_t misses() const { return _misses; }
+
+private:
+    enum ConstraintKind {
+        IntRange,
+        NullObject,
+        NonNullObject
+    };
+
+    struct PredicateRecord {
+        uint32_t _argPos;
+        uint32_t _bytecodeIndex;
+        uint8_t _kind;
+        uint8_t _constraintKind;
+        int32_t _low;
+        int32_t _high;
+    };
+
+    struct Entry {
+        Entry *_next;
+        TR_OpaqueMethodBlock *_method;
+        uint32_t _bytecodeSize;
+        uint32_t _numPredicates;
+        PredicateRecord _predicates[1]; // _numPredicates records are allocated
+    };
+
+    static const uint32_t NUM_BUCKETS = 256;
+
+    InliningSummaryCache(uint32_t maxEntries, TR::Monitor *monitor);
+
+    static uint32_t bucketFor(TR_OpaqueMethodBlock *method);
+
+    void freeEntries();
+
+    static InliningSummaryCache *_instance;
+
+    TR::Monitor *_monitor;
+    uint32_t _maxEntries;
+    uint32_t _numEntries;
+    uint64_t _hits;
+    uint64_t _misses;
+    Entry *_buckets[NUM_BUCKETS];
+};
+
+} // namespace TR
+
+#endif
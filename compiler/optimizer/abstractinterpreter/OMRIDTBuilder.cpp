@@ -21,6 +21,7 @@
 
 #include "optimizer/abstractinterpreter/IDTBuilder.hpp"
 #include "optimizer/abstractinterpreter/IDT.hpp"
+#include "optimizer/abstractinterpreter/InliningSummaryCache.hpp"
 #include "il/Block.hpp"
 #ifdef J9_PROJECT_SPECIFIC
 #include "env/j9method.h"
@@ -91,6 +92,26 @@ void OMR::IDTBuilder::buildIDT2(TR::IDTNode *node, TR::vector<TR::AbsValue *, TR
     TR::ResolvedMethodSymbol *symbol = node->getResolvedMethodSymbol();
     TR_ResolvedMethod *method = node->getResolvedMethod();
 
+    TR::InliningSummaryCache *summaryCache = NULL;
+    if (!node->isRoot() && comp()->getOption(TR_EnableInliningSummaryCache))
+        summaryCache = TR::InliningSummaryCache::instance();
+
+    // A callee without call sites adds nothing to the IDT below it, so a
+    // summary computed by an earlier compilation can stand in for
+    // interpreting it again
+    if (summaryCache) {
+        TR::InliningMethodSummary *summary = summaryCache->lookup(method->getPersistentIdentifier(),
+            node->getByteCodeSize(), region(), self()->getValuePropagation());
+        if (summary) {
+            logprintf(comp()->getOption(TR_TraceBIIDTGen), comp()->log(),
+                "+ IDTBuilder: Reusing the cached inlining method summary of %s\n",
+                node->getName(comp()->trMemory()));
+            node->setInliningMethodSummary(summary);
+            node->setStaticBenefit(computeStaticBenefit(summary, arguments));
+            return;
+        }
+    }
+
     TR_CallStack *nextCallStack = new (region()) TR_CallStack(comp(), symbol, method, callStack, budget, true);
 
     // Abstract interpretation will identify and find callsites thus they will be added to the IDT
@@ -98,6 +119,10 @@ void OMR::IDTBuilder::buildIDT2(TR::IDTNode *node, TR::vector<TR::AbsValue *, TR
 
     self()->performAbstractInterpretation(node, visitor, arguments);
 
+    if (summaryCache && !visitor.sawCallSite())
+        summaryCache->store(method->getPersistentIdentifier(), node->getByteCodeSize(),
+            node->getInliningMethodSummary());
+
     // At this point we have the inlining summary generated by abstract interpretation
     // So we can use the summary and the arguments passed from callers to calculate the static benefit.
     if (!node->isRoot()) {
@@ -211,6 +236,8 @@ uint32_t OMR::IDTBuilder::computeStaticBenefit(TR::InliningMethodSummary *summar
 void OMR::IDTBuilder::Visitor::visitCallSite(TR_CallSite *callSite, TR::Block *callBlock,
     TR::vector<TR::AbsValue *, TR::Region &> *arguments)
 {
+    _sawCallSite = true;
+
     float callRatio = (float)callBlock->getFrequency()
         / (float)_idtNode->getCallTarget()->_cfg->getStart()->asBlock()->getFrequency();
 
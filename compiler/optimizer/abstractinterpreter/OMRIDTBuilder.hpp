@@ -44,6 +44,7 @@ namespace TR {
 class Compilation;
 class IDT;
 class IDTBuilder;
+class ValuePropagation;
 } // namespace TR
 
 namespace OMR {
@@ -73,15 +74,23 @@ protected:
             : _idtBuilder(idtBuilder)
             , _idtNode(idtNode)
             , _callStack(callStack)
+            , _sawCallSite(false)
         {}
 
         virtual void visitCallSite(TR_CallSite *callSite, TR::Block *callBlock,
             TR::vector<TR::AbsValue *, TR::Region &> *arguments);
 
+        /**
+         * @brief whether the abstract interpretation reached any call site,
+         * including ones that were not added to the IDT
+         */
+        bool sawCallSite() { return _sawCallSite; }
+
     private:
         TR::IDTBuilder *_idtBuilder;
         TR::IDTNode *_idtNode;
         TR_CallStack *_callStack;
+        bool _sawCallSite;
     };
 
     TR::Compilation *comp() { return _comp; };
@@ -120,6 +129,20 @@ protected:
         TR_UNIMPLEMENTED();
     }
 
+    /**
+     * @brief The value propagation that owns the constraints of the inlining method summaries.
+     * Summaries taken from the TR::InliningSummaryCache are rebuilt with it.
+     *
+     * @note: This method needs language specific implementation.
+     *
+     * @return the value propagation
+     */
+    TR::ValuePropagation *getValuePropagation()
+    {
+        TR_UNIMPLEMENTED();
+        return NULL;
+    }
+
     /**
      * @param node the node to build a sub IDT for
      * @param arguments the arguments passed from caller method
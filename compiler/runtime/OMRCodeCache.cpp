@@ -49,6 +49,7 @@
 #ifdef LINUX
 #include <elf.h>
 #include <unistd.h>
+#include "runtime/PerfJitDump.hpp"
 #endif
 
 namespace TR {
@@ -964,6 +965,11 @@ bool OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start, uint8_t *end, con
 
     _manager->decreaseCurrTotalUsedInBytes(size);
 
+#if (HOST_OS == OMR_LINUX)
+    if (_manager->perfJitDump())
+        _manager->perfJitDump()->codeFreed(start, start + size);
+#endif
+
     if (config.verboseReclamation()) {
         TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,
             "--ccr-- addFreeBlock2WithCallSite CC=%p start=%p end=%p mergedBlock=%p link=%p link->_size=%u, "
@@ -94,6 +94,7 @@ public:
         , _codeCacheFreeBlockRecylingEnabled(false)
         , _emitExecutableELF(false)
         , _emitRelocatableELF(false)
+        , _emitPerfJitDump(false)
     {
 #if defined(J9ZOS390) // EBCDIC
         _warmEyeCatcher[0] = '\xD1';
@@ -184,6 +185,8 @@ public:
 
     bool emitRelocatableELF() const { return _emitRelocatableELF; }
 
+    bool emitPerfJitDump() const { return _emitPerfJitDump; }
+
     int32_t _trampolineCodeSize; /*!< size of the trampoline code in bytes */
     int32_t _CCPreLoadedCodeSize; /*!< size of the pre-Loaded CodeCache Helpers code in bytes */
     int32_t _numOfRuntimeHelpers; /*!< number of runtime helpers */
@@ -214,6 +217,7 @@ public:
 
     bool _emitExecutableELF; /*!< emit code cache as ELF object on shutdown */
     bool _emitRelocatableELF;
+    bool _emitPerfJitDump; /*!< write compiled code to a perf jitdump file as it is registered */
 
     char * const warmEyeCatcher() { return _warmEyeCatcher; }
 
@@ -55,6 +55,7 @@
 #include <elf.h>
 #include <unistd.h>
 #include "codegen/ELFGenerator.hpp"
+#include "runtime/PerfJitDump.hpp"
 
 TR::CodeCacheSymbolContainer *OMR::CodeCacheManager::_symbolContainer = NULL;
 
@@ -78,6 +79,7 @@ OMR::CodeCacheManager::CodeCacheManager(TR::RawAllocator rawAllocator)
 #if HOST_OS == OMR_LINUX
     , _elfExecutableGenerator(NULL)
     , _elfRelocatableGenerator(NULL)
+    , _perfJitDump(NULL)
     , _relocatableSymbolContainer(NULL)
     , _relocations(NULL)
     , _resolver()
@@ -125,6 +127,11 @@ TR::CodeCache *OMR::CodeCacheManager::initialize(bool allocateMonolithicCodeCach
 
     TR::CodeCacheConfig &config = self()->codeCacheConfig();
 
+#if (HOST_OS == OMR_LINUX)
+    if (config.emitPerfJitDump())
+        self()->initializePerfJitDump();
+#endif // HOST_OS == OMR_LINUX
+
     if (allocateMonolithicCodeCache) {
         size_t size = config.codeCacheTotalKB() * 1024;
         if (self()->allocateCodeCacheRepository(size)) {
@@ -229,6 +236,11 @@ void OMR::CodeCacheManager::destroy()
         self()->freeMemory(_symbolContainer);
         _symbolContainer = NULL;
     }
+
+    if (_perfJitDump) {
+        _perfJitDump->destroy();
+        _perfJitDump = NULL;
+    }
 #endif // HOST_OS == OMR_LINUX
 
     TR::CodeCache *codeCache = self()->getFirstCodeCache();
@@ -1145,6 +1157,29 @@ void OMR::CodeCacheManager::initializeExecutableELFGenerator(void)
         = new (_rawAllocator) TR::ELFExecutableGenerator(_rawAllocator, _codeCacheRepositorySegment->segmentBase(),
             _codeCacheRepositorySegment->segmentTop() - _codeCacheRepositorySegment->segmentBase());
 }
+
+void OMR::CodeCacheManager::initializePerfJitDump(void)
+{
+    uint32_t elfMachine = EM_NONE;
+    if (TR::Compiler->target.cpu.isX86())
+        elfMachine = TR::Compiler->target.is64Bit() ? EM_X86_64 : EM_386;
+    else if (TR::Compiler->target.cpu.isPower())
+        elfMachine = TR::Compiler->target.is64Bit() ? EM_PPC64 : EM_PPC;
+    else if (TR::Compiler->target.cpu.isZ())
+        elfMachine = EM_S390;
+    else if (TR::Compiler->target.cpu.isARM64())
+        elfMachine = EM_AARCH64;
+    else if (TR::Compiler->target.cpu.isARM())
+        elfMachine = EM_ARM;
+#if defined(EM_RISCV)
+    else if (TR::Compiler->target.cpu.isRISCV())
+        elfMachine = EM_RISCV;
+#endif
+
+    _perfJitDump = TR::PerfJitDump::create(_rawAllocator, elfMachine);
+    if (!_perfJitDump)
+        fprintf(stderr, "WARNING: Unable to create perf jitdump file; jitdump output is disabled\n");
+}
 #endif // HOST_OS==OMR_LINUX
 
 TR::CodeCache *OMR::CodeCacheManager::allocateCodeCacheFromNewSegment(size_t segmentSizeInBytes,
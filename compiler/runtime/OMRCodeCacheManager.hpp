@@ -66,6 +66,7 @@ typedef CodeCacheManager CodeCacheManagerConnector;
 namespace TR {
 class ELFRelocatableGenerator;
 class ELFExecutableGenerator;
+class PerfJitDump;
 } // namespace TR
 
 namespace TR {
@@ -378,9 +379,20 @@ public:
      */
     void initializeExecutableELFGenerator(void);
 
+    /**
+     * Opens the perf jitdump file if the option is enabled
+     */
+    void initializePerfJitDump(void);
+
+    /**
+     * Returns the perf jitdump writer, or NULL if jitdump output is not enabled
+     */
+    TR::PerfJitDump *perfJitDump() { return _perfJitDump; }
+
 protected:
     TR::ELFExecutableGenerator *_elfExecutableGenerator; /**< Executable ELF generator */
     TR::ELFRelocatableGenerator *_elfRelocatableGenerator; /**< Relocatable ELF generator */
+    TR::PerfJitDump *_perfJitDump; /**< perf jitdump writer */
 
     // collect information on code cache symbols here, will be post processed into the elf trailer structure
     static TR::CodeCacheSymbolContainer
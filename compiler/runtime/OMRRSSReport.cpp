@@ -19,6 +19,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 #include "compiler/infra/String.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentAllocator.hpp"
 #include "runtime/OMRRSSReport.hpp"
 
 OMR::RSSReport *OMR::RSSReport::_instance = NULL;
@@ -363,4 +365,24 @@ void OMR::RSSReport::printRegions()
 
     TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "RSS Region rss/size:    %s  all %u regions %5zu/%5zu(%3.0f%%) KB",
         rssLine, regionNum, totalRSSKb, totalKb, (float)totalRSSKb * 100.0 / totalKb);
+
+    printPersistentAllocator();
+}
+
+void OMR::RSSReport::printPersistentAllocator()
+{
+    TR::PersistentAllocator::Statistics stats;
+    TR::Compiler->persistentAllocator().getStatistics(stats);
+
+    TR_VerboseLog::writeLineLocked(TR_Vlog_PERF,
+        "RSS persistent small: segments %5zu KB, in use %5zu KB (requested %5zu KB), free %5zu KB in %u thread caches "
+        "and %5zu KB pooled, unused %3.0f%%",
+        stats.segmentBytes / 1024, stats.smallBytesInUse / 1024, stats.smallBytesRequested / 1024,
+        stats.cachedBytes / 1024, stats.numThreadCaches, stats.pooledBytes / 1024,
+        stats.segmentBytes ? (float)(stats.segmentBytes - stats.smallBytesRequested) * 100.0 / stats.segmentBytes
+                           : 0.0);
+    TR_VerboseLog::writeLineLocked(TR_Vlog_PERF,
+        "RSS persistent large: %zu allocations %5zu KB; lock acquisitions %llu, contended %llu",
+        stats.numLargeAllocations, stats.largeBytesInUse / 1024, (unsigned long long)stats.lockAcquisitions,
+        (unsigned long long)stats.contendedLockAcquisitions);
 }
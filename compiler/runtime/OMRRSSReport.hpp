@@ -243,6 +243,15 @@ public:
      */
     void printRegions();
 
+    /**
+     * \brief
+     *        Prints how the persistent allocator uses the memory it has
+     *        obtained: the bytes in use, the bytes lost to rounding and
+     *        headers, the free bytes held by thread caches and the shared
+     *        pool, and how often its lock was contended
+     */
+    void printPersistentAllocator();
+
     /**
      * \brief
      *        Adds RSSRegion to the list
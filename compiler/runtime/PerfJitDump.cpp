@@ -0,0 +1,434 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "runtime/PerfJitDump.hpp"
+
+#if defined(LINUX)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <new>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+
+const uint32_t JITDUMP_MAGIC = 0x4A695444; // "JiTD"
+const uint32_t JITDUMP_VERSION = 1;
+
+struct FileHeader {
+    uint32_t _magic;
+    uint32_t _version;
+    uint32_t _totalSize;
+    uint32_t _elfMachine;
+    uint32_t _pad1;
+    uint32_t _pid;
+    uint64_t _timestamp;
+    uint64_t _flags;
+};
+
+struct RecordHeader {
+    uint32_t _id;
+    uint32_t _totalSize;
+    uint64_t _timestamp;
+};
+
+struct CodeLoadRecord {
+    RecordHeader _header;
+    uint32_t _pid;
+    uint32_t _tid;
+    uint64_t _vma;
+    uint64_t _codeAddress;
+    uint64_t _codeSize;
+    uint64_t _codeIndex;
+};
+
+struct CodeMoveRecord {
+    RecordHeader _header;
+    uint32_t _pid;
+    uint32_t _tid;
+    uint64_t _vma;
+    uint64_t _oldCodeAddress;
+    uint64_t _newCodeAddress;
+    uint64_t _codeSize;
+    uint64_t _codeIndex;
+};
+
+struct DebugInfoRecord {
+    RecordHeader _header;
+    uint64_t _codeAddress;
+    uint64_t _numEntries;
+};
+
+struct DebugInfoEntry {
+    uint64_t _address;
+    int32_t _line;
+    int32_t _discriminator;
+};
+
+struct UnwindingInfoRecord {
+    RecordHeader _header;
+    uint64_t _unwindingSize;
+    uint64_t _ehFrameHdrSize;
+    uint64_t _mappedSize;
+};
+
+uint32_t currentThreadId() { return static_cast<uint32_t>(syscall(SYS_gettid)); }
+
+} // namespace
+
+TR::PerfJitDump *TR::PerfJitDump::create(TR::RawAllocator rawAllocator, uint32_t elfMachine)
+{
+    char fileName[64];
+    snprintf(fileName, sizeof(fileName), "/tmp/jit-%d.dump", static_cast<int>(getpid()));
+
+    int fd = open(fileName, O_CREAT | O_TRUNC | O_RDWR, 0666);
+    if (fd < 0)
+        return NULL;
+
+    void *storage = rawAllocator.allocate(sizeof(TR::PerfJitDump), std::nothrow);
+    if (!storage) {
+        close(fd);
+        return NULL;
+    }
+    TR::PerfJitDump *dump = new (storage) TR::PerfJitDump(rawAllocator, fd);
+
+    dump->_activeBuffer = static_cast<uint8_t *>(rawAllocator.allocate(BUFFER_SIZE, std::nothrow));
+    dump->_writeBuffer = static_cast<uint8_t *>(rawAllocator.allocate(BUFFER_SIZE, std::nothrow));
+    if (!dump->_activeBuffer || !dump->_writeBuffer) {
+        dump->_shutdown = true;
+        dump->destroy();
+        return NULL;
+    }
+
+    FileHeader header;
+    memset(&header, 0, sizeof(header));
+    header._magic = JITDUMP_MAGIC;
+    header._version = JITDUMP_VERSION;
+    header._totalSize = sizeof(header);
+    header._elfMachine = elfMachine;
+    header._pid = dump->_pid;
+    header._timestamp = dump->timestamp();
+    dump->writeFully(reinterpret_cast<const uint8_t *>(&header), sizeof(header));
+
+    // perf discovers the dump through an executable mapping of the file that
+    // is recorded as an MMAP event, so the mapping must outlive the dump.
+    size_t markerSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    void *marker = mmap(NULL, markerSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+    if (marker == MAP_FAILED) {
+        dump->_shutdown = true;
+        dump->destroy();
+        return NULL;
+    }
+    dump->_marker = marker;
+    dump->_markerSize = markerSize;
+
+    if (pthread_create(&dump->_writerThread, NULL, writerThreadEntry, dump) != 0) {
+        dump->_shutdown = true;
+        dump->destroy();
+        return NULL;
+    }
+
+    return dump;
+}
+
+TR::PerfJitDump::PerfJitDump(TR::RawAllocator rawAllocator, int fd)
+    : _rawAllocator(rawAllocator)
+    , _fd(fd)
+    , _marker(NULL)
+    , _markerSize(0)
+    , _pid(static_cast<uint32_t>(getpid()))
+    , _activeBuffer(NULL)
+    , _writeBuffer(NULL)
+    , _activeUsed(0)
+    , _writing(false)
+    , _shutdown(false)
+    , _nextCodeIndex(0)
+    , _numCodeLoads(0)
+    , _bytesFreed(0)
+{
+    pthread_mutex_init(&_mutex, NULL);
+    pthread_cond_init(&_producerCond, NULL);
+    pthread_cond_init(&_writerCond, NULL);
+}
+
+void TR::PerfJitDump::destroy()
+{
+    // _shutdown is only already set when create() failed before the writer started
+    bool writerStarted = !_shutdown;
+    if (writerStarted) {
+        RecordHeader closeRecord;
+        closeRecord._id = JIT_CODE_CLOSE;
+        closeRecord._totalSize = sizeof(closeRecord);
+        closeRecord._timestamp = timestamp();
+        const void *pieces[] = { &closeRecord };
+        size_t sizes[] = { sizeof(closeRecord) };
+
+        pthread_mutex_lock(&_mutex);
+        appendLocked(pieces, sizes, 1);
+        _shutdown = true;
+        pthread_cond_signal(&_writerCond);
+        pthread_mutex_unlock(&_mutex);
+
+        pthread_join(_writerThread, NULL);
+    }
+
+    if (_marker)
+        munmap(_marker, _markerSize);
+    close(_fd);
+
+    pthread_cond_destroy(&_writerCond);
+    pthread_cond_destroy(&_producerCond);
+    pthread_mutex_destroy(&_mutex);
+
+    if (_activeBuffer)
+        _rawAllocator.deallocate(_activeBuffer);
+    if (_writeBuffer)
+        _rawAllocator.deallocate(_writeBuffer);
+
+    TR::RawAllocator rawAllocator = _rawAllocator;
+    this->~PerfJitDump();
+    rawAllocator.deallocate(this);
+}
+
+uint64_t TR::PerfJitDump::timestamp()
+{
+    // perf must be run with -k mono (CLOCK_MONOTONIC) to correlate samples with these records
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+void TR::PerfJitDump::codeLoad(const char *name, uint8_t *codeStart, size_t codeSize, const DebugEntry *entries,
+    uint32_t numEntries, const uint8_t *ehFrame, size_t ehFrameSize, size_t ehFrameHdrSize)
+{
+    uint64_t now = timestamp();
+    uint32_t tid = currentThreadId();
+    size_t nameSize = strlen(name) + 1;
+
+    // The variable length part of the debug info record is serialized up front
+    // so that the lock is only held while copying into the buffer.
+    uint8_t *debugEntries = NULL;
+    size_t debugEntriesSize = 0;
+    if (entries && numEntries > 0) {
+        for (uint32_t i = 0; i < numEntries; i++)
+            debugEntriesSize += sizeof(DebugInfoEntry) + strlen(entries[i]._fileName) + 1;
+
+        debugEntries = static_cast<uint8_t *>(_rawAllocator.allocate(debugEntriesSize, std::nothrow));
+        if (debugEntries) {
+            uint8_t *cursor = debugEntries;
+            for (uint32_t i = 0; i < numEntries; i++) {
+                DebugInfoEntry entry;
+                entry._address = reinterpret_cast<uintptr_t>(entries[i]._address);
+                entry._line = entries[i]._line;
+                entry._discriminator = entries[i]._discriminator;
+                memcpy(cursor, &entry, sizeof(entry));
+                cursor += sizeof(entry);
+
+                size_t fileNameSize = strlen(entries[i]._fileName) + 1;
+                memcpy(cursor, entries[i]._fileName, fileNameSize);
+                cursor += fileNameSize;
+            }
+        }
+    }
+
+    pthread_mutex_lock(&_mutex);
+
+    if (debugEntries) {
+        DebugInfoRecord record;
+        record._header._id = JIT_CODE_DEBUG_INFO;
+        record._header._totalSize = static_cast<uint32_t>(sizeof(record) + debugEntriesSize);
+        record._header._timestamp = now;
+        record._codeAddress = reinterpret_cast<uintptr_t>(codeStart);
+        record._numEntries = numEntries;
+
+        const void *pieces[] = { &record, debugEntries };
+        size_t sizes[] = { sizeof(record), debugEntriesSize };
+        appendLocked(pieces, sizes, 2);
+    }
+
+    if (ehFrame && ehFrameSize > 0) {
+        static const uint8_t padding[8] = { 0 };
+        size_t unpaddedSize = sizeof(UnwindingInfoRecord) + ehFrameSize;
+        size_t paddingSize = (8 - (unpaddedSize & 7)) & 7;
+
+        UnwindingInfoRecord record;
+        record._header._id = JIT_CODE_UNWINDING_INFO;
+        record._header._totalSize = static_cast<uint32_t>(unpaddedSize + paddingSize);
+        record._header._timestamp = now;
+        record._unwindingSize = ehFrameSize;
+        record._ehFrameHdrSize = ehFrameHdrSize;
+        record._mappedSize = ehFrameSize;
+
+        const void *pieces[] = { &record, ehFrame, padding };
+        size_t sizes[] = { sizeof(record), ehFrameSize, paddingSize };
+        appendLocked(pieces, sizes, 3);
+    }
+
+    CodeLoadRecord record;
+    record._header._id = JIT_CODE_LOAD;
+    record._header._totalSize = static_cast<uint32_t>(sizeof(record) + nameSize + codeSize);
+    record._header._timestamp = now;
+    record._pid = _pid;
+    record._tid = tid;
+    record._vma = reinterpret_cast<uintptr_t>(codeStart);
+    record._codeAddress = reinterpret_cast<uintptr_t>(codeStart);
+    record._codeSize = codeSize;
+    record._codeIndex = _nextCodeIndex++;
+
+    const void *pieces[] = { &record, name, codeStart };
+    size_t sizes[] = { sizeof(record), nameSize, codeSize };
+    appendLocked(pieces, sizes, 3);
+    _numCodeLoads++;
+
+    pthread_mutex_unlock(&_mutex);
+
+    if (debugEntries)
+        _rawAllocator.deallocate(debugEntries);
+}
+
+void TR::PerfJitDump::codeMove(uint8_t *oldCodeStart, uint8_t *newCodeStart, size_t codeSize)
+{
+    CodeMoveRecord record;
+    record._header._id = JIT_CODE_MOVE;
+    record._header._totalSize = sizeof(record);
+    record._header._timestamp = timestamp();
+    record._pid = _pid;
+    record._tid = currentThreadId();
+    record._vma = reinterpret_cast<uintptr_t>(newCodeStart);
+    record._oldCodeAddress = reinterpret_cast<uintptr_t>(oldCodeStart);
+    record._newCodeAddress = reinterpret_cast<uintptr_t>(newCodeStart);
+    record._codeSize = codeSize;
+
+    const void *pieces[] = { &record };
+    size_t sizes[] = { sizeof(record) };
+
+    pthread_mutex_lock(&_mutex);
+    record._codeIndex = _nextCodeIndex++;
+    appendLocked(pieces, sizes, 1);
+    pthread_mutex_unlock(&_mutex);
+}
+
+void TR::PerfJitDump::codeFreed(uint8_t *start, uint8_t *end)
+{
+    pthread_mutex_lock(&_mutex);
+    _bytesFreed += end - start;
+    pthread_mutex_unlock(&_mutex);
+}
+
+void TR::PerfJitDump::appendLocked(const void * const *pieces, const size_t *sizes, uint32_t numPieces)
+{
+    size_t recordSize = 0;
+    for (uint32_t i = 0; i < numPieces; i++)
+        recordSize += sizes[i];
+
+    if (recordSize > BUFFER_SIZE) {
+        // Too large to buffer: wait until everything queued ahead of it is on
+        // disk and write it directly to keep the records in order.
+        while (_activeUsed > 0 || _writing) {
+            pthread_cond_signal(&_writerCond);
+            pthread_cond_wait(&_producerCond, &_mutex);
+        }
+        for (uint32_t i = 0; i < numPieces; i++)
+            writeFully(static_cast<const uint8_t *>(pieces[i]), sizes[i]);
+        return;
+    }
+
+    while (_activeUsed + recordSize > BUFFER_SIZE) {
+        pthread_cond_signal(&_writerCond);
+        pthread_cond_wait(&_producerCond, &_mutex);
+    }
+
+    for (uint32_t i = 0; i < numPieces; i++) {
+        memcpy(_activeBuffer + _activeUsed, pieces[i], sizes[i]);
+        _activeUsed += sizes[i];
+    }
+
+    if (_activeUsed >= BUFFER_SIZE / 2)
+        pthread_cond_signal(&_writerCond);
+}
+
+void TR::PerfJitDump::writeFully(const uint8_t *data, size_t size)
+{
+    while (size > 0) {
+        ssize_t written = write(_fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            return;
+        }
+        data += written;
+        size -= written;
+    }
+}
+
+void *TR::PerfJitDump::writerThreadEntry(void *dump)
+{
+    static_cast<TR::PerfJitDump *>(dump)->writerLoop();
+    return NULL;
+}
+
+void TR::PerfJitDump::writerLoop()
+{
+    pthread_mutex_lock(&_mutex);
+    while (true) {
+        if (_activeUsed == 0 && !_shutdown) {
+            // Wake up periodically so records reach the file even when
+            // compilation activity is too low to fill the buffer.
+            struct timeval now;
+            gettimeofday(&now, NULL);
+            struct timespec deadline;
+            uint64_t nsec = static_cast<uint64_t>(now.tv_usec) * 1000 + FLUSH_INTERVAL_MS * 1000000ULL;
+            deadline.tv_sec = now.tv_sec + static_cast<time_t>(nsec / 1000000000ULL);
+            deadline.tv_nsec = static_cast<long>(nsec % 1000000000ULL);
+            pthread_cond_timedwait(&_writerCond, &_mutex, &deadline);
+        }
+
+        if (_activeUsed == 0) {
+            if (_shutdown)
+                break;
+            continue;
+        }
+
+        uint8_t *buffer = _activeBuffer;
+        size_t size = _activeUsed;
+        _activeBuffer = _writeBuffer;
+        _writeBuffer = buffer;
+        _activeUsed = 0;
+        _writing = true;
+        pthread_cond_broadcast(&_producerCond);
+
+        pthread_mutex_unlock(&_mutex);
+        writeFully(buffer, size);
+        pthread_mutex_lock(&_mutex);
+
+        _writing = false;
+        pthread_cond_broadcast(&_producerCond);
+    }
+    pthread_mutex_unlock(&_mutex);
+}
+
+#endif // LINUX
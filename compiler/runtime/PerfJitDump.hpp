@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef PERFJITDUMP_HPP
+#define PERFJITDUMP_HPP
+
+#if defined(LINUX)
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "env/RawAllocator.hpp"
+
+namespace TR {
+
+/**
+ * Writer for the Linux perf "jitdump" format (tools/perf/Documentation/jitdump-specification.txt).
+ *
+ * Unlike the /tmp/perf-<pid>.map file produced by -Xjit:perfTool, a jitdump
+ * file carries a timestamp and a copy of the code bytes for every method body,
+ * so `perf inject --jit` can attribute samples correctly even when the code
+ * cache reuses an address range after reclamation. Records are serialized
+ * into an in-memory buffer by the producing thread and written to the file by
+ * a background writer thread, keeping file I/O off compilation threads.
+ */
+class PerfJitDump {
+public:
+    /**
+     * Maps a code address to a source position. The jitdump DEBUG_INFO record
+     * has no notion of a method, so the name of the (possibly inlined) method
+     * is carried as the file name and the bytecode index as the line number.
+     */
+    struct DebugEntry {
+        uint8_t *_address;
+        int32_t _line;
+        int32_t _discriminator;
+        const char *_fileName;
+    };
+
+    /**
+     * Opens /tmp/jit-<pid>.dump, writes the file header and starts the
+     * background writer thread.
+     *
+     * @param[in] rawAllocator the allocator for the dump and its buffers
+     * @param[in] elfMachine the ELF e_machine value of the generated code
+     * @returns the new dump, or NULL if the file could not be created
+     */
+    static PerfJitDump *create(TR::RawAllocator rawAllocator, uint32_t elfMachine);
+
+    /**
+     * Emits a JIT_CODE_CLOSE record, drains the buffer, stops the writer thread
+     * and frees the dump.
+     */
+    void destroy();
+
+    /**
+     * Records a new method body. Debug entries and unwind information, when
+     * provided, are emitted in JIT_CODE_DEBUG_INFO and JIT_CODE_UNWINDING_INFO
+     * records immediately ahead of the JIT_CODE_LOAD record, as required by perf.
+     *
+     * @param[in] name the symbol name of the method body
+     * @param[in] codeStart the start of the method body
+     * @param[in] codeSize the size of the method body in bytes
+     * @param[in] entries the debug entries, sorted by address, or NULL
+     * @param[in] numEntries the number of debug entries
+     * @param[in] ehFrame the .eh_frame_hdr followed by the .eh_frame data, or NULL
+     * @param[in] ehFrameSize the total size of ehFrame in bytes
+     * @param[in] ehFrameHdrSize the size of the .eh_frame_hdr part of ehFrame
+     */
+    void codeLoad(const char *name, uint8_t *codeStart, size_t codeSize, const DebugEntry *entries = NULL,
+        uint32_t numEntries = 0, const uint8_t *ehFrame = NULL, size_t ehFrameSize = 0, size_t ehFrameHdrSize = 0);
+
+    /**
+     * Records that a method body was copied to a new address.
+     */
+    void codeMove(uint8_t *oldCodeStart, uint8_t *newCodeStart, size_t codeSize);
+
+    /**
+     * Notes that a code cache range has been returned to the free block list.
+     *
+     * The jitdump format has no unload record: perf resolves an address to the
+     * most recent JIT_CODE_LOAD that preceded the sample, so a reused range is
+     * attributed correctly as long as its new load record is written with a
+     * later timestamp. This only keeps statistics for the close message.
+     */
+    void codeFreed(uint8_t *start, uint8_t *end);
+
+    uint64_t numCodeLoads() const { return _numCodeLoads; }
+
+    uint64_t bytesFreed() const { return _bytesFreed; }
+
+private:
+    enum RecordType {
+        JIT_CODE_LOAD = 0,
+        JIT_CODE_MOVE = 1,
+        JIT_CODE_DEBUG_INFO = 2,
+        JIT_CODE_CLOSE = 3,
+        JIT_CODE_UNWINDING_INFO = 4
+    };
+
+    static const size_t BUFFER_SIZE = 1024 * 1024;
+    static const uint32_t FLUSH_INTERVAL_MS = 100;
+
+    PerfJitDump(TR::RawAllocator rawAllocator, int fd);
+
+    static void *writerThreadEntry(void *dump);
+
+    void writerLoop();
+
+    uint64_t timestamp();
+
+    /**
+     * Appends a record made of the given pieces to the active buffer. The
+     * caller must hold _mutex; the call blocks while the buffer is full.
+     */
+    void appendLocked(const void * const *pieces, const size_t *sizes, uint32_t numPieces);
+
+    void writeFully(const uint8_t *data, size_t size);
+
+    TR::RawAllocator _rawAllocator;
+    int _fd;
+    void *_marker;
+    size_t _markerSize;
+    uint32_t _pid;
+
+    pthread_t _writerThread;
+    pthread_mutex_t _mutex;
+    pthread_cond_t _producerCond;
+    pthread_cond_t _writerCond;
+
+    uint8_t *_activeBuffer;
+    uint8_t *_writeBuffer;
+    size_t _activeUsed;
+    bool _writing;
+    bool _shutdown;
+
+    uint64_t _nextCodeIndex;
+    uint64_t _numCodeLoads;
+    uint64_t _bytesFreed;
+};
+
+} // namespace TR
+
+#endif // LINUX
+
+#endif // PERFJITDUMP_HPP
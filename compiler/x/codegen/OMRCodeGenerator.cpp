@@ -98,6 +98,7 @@
 #include "x/codegen/OutlinedInstructions.hpp"
 #include "x/codegen/FPTreeEvaluator.hpp"
 #include "x/codegen/X86Instruction.hpp"
+#include "x/codegen/X86InstructionScheduler.hpp"
 #include "codegen/InstOpCode.hpp"
 
 // Amount to be added to the estimated code size to ensure that there are long
@@ -1854,6 +1855,12 @@ void OMR::X86::CodeGenerator::addItemsToRSSReport(uint8_t *coldCode)
     }
 }
 
+bool OMR::X86::CodeGenerator::scheduleInstructions()
+{
+    TR::X86InstructionScheduler scheduler(self());
+    return scheduler.perform() > 0;
+}
+
 void OMR::X86::CodeGenerator::doBinaryEncoding()
 {
     TR::Compilation *comp = self()->comp();
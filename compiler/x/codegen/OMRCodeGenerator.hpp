@@ -482,6 +482,7 @@ public:
     static void initializeX86TargetProcessorInfo(bool force = false) { getX86ProcessorInfo().initialize(force); }
 
     void doRegisterAssignment(TR_RegisterKinds kindsToAssign);
+    bool scheduleInstructions();
     void doBinaryEncoding();
 
     /*
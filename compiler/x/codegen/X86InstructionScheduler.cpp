@@ -0,0 +1,812 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "x/codegen/X86InstructionScheduler.hpp"
+
+#include <stdint.h>
+#include <string.h>
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/Instruction.hpp"
+#include "codegen/MemoryReference.hpp"
+#include "codegen/RealRegister.hpp"
+#include "codegen/Register.hpp"
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "infra/Assert.hpp"
+#include "ras/Logger.hpp"
+#include "x/codegen/X86Instruction.hpp"
+
+// Latencies are in cycles and approximate the published figures for each
+// microarchitecture. Execution units are listed in ExecutionUnit order:
+// ALU, Multiplier, Load, Store, FP, Divider. Latencies are listed in
+// OperationClass order: IntAlu, IntMultiply, Move, FPAdd, FPMultiply,
+// FPDivide, FPSqrt, FPConvert, VectorAlu.
+//
+static const TR::X86InstructionScheduler::MachineModel skylakeModel = {
+    "skylake", 4, { 4, 1, 2, 1, 2, 1 },
+     { 1, 3, 1, 4, 4, 14, 18, 5, 1 },
+     5, 5, 4
+};
+
+static const TR::X86InstructionScheduler::MachineModel haswellModel = {
+    "haswell", 4, { 4, 1, 2, 1, 2, 1 },
+     { 1, 3, 1, 3, 5, 14, 16, 4, 1 },
+     5, 5, 8
+};
+
+static const TR::X86InstructionScheduler::MachineModel sandyBridgeModel = {
+    "sandybridge", 4, { 3, 1, 2, 1, 2, 1 },
+     { 1, 3, 1, 3, 5, 22, 29, 4, 1 },
+     5, 5, 20
+};
+
+static const TR::X86InstructionScheduler::MachineModel nehalemModel = {
+    "nehalem", 4, { 3, 1, 1, 1, 2, 1 },
+     { 1, 3, 1, 3, 5, 22, 29, 4, 1 },
+     4, 5, 20
+};
+
+static const TR::X86InstructionScheduler::MachineModel core2Model = {
+    "core2", 4, { 3, 1, 1, 1, 2, 1 },
+     { 1, 3, 1, 3, 5, 32, 58, 4, 1 },
+     3, 5, 31
+};
+
+static const TR::X86InstructionScheduler::MachineModel k8Model = {
+    "k8", 3, { 3, 1, 2, 1, 2, 1 },
+     { 1, 3, 1, 4, 4, 20, 27, 4, 2 },
+     3, 4, 17
+};
+
+static const TR::X86InstructionScheduler::MachineModel bulldozerModel = {
+    "bulldozer", 4, { 2, 1, 2, 1, 2, 1 },
+     { 1, 4, 1, 5, 5, 27, 29, 4, 2 },
+     4, 8, 20
+};
+
+const TR::X86InstructionScheduler::MachineModel *TR::X86InstructionScheduler::machineModelFor(TR::Compilation *comp)
+{
+    switch (comp->target().cpu.getProcessorDescription().processor) {
+        case OMR_PROCESSOR_X86_INTEL_PENTIUM:
+        case OMR_PROCESSOR_X86_INTEL_P6:
+        case OMR_PROCESSOR_X86_INTEL_PENTIUM4:
+        case OMR_PROCESSOR_X86_INTEL_CORE2:
+        case OMR_PROCESSOR_X86_INTEL_TULSA:
+            return &core2Model;
+        case OMR_PROCESSOR_X86_INTEL_NEHALEM:
+        case OMR_PROCESSOR_X86_INTEL_WESTMERE:
+            return &nehalemModel;
+        case OMR_PROCESSOR_X86_INTEL_SANDYBRIDGE:
+        case OMR_PROCESSOR_X86_INTEL_IVYBRIDGE:
+            return &sandyBridgeModel;
+        case OMR_PROCESSOR_X86_INTEL_HASWELL:
+        case OMR_PROCESSOR_X86_INTEL_BROADWELL:
+            return &haswellModel;
+        case OMR_PROCESSOR_X86_AMD_K5:
+        case OMR_PROCESSOR_X86_AMD_K6:
+        case OMR_PROCESSOR_X86_AMD_ATHLONDURON:
+        case OMR_PROCESSOR_X86_AMD_OPTERON:
+            return &k8Model;
+        case OMR_PROCESSOR_X86_AMD_FAMILY15H:
+            return &bulldozerModel;
+        default:
+            // Skylake and newer, and anything that is not recognized
+            return &skylakeModel;
+    }
+}
+
+static TR::X86InstructionScheduler::OperationClass operationClass(TR::InstOpCode &op)
+{
+    switch (op.getOpCodeValue()) {
+        case TR::InstOpCode::ADDSSRegReg:
+        case TR::InstOpCode::ADDSSRegMem:
+        case TR::InstOpCode::ADDPSRegReg:
+        case TR::InstOpCode::ADDSDRegReg:
+        case TR::InstOpCode::ADDSDRegMem:
+        case TR::InstOpCode::ADDPDRegReg:
+        case TR::InstOpCode::SUBSSRegReg:
+        case TR::InstOpCode::SUBSSRegMem:
+        case TR::InstOpCode::SUBPSRegReg:
+        case TR::InstOpCode::SUBSDRegReg:
+        case TR::InstOpCode::SUBSDRegMem:
+        case TR::InstOpCode::SUBPDRegReg:
+        case TR::InstOpCode::MINPSRegReg:
+        case TR::InstOpCode::MINPDRegReg:
+        case TR::InstOpCode::MAXPSRegReg:
+        case TR::InstOpCode::MAXPDRegReg:
+            return TR::X86InstructionScheduler::FPAdd;
+
+        case TR::InstOpCode::MULSSRegReg:
+        case TR::InstOpCode::MULSSRegMem:
+        case TR::InstOpCode::MULPSRegReg:
+        case TR::InstOpCode::MULSDRegReg:
+        case TR::InstOpCode::MULSDRegMem:
+        case TR::InstOpCode::MULPDRegReg:
+        case TR::InstOpCode::PMULLWRegReg:
+        case TR::InstOpCode::PMULLDRegReg:
+        case TR::InstOpCode::VFMADD213PDRegRegReg:
+        case TR::InstOpCode::VFMADD213PSRegRegReg:
+        case TR::InstOpCode::VFMADD132SSRegRegReg:
+        case TR::InstOpCode::VFMADD132SSRegRegMem:
+        case TR::InstOpCode::VFMADD213SSRegRegReg:
+        case TR::InstOpCode::VFMADD213SSRegRegMem:
+        case TR::InstOpCode::VFMADD231SSRegRegReg:
+        case TR::InstOpCode::VFMADD231SSRegRegMem:
+        case TR::InstOpCode::VFMADD132SDRegRegReg:
+        case TR::InstOpCode::VFMADD132SDRegRegMem:
+        case TR::InstOpCode::VFMADD213SDRegRegReg:
+        case TR::InstOpCode::VFMADD213SDRegRegMem:
+        case TR::InstOpCode::VFMADD231SDRegRegReg:
+        case TR::InstOpCode::VFMADD231SDRegRegMem:
+            return TR::X86InstructionScheduler::FPMultiply;
+
+        case TR::InstOpCode::DIVSSRegReg:
+        case TR::InstOpCode::DIVSSRegMem:
+        case TR::InstOpCode::DIVPSRegReg:
+        case TR::InstOpCode::DIVSDRegReg:
+        case TR::InstOpCode::DIVSDRegMem:
+        case TR::InstOpCode::DIVPDRegReg:
+            return TR::X86InstructionScheduler::FPDivide;
+
+        case TR::InstOpCode::SQRTSSRegReg:
+        case TR::InstOpCode::SQRTSDRegReg:
+        case TR::InstOpCode::SQRTPSRegReg:
+        case TR::InstOpCode::VSQRTPSRegMem:
+        case TR::InstOpCode::VSQRTPDRegReg:
+        case TR::InstOpCode::VSQRTPDRegMem:
+            return TR::X86InstructionScheduler::FPSqrt;
+
+        case TR::InstOpCode::CVTSI2SSRegReg4:
+        case TR::InstOpCode::CVTSI2SSRegReg8:
+        case TR::InstOpCode::CVTSI2SSRegMem:
+        case TR::InstOpCode::CVTSI2SSRegMem8:
+        case TR::InstOpCode::CVTSI2SDRegReg4:
+        case TR::InstOpCode::CVTSI2SDRegReg8:
+        case TR::InstOpCode::CVTSI2SDRegMem:
+        case TR::InstOpCode::CVTSI2SDRegMem8:
+        case TR::InstOpCode::CVTTSS2SIReg4Reg:
+        case TR::InstOpCode::CVTTSS2SIReg8Reg:
+        case TR::InstOpCode::CVTTSS2SIReg4Mem:
+        case TR::InstOpCode::CVTTSS2SIReg8Mem:
+        case TR::InstOpCode::CVTTSD2SIReg4Reg:
+        case TR::InstOpCode::CVTTSD2SIReg8Reg:
+        case TR::InstOpCode::CVTTSD2SIReg4Mem:
+        case TR::InstOpCode::CVTTSD2SIReg8Mem:
+        case TR::InstOpCode::CVTSS2SDRegReg:
+        case TR::InstOpCode::CVTSS2SDRegMem:
+        case TR::InstOpCode::CVTSD2SSRegReg:
+        case TR::InstOpCode::CVTSD2SSRegMem:
+            return TR::X86InstructionScheduler::FPConvert;
+
+        case TR::InstOpCode::IMUL2RegReg:
+        case TR::InstOpCode::IMUL4RegReg:
+        case TR::InstOpCode::IMUL8RegReg:
+        case TR::InstOpCode::IMUL2RegMem:
+        case TR::InstOpCode::IMUL4RegMem:
+        case TR::InstOpCode::IMUL8RegMem:
+        case TR::InstOpCode::IMUL2RegRegImm2:
+        case TR::InstOpCode::IMUL2RegRegImms:
+        case TR::InstOpCode::IMUL4RegRegImm4:
+        case TR::InstOpCode::IMUL8RegRegImm4:
+        case TR::InstOpCode::IMUL4RegRegImms:
+        case TR::InstOpCode::IMUL8RegRegImms:
+        case TR::InstOpCode::IMUL2RegMemImm2:
+        case TR::InstOpCode::IMUL2RegMemImms:
+        case TR::InstOpCode::IMUL4RegMemImm4:
+        case TR::InstOpCode::IMUL8RegMemImm4:
+        case TR::InstOpCode::IMUL4RegMemImms:
+        case TR::InstOpCode::IMUL8RegMemImms:
+            return TR::X86InstructionScheduler::IntMultiply;
+
+        case TR::InstOpCode::LEA2RegMem:
+        case TR::InstOpCode::LEA4RegMem:
+        case TR::InstOpCode::LEA8RegMem:
+            return TR::X86InstructionScheduler::IntAlu;
+
+        default:
+            break;
+    }
+
+    // Anything that only writes its target is a register or memory move, a
+    // conditional move or a setcc
+    if (op.modifiesTarget() && !op.usesTarget() && !op.modifiesSource() && op.getModifiedEFlags() == 0)
+        return TR::X86InstructionScheduler::Move;
+
+    if (op.fprOp() || op.hasXMMTarget() || op.hasYMMTarget() || op.hasZMMTarget())
+        return TR::X86InstructionScheduler::VectorAlu;
+
+    return TR::X86InstructionScheduler::IntAlu;
+}
+
+static bool isLEA(TR::InstOpCode &op)
+{
+    return op.getOpCodeValue() == TR::InstOpCode::LEA2RegMem || op.getOpCodeValue() == TR::InstOpCode::LEA4RegMem
+        || op.getOpCodeValue() == TR::InstOpCode::LEA8RegMem;
+}
+
+// Number of a register that may be tracked by the scheduler, NoReg if there
+// is no register, or -1 if the register is not a general purpose or XMM real
+// register
+//
+static int32_t trackedRegisterNumber(TR::Register *reg)
+{
+    if (reg == NULL)
+        return TR::RealRegister::NoReg;
+
+    TR::RealRegister *realReg = reg->getRealRegister();
+    if (realReg == NULL)
+        return -1;
+
+    TR::RealRegister::RegNum num = realReg->getRegisterNumber();
+    if ((num >= TR::RealRegister::FirstGPR && num <= TR::RealRegister::LastGPR) || num == TR::RealRegister::vfp
+        || (num >= TR::RealRegister::FirstXMMR && num <= TR::RealRegister::LastXMMR))
+        return num;
+
+    return -1;
+}
+
+static bool isGPR(int32_t num) { return num >= TR::RealRegister::FirstGPR && num <= TR::RealRegister::LastGPR; }
+
+static bool isXMMR(int32_t num) { return num >= TR::RealRegister::FirstXMMR && num <= TR::RealRegister::LastXMMR; }
+
+// The opcode properties of many SSE and AVX instructions say neither that they
+// read nor that they write their target, so the target of any instruction that
+// touches a vector register is taken to be both read and written
+//
+static bool isVectorInstruction(TR::Instruction *instr)
+{
+    TR::InstOpCode &op = instr->getOpCode();
+    if (op.hasXMMSource() || op.hasXMMTarget() || op.hasYMMSource() || op.hasYMMTarget() || op.hasZMMSource()
+        || op.hasZMMTarget())
+        return true;
+
+    return isXMMR(trackedRegisterNumber(instr->getTargetRegister()))
+        || isXMMR(trackedRegisterNumber(instr->getSourceRegister()))
+        || isXMMR(trackedRegisterNumber(instr->getSource2ndRegister()));
+}
+
+static bool memoryIsTarget(TR::Instruction *instr)
+{
+    switch (instr->getKind()) {
+        case TR::Instruction::IsMem:
+        case TR::Instruction::IsMemImm:
+        case TR::Instruction::IsMemReg:
+        case TR::Instruction::IsMemRegImm:
+            return true;
+        default:
+            return false;
+    }
+}
+
+TR::X86InstructionScheduler::X86InstructionScheduler(TR::CodeGenerator *cg)
+    : _cg(cg)
+    , _comp(cg->comp())
+    , _model(machineModelFor(cg->comp()))
+    , _trace(cg->comp()->getOption(TR_TraceInstructionScheduling))
+    , _nodes(NULL)
+    , _edges(NULL)
+    , _originalOrder(NULL)
+    , _scheduledOrder(NULL)
+{}
+
+bool TR::X86InstructionScheduler::isSchedulable(TR::Instruction *instr)
+{
+    switch (instr->getKind()) {
+        case TR::Instruction::IsReg:
+        case TR::Instruction::IsRegReg:
+        case TR::Instruction::IsRegImm:
+        case TR::Instruction::IsRegImm64:
+        case TR::Instruction::IsRegRegImm:
+        case TR::Instruction::IsRegRegReg:
+        case TR::Instruction::IsRegMem:
+        case TR::Instruction::IsRegMemImm:
+        case TR::Instruction::IsRegRegMem:
+        case TR::Instruction::IsMem:
+        case TR::Instruction::IsMemImm:
+        case TR::Instruction::IsMemReg:
+        case TR::Instruction::IsMemRegImm:
+            break;
+        default:
+            return false;
+    }
+
+    // The register assigner expresses register constraints, including the
+    // implicit operands of instructions such as div, with dependency
+    // conditions; the instructions they are attached to stay where they are
+    if (instr->getDependencyConditions() || instr->needsGCMap() || instr->getGCMap() || instr->isPatchBarrier(_cg))
+        return false;
+
+    TR::InstOpCode &op = instr->getOpCode();
+    if (op.isBranchOp() || op.isCallOp() || op.isPushOp() || op.isPopOp() || op.isPseudoOp() || op.needsRepPrefix()
+        || op.needsLockPrefix() || (op.supportsLockPrefix() && op.modifiesSource()) || op.hasTargetRegisterIgnored()
+        || op.hasSourceRegisterIgnored() || op.targetRegIsImplicit() || op.sourceRegIsImplicit() || op.info().isX87()
+        || op.getOpCodeValue() == TR::InstOpCode::PCMPESTRI)
+        return false;
+
+    TR::Register *regs[3] = { instr->getTargetRegister(), instr->getSourceRegister(), instr->getSource2ndRegister() };
+    for (int32_t i = 0; i < 3; i++) {
+        if (trackedRegisterNumber(regs[i]) < 0)
+            return false;
+    }
+
+    // The stack pointer, and with it the virtual frame pointer, must not change
+    // within a region
+    int32_t target = trackedRegisterNumber(regs[0]);
+    if ((op.modifiesTarget() || isVectorInstruction(instr)) && (target == TR::RealRegister::esp || target == TR::RealRegister::vfp))
+        return false;
+    int32_t source = trackedRegisterNumber(regs[1]);
+    if (op.modifiesSource() && (source == TR::RealRegister::esp || source == TR::RealRegister::vfp))
+        return false;
+
+    TR::MemoryReference *mr = instr->getMemoryReference();
+    if (mr) {
+        if (mr->getUnresolvedDataSnippet() || mr->hasUnresolvedDataSnippet() || mr->getSymbolReference().isUnresolved())
+            return false;
+
+        if (trackedRegisterNumber(mr->getBaseRegister()) < 0 || trackedRegisterNumber(mr->getIndexRegister()) < 0)
+            return false;
+
+        if (mr->requiresLockPrefix() || mr->processAsLongVolatileLow() || mr->processAsLongVolatileHigh()
+            || mr->processAsFPVolatile())
+            return false;
+
+        // Volatile accesses order the accesses around them
+        TR::Symbol *symbol = mr->getSymbolReference().getSymbol();
+        if (symbol && symbol->isVolatile() && !mr->ignoreVolatile())
+            return false;
+    }
+
+    return true;
+}
+
+int32_t TR::X86InstructionScheduler::perform()
+{
+    TR::StackMemoryRegion stackMemoryRegion(*_comp->trMemory());
+
+    _nodes = new (stackMemoryRegion) Node[MAX_REGION_SIZE];
+    _edges = new (stackMemoryRegion) int8_t[MAX_REGION_SIZE * MAX_REGION_SIZE];
+    _originalOrder = new (stackMemoryRegion) int32_t[MAX_REGION_SIZE];
+    _scheduledOrder = new (stackMemoryRegion) int32_t[MAX_REGION_SIZE];
+
+    logprintf(_trace, _comp->log(), "Scheduling instructions of %s for %s\n", _comp->signature(), _model->_name);
+
+    int32_t numScheduled = 0;
+    TR::Instruction *first = NULL;
+    TR::Instruction *last = NULL;
+    int32_t size = 0;
+
+    TR::Instruction *next = NULL;
+    for (TR::Instruction *instr = _cg->getFirstInstruction(); instr; instr = next) {
+        next = instr->getNext();
+
+        bool schedulable = isSchedulable(instr);
+        if (schedulable) {
+            if (!first)
+                first = instr;
+            last = instr;
+            size++;
+        }
+
+        if (first && (!schedulable || size == MAX_REGION_SIZE || !next)) {
+            if (size > 2 && scheduleRegion(first, last, size))
+                numScheduled++;
+
+            first = NULL;
+            last = NULL;
+            size = 0;
+        }
+    }
+
+    return numScheduled;
+}
+
+void TR::X86InstructionScheduler::buildNode(Node &node, TR::Instruction *instr)
+{
+    TR::InstOpCode &op = instr->getOpCode();
+
+    node._instruction = instr;
+    node._memoryReference = NULL;
+    node._loads = false;
+    node._stores = false;
+    node._readOnlyLoad = false;
+    node._baseRegister = -1;
+    node._indexRegister = -1;
+    node._baseVersion = 0;
+    node._indexVersion = 0;
+    node._accessSize = 0;
+
+    OperationClass opClass = operationClass(op);
+
+    TR::MemoryReference *mr = instr->getMemoryReference();
+    if (mr && !isLEA(op)) {
+        node._memoryReference = mr;
+        if (memoryIsTarget(instr)) {
+            bool vector = isVectorInstruction(instr);
+            node._stores = op.modifiesTarget() || vector;
+            node._loads = op.usesTarget() || !op.modifiesTarget() || vector;
+        } else {
+            node._loads = true;
+            node._stores = op.modifiesSource() != 0;
+        }
+
+        node._readOnlyLoad = !node._stores && mr->getLabel() && !mr->getBaseRegister() && !mr->getIndexRegister();
+
+        // An upper bound on the size of the access is enough to tell apart
+        // disjoint slots of the same base; operations on vector registers may
+        // be encoded at any vector length, so assume the widest
+        bool onlyGPRs = op.gprOp() && !op.hasXMMSource() && !op.hasXMMTarget() && !op.hasYMMSource()
+            && !op.hasYMMTarget() && !op.hasZMMSource() && !op.hasZMMTarget();
+        TR::Register *regs[3] = { instr->getTargetRegister(), instr->getSourceRegister(),
+            instr->getSource2ndRegister() };
+        for (int32_t i = 0; i < 3; i++) {
+            int32_t num = trackedRegisterNumber(regs[i]);
+            if (num != TR::RealRegister::NoReg && !isGPR(num))
+                onlyGPRs = false;
+        }
+        node._accessSize = onlyGPRs ? 8 : 64;
+    }
+
+    if (opClass == Move && node._memoryReference)
+        node._unit = NoUnit;
+    else if (opClass == IntAlu || opClass == Move)
+        node._unit = ALU;
+    else if (opClass == IntMultiply)
+        node._unit = Multiplier;
+    else if (opClass == FPDivide || opClass == FPSqrt)
+        node._unit = Divider;
+    else
+        node._unit = FP;
+
+    node._latency = _model->_latencies[opClass];
+    if (node._loads)
+        node._latency += _model->_loadLatency - (opClass == Move ? 1 : 0);
+}
+
+void TR::X86InstructionScheduler::addEdge(int32_t from, int32_t to, int32_t latency)
+{
+    int8_t &edge = _edges[from * MAX_REGION_SIZE + to];
+    if (edge < latency)
+        edge = (int8_t)latency;
+}
+
+bool TR::X86InstructionScheduler::mayConflict(Node &a, Node &b)
+{
+    if (!a._stores && !b._stores)
+        return false;
+
+    if ((a._readOnlyLoad && !b._stores) || (b._readOnlyLoad && !a._stores))
+        return false;
+
+    TR::MemoryReference *amr = a._memoryReference;
+    TR::MemoryReference *bmr = b._memoryReference;
+
+    // Accesses are disjoint only if their addresses differ by a constant:
+    // the same base and index register values and the same scale
+    if (amr->getLabel() || bmr->getLabel() || a._baseRegister != b._baseRegister
+        || a._indexRegister != b._indexRegister || a._baseVersion != b._baseVersion
+        || a._indexVersion != b._indexVersion || amr->getStride() != bmr->getStride())
+        return true;
+
+    intptr_t aStart = amr->getDisplacement();
+    intptr_t bStart = bmr->getDisplacement();
+    return aStart < bStart + b._accessSize && bStart < aStart + a._accessSize;
+}
+
+void TR::X86InstructionScheduler::buildDependences(int32_t size)
+{
+    const int32_t numRegisters = TR::RealRegister::NumRegisters;
+    int32_t lastDef[numRegisters];
+    int16_t version[numRegisters];
+    for (int32_t r = 0; r < numRegisters; r++) {
+        lastDef[r] = -1;
+        version[r] = 0;
+    }
+
+    memset(_edges, -1, sizeof(_edges[0]) * MAX_REGION_SIZE * MAX_REGION_SIZE);
+
+    // A flag write only has to stay ordered with respect to the other flag
+    // accesses if some instruction reads the flags it produces. Flags are
+    // assumed to be live at the end of the region.
+    bool flagsLive[MAX_REGION_SIZE];
+    bool flagsRead = true;
+    for (int32_t i = size - 1; i >= 0; i--) {
+        TR::InstOpCode &op = _nodes[i]._instruction->getOpCode();
+        uint8_t modified = op.getModifiedEFlags();
+        uint8_t tested = op.getTestedEFlags();
+
+        flagsLive[i] = false;
+        if (modified) {
+            flagsLive[i] = flagsRead;
+            flagsRead = false;
+        }
+
+        // An instruction that preserves some flags passes them through
+        if (tested || (modified && modified != 0x1f))
+            flagsRead = true;
+    }
+
+    int32_t lastFlagsDef = -1;
+    int32_t flagsReaders[MAX_REGION_SIZE];
+    int32_t numFlagsReaders = 0;
+    int32_t deadFlagsWriters[MAX_REGION_SIZE];
+    int32_t numDeadFlagsWriters = 0;
+
+    for (int32_t i = 0; i < size; i++) {
+        Node &node = _nodes[i];
+        TR::Instruction *instr = node._instruction;
+        TR::InstOpCode &op = instr->getOpCode();
+
+        int32_t uses[5];
+        int32_t numUses = 0;
+        int32_t defs[2];
+        int32_t numDefs = 0;
+
+        int32_t target = trackedRegisterNumber(instr->getTargetRegister());
+        int32_t source = trackedRegisterNumber(instr->getSourceRegister());
+        int32_t source2 = trackedRegisterNumber(instr->getSource2ndRegister());
+
+        if (target != TR::RealRegister::NoReg) {
+            bool vector = isVectorInstruction(instr);
+            if (op.modifiesTarget() || vector)
+                defs[numDefs++] = target;
+            if (op.usesTarget() || !op.modifiesTarget() || vector)
+                uses[numUses++] = target;
+        }
+        if (source != TR::RealRegister::NoReg) {
+            uses[numUses++] = source;
+            if (op.modifiesSource())
+                defs[numDefs++] = source;
+        }
+        if (source2 != TR::RealRegister::NoReg)
+            uses[numUses++] = source2;
+
+        TR::MemoryReference *mr = instr->getMemoryReference();
+        if (mr) {
+            int32_t base = trackedRegisterNumber(mr->getBaseRegister());
+            int32_t index = trackedRegisterNumber(mr->getIndexRegister());
+            if (base != TR::RealRegister::NoReg)
+                uses[numUses++] = base;
+            if (index != TR::RealRegister::NoReg)
+                uses[numUses++] = index;
+
+            node._baseRegister = (int16_t)base;
+            node._indexRegister = (int16_t)index;
+            node._baseVersion = version[base];
+            node._indexVersion = version[index];
+        }
+
+        // True dependences
+        for (int32_t u = 0; u < numUses; u++) {
+            int32_t producer = lastDef[uses[u]];
+            if (producer >= 0)
+                addEdge(producer, i, _nodes[producer]._latency);
+        }
+
+        // Anti and output dependences
+        for (int32_t d = 0; d < numDefs; d++) {
+            int32_t reg = defs[d];
+            for (int32_t j = lastDef[reg] + 1; j < i; j++) {
+                TR::Instruction *other = _nodes[j]._instruction;
+                TR::MemoryReference *otherMR = other->getMemoryReference();
+                if (trackedRegisterNumber(other->getTargetRegister()) == reg
+                    || trackedRegisterNumber(other->getSourceRegister()) == reg
+                    || trackedRegisterNumber(other->getSource2ndRegister()) == reg
+                    || (otherMR
+                        && (trackedRegisterNumber(otherMR->getBaseRegister()) == reg
+                            || trackedRegisterNumber(otherMR->getIndexRegister()) == reg)))
+                    addEdge(j, i, 0);
+            }
+            if (lastDef[reg] >= 0)
+                addEdge(lastDef[reg], i, 0);
+        }
+        for (int32_t d = 0; d < numDefs; d++) {
+            lastDef[defs[d]] = i;
+            version[defs[d]]++;
+        }
+
+        // Flags
+        uint8_t modified = op.getModifiedEFlags();
+        if (op.getTestedEFlags() || (modified && modified != 0x1f)) {
+            if (lastFlagsDef >= 0)
+                addEdge(lastFlagsDef, i, _nodes[lastFlagsDef]._latency);
+            flagsReaders[numFlagsReaders++] = i;
+        }
+        if (modified) {
+            for (int32_t r = 0; r < numFlagsReaders; r++) {
+                if (flagsReaders[r] != i)
+                    addEdge(flagsReaders[r], i, 0);
+            }
+
+            if (flagsLive[i]) {
+                for (int32_t w = 0; w < numDeadFlagsWriters; w++)
+                    addEdge(deadFlagsWriters[w], i, 0);
+                if (lastFlagsDef >= 0)
+                    addEdge(lastFlagsDef, i, 0);
+                lastFlagsDef = i;
+                numFlagsReaders = 0;
+                numDeadFlagsWriters = 0;
+            } else {
+                deadFlagsWriters[numDeadFlagsWriters++] = i;
+            }
+        }
+
+        // Memory
+        if (node._memoryReference) {
+            for (int32_t j = 0; j < i; j++) {
+                Node &other = _nodes[j];
+                if (other._memoryReference && mayConflict(other, node))
+                    addEdge(j, i, (other._stores && node._loads) ? _model->_storeForwardingLatency : 0);
+            }
+        }
+    }
+
+    // Critical path heights
+    for (int32_t i = size - 1; i >= 0; i--) {
+        int32_t height = _nodes[i]._latency;
+        for (int32_t j = i + 1; j < size; j++) {
+            int32_t latency = _edges[i * MAX_REGION_SIZE + j];
+            if (latency >= 0 && latency + _nodes[j]._height > height)
+                height = latency + _nodes[j]._height;
+        }
+        _nodes[i]._height = height;
+    }
+}
+
+// Issues the instructions of the region cycle by cycle, either strictly in
+// their original order or, when inOriginalOrder is false, choosing the ready
+// instruction with the greatest height. The issue order is returned in order
+// and the cycle in which the last result becomes available is returned.
+//
+int32_t TR::X86InstructionScheduler::simulate(int32_t size, bool inOriginalOrder, int32_t *order)
+{
+    for (int32_t i = 0; i < size; i++) {
+        _nodes[i]._earliestCycle = 0;
+        _nodes[i]._issueCycle = -1;
+        _nodes[i]._numPredecessors = 0;
+    }
+    for (int32_t i = 0; i < size; i++) {
+        for (int32_t j = i + 1; j < size; j++) {
+            if (_edges[i * MAX_REGION_SIZE + j] >= 0)
+                _nodes[j]._numPredecessors++;
+        }
+    }
+
+    int32_t numIssued = 0;
+    int32_t cycle = 0;
+    int32_t dividerFreeCycle = 0;
+    int32_t completionCycle = 0;
+
+    while (numIssued < size) {
+        int32_t issuedThisCycle = 0;
+        int32_t unitsUsed[NumExecutionUnits] = { 0 };
+
+        while (issuedThisCycle < _model->_issueWidth && numIssued < size) {
+            int32_t chosen = -1;
+            for (int32_t i = 0; i < size; i++) {
+                Node &node = _nodes[i];
+                if (node._issueCycle >= 0)
+                    continue;
+
+                bool canIssue = node._numPredecessors == 0 && node._earliestCycle <= cycle;
+                if (canIssue && node._unit != NoUnit) {
+                    canIssue = unitsUsed[node._unit] < _model->_units[node._unit];
+                    if (node._unit == Divider && cycle < dividerFreeCycle)
+                        canIssue = false;
+                }
+                if (canIssue && node._loads && unitsUsed[Load] >= _model->_units[Load])
+                    canIssue = false;
+                if (canIssue && node._stores && unitsUsed[Store] >= _model->_units[Store])
+                    canIssue = false;
+
+                if (inOriginalOrder) {
+                    // Only the oldest instruction that has not issued may issue
+                    if (canIssue)
+                        chosen = i;
+                    break;
+                }
+
+                if (canIssue && (chosen < 0 || node._height > _nodes[chosen]._height))
+                    chosen = i;
+            }
+
+            if (chosen < 0)
+                break;
+
+            Node &node = _nodes[chosen];
+            node._issueCycle = cycle;
+            if (node._unit != NoUnit)
+                unitsUsed[node._unit]++;
+            if (node._unit == Divider)
+                dividerFreeCycle = cycle + _model->_divideOccupancy;
+            if (node._loads)
+                unitsUsed[Load]++;
+            if (node._stores)
+                unitsUsed[Store]++;
+
+            if (cycle + node._latency > completionCycle)
+                completionCycle = cycle + node._latency;
+
+            for (int32_t j = chosen + 1; j < size; j++) {
+                int32_t latency = _edges[chosen * MAX_REGION_SIZE + j];
+                if (latency >= 0) {
+                    _nodes[j]._numPredecessors--;
+                    if (cycle + latency > _nodes[j]._earliestCycle)
+                        _nodes[j]._earliestCycle = cycle + latency;
+                }
+            }
+
+            order[numIssued++] = chosen;
+            issuedThisCycle++;
+        }
+
+        cycle++;
+    }
+
+    return completionCycle;
+}
+
+bool TR::X86InstructionScheduler::scheduleRegion(TR::Instruction *first, TR::Instruction *last, int32_t size)
+{
+    int32_t i = 0;
+    for (TR::Instruction *instr = first; i < size; instr = instr->getNext())
+        buildNode(_nodes[i++], instr);
+
+    buildDependences(size);
+
+    int32_t originalCycles = simulate(size, true, _originalOrder);
+    int32_t scheduledCycles = simulate(size, false, _scheduledOrder);
+
+    logprintf(_trace, _comp->log(), "Region of %d instructions from %p to %p: %d cycles in original order, %d scheduled\n",
+        size, first, last, originalCycles, scheduledCycles);
+
+    if (scheduledCycles >= originalCycles)
+        return false;
+
+    if (!performTransformation(_comp, "O^O INSTRUCTION SCHEDULING: reorder %d instructions starting at %p\n", size,
+            first))
+        return false;
+
+    TR::Instruction *prev = first->getPrev();
+    TR::Instruction *next = last->getNext();
+
+    for (i = 0; i < size; i++) {
+        TR::Instruction *instr = _nodes[_scheduledOrder[i]]._instruction;
+        instr->setPrev(prev);
+        if (prev)
+            prev->setNext(instr);
+        else
+            _cg->setFirstInstruction(instr);
+        prev = instr;
+    }
+
+    prev->setNext(next);
+    if (next)
+        next->setPrev(prev);
+    else
+        _cg->setAppendInstruction(prev);
+
+    return true;
+}
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef X86INSTRUCTIONSCHEDULER_INCL
+#define X86INSTRUCTIONSCHEDULER_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "infra/vector.hpp"
+
+namespace TR {
+class CodeGenerator;
+class Compilation;
+class Instruction;
+class MemoryReference;
+} // namespace TR
+
+namespace TR {
+
+/**
+ * @brief Post register assignment list scheduler for x86.
+ *
+ * The instruction stream is split into regions: maximal runs of instructions
+ * whose register, flag and memory effects are fully described by their
+ * operands. Labels, branches, calls, instructions with register dependency
+ * conditions or GC maps, and anything with implicit operands end a region, so
+ * no instruction ever moves across a basic block boundary or a point where the
+ * register assigner pinned a register.
+ *
+ * Within a region, a dependence graph is built from true, anti and output
+ * dependences on real registers, EFLAGS and memory, and the instructions are
+ * list scheduled top-down by critical path height against a model of the
+ * target microarchitecture. The new order is kept only if the model predicts
+ * that it completes sooner than the original one.
+ */
+class X86InstructionScheduler {
+public:
+    TR_ALLOC(TR_Memory::CodeGenerator)
+
+    X86InstructionScheduler(TR::CodeGenerator *cg);
+
+    /**
+     * @brief Schedules every region of the method
+     *
+     * @return the number of regions that were reordered
+     */
+    int32_t perform();
+
+    // Largest number of instructions scheduled as a unit
+    static const int32_t MAX_REGION_SIZE = 128;
+
+    enum ExecutionUnit {
+        NoUnit = -1,
+        ALU = 0,
+        Multiplier,
+        Load,
+        Store,
+        FP,
+        Divider,
+        NumExecutionUnits
+    };
+
+    enum OperationClass {
+        IntAlu = 0,
+        IntMultiply,
+        Move,
+        FPAdd,
+        FPMultiply,
+        FPDivide,
+        FPSqrt,
+        FPConvert,
+        VectorAlu,
+        NumOperationClasses
+    };
+
+    /**
+     * @brief Issue width, execution units and latencies of a microarchitecture
+     */
+    struct MachineModel {
+        const char *_name;
+        uint8_t _issueWidth;
+        uint8_t _units[NumExecutionUnits];
+        uint8_t _latencies[NumOperationClasses];
+        uint8_t _loadLatency;
+        uint8_t _storeForwardingLatency;
+        uint8_t _divideOccupancy; // cycles the divider cannot accept another operation
+    };
+
+    static const MachineModel *machineModelFor(TR::Compilation *comp);
+
+private:
+    struct Node {
+        TR::Instruction *_instruction;
+        TR::MemoryReference *_memoryReference; // NULL if the instruction does not access memory
+        int32_t _latency;
+        int32_t _height; // longest latency path to the end of the region
+        int32_t _earliestCycle;
+        int32_t _issueCycle;
+        int32_t _numPredecessors;
+        int8_t _unit;
+        bool _loads;
+        bool _stores;
+        bool _readOnlyLoad; // loads from a constant data snippet
+        int16_t _baseRegister; // real register numbers of the memory reference, or -1
+        int16_t _indexRegister;
+        int16_t _baseVersion; // number of definitions of the register earlier in the region
+        int16_t _indexVersion;
+        int32_t _accessSize; // upper bound on the bytes accessed
+    };
+
+    bool isSchedulable(TR::Instruction *instr);
+
+    bool scheduleRegion(TR::Instruction *first, TR::Instruction *last, int32_t size);
+    void buildNode(Node &node, TR::Instruction *instr);
+    void buildDependences(int32_t size);
+    void addEdge(int32_t from, int32_t to, int32_t latency);
+    bool mayConflict(Node &a, Node &b);
+    int32_t simulate(int32_t size, bool inOriginalOrder, int32_t *order);
+
+    TR::CodeGenerator *_cg;
+    TR::Compilation *_comp;
+    const MachineModel *_model;
+    bool _trace;
+
+    Node *_nodes;
+
+    // _edges[from * MAX_REGION_SIZE + to] is the latency of the edge, or -1
+    int8_t *_edges;
+
+    int32_t *_originalOrder;
+    int32_t *_scheduledOrder;
+};
+
+} // namespace TR
+
+#endif
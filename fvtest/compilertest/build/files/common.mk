@@ -100,6 +100,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/ras/LogTracer.cpp \
     $(JIT_OMR_DIRTY_DIR)/ras/OptionsDebug.cpp \
     $(JIT_OMR_DIRTY_DIR)/ras/Tree.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/AggregateEscapeAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/AsyncCheckInsertion.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/BackwardBitVectorAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/BackwardIntersectionBitVectorAnalysis.cpp \
@@ -140,6 +141,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/LocalLiveRangeReducer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LocalReordering.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LocalTransparency.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/LoopAliasRefiner.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopCanonicalizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopReducer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LoopReplicator.cpp \
@@ -147,8 +149,10 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRLocalCSE.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LocalDeadStoreElimination.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/LocalOpts.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/NodeSignatureTable.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMROptimization.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMROptimizationManager.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/OptimizationStatistics.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRTransformUtil.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OrderBlocks.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OSRDefAnalysis.cpp \
@@ -251,6 +255,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_OMR_DIRTY_DIR)/runtime/Runtime.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/Trampoline.cpp \
     $(JIT_OMR_DIRTY_DIR)/control/CompileMethod.cpp \
+    $(JIT_OMR_DIRTY_DIR)/control/TieredCompilation.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/OMRIO.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/OMRKnownObjectTable.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/Globals.cpp \
@@ -279,6 +284,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheMemorySegment.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheConfig.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRRSSReport.cpp \
+    $(JIT_OMR_DIRTY_DIR)/runtime/PerfJitDump.cpp \
     $(JIT_PRODUCT_DIR)/control/TestJit.cpp \
     $(JIT_PRODUCT_DIR)/ilgen/IlInjector.cpp \
     $(JIT_PRODUCT_DIR)/ilgen/TestIlGeneratorMethodDetails.cpp \
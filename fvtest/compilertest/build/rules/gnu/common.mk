@@ -42,6 +42,11 @@ JIT_PRODUCT_BUILDNAME_SRC=$(FIXED_OBJBASE)/$(JIT_OMR_DIRTY_DIR)/env/TRBuildName.
 JIT_PRODUCT_BUILDNAME_OBJ=$(FIXED_OBJBASE)/$(JIT_OMR_DIRTY_DIR)/env/TRBuildName.o
 JIT_PRODUCT_OBJECTS+=$(JIT_PRODUCT_BUILDNAME_OBJ)
 
+# Add the simplifier's generated rewrite rules
+JIT_PRODUCT_SIMPLIFIER_RULES_SRC=$(FIXED_OBJBASE)/$(JIT_OMR_DIRTY_DIR)/optimizer/OMRSimplifierRules.cpp
+JIT_PRODUCT_SIMPLIFIER_RULES_OBJ=$(FIXED_OBJBASE)/$(JIT_OMR_DIRTY_DIR)/optimizer/OMRSimplifierRules.o
+JIT_PRODUCT_OBJECTS+=$(JIT_PRODUCT_SIMPLIFIER_RULES_OBJ)
+
 # Add GTest
 GTEST_CC=$(GTEST_PATH)/src/gtest-all.cc
 GTEST_OBJ=$(FIXED_OBJBASE)/gtest.o
@@ -75,6 +80,16 @@ JIT_DIR_LIST+=$(dir $(JIT_PRODUCT_BUILDNAME_SRC))
 jit_cleanobjs::
 	rm -f $(JIT_PRODUCT_BUILDNAME_SRC)
 
+$(call RULE.cpp,$(JIT_PRODUCT_SIMPLIFIER_RULES_OBJ),$(JIT_PRODUCT_SIMPLIFIER_RULES_SRC))
+
+$(JIT_PRODUCT_SIMPLIFIER_RULES_SRC): $(SIMPLIFIER_RULES_FILE) $(GENERATE_SIMPLIFIER_RULES_SCRIPT) | jit_createdirs
+	$(PERL_PATH) $(GENERATE_SIMPLIFIER_RULES_SCRIPT) $(SIMPLIFIER_RULES_FILE) $@
+
+JIT_DIR_LIST+=$(dir $(JIT_PRODUCT_SIMPLIFIER_RULES_SRC))
+
+jit_cleanobjs::
+	rm -f $(JIT_PRODUCT_SIMPLIFIER_RULES_SRC)
+
 $(call RULE.cpp,$(GTEST_OBJ),$(GTEST_CC))
 
 #
@@ -74,6 +74,10 @@ endif
 # This is the script that's used to generate TRBuildName.cpp
 GENERATE_VERSION_SCRIPT?=$(JIT_SCRIPT_DIR)/generateVersion.pl
 
+# This is the script that's used to generate the simplifier's rewrite rules
+GENERATE_SIMPLIFIER_RULES_SCRIPT?=$(JIT_SCRIPT_DIR)/generateSimplifierRules.pl
+SIMPLIFIER_RULES_FILE?=$(JIT_SRCBASE)/$(JIT_OMR_DIRTY_DIR)/optimizer/OMRSimplifierRules.rules
+
 # This is the command to check Z assembly files
 ZASM_SCRIPT?=$(JIT_SCRIPT_DIR)/s390m4check.pl
 
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "control/Options.hpp"
+#include "il/Block.hpp"
+#include "il/Node.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/TreeTop.hpp"
+#include "ras/IlVerifier.hpp"
+
+/**
+ * Test fixture that runs only block ordering, with the Ext-TSP layout enabled.
+ */
+class ExtTSPBlockOrderingTest : public TRTest::JitOptTest
+   {
+
+   public:
+   ExtTSPBlockOrderingTest()
+      {
+      TR::Options::getCmdLineOptions()->setOption(TR_EnableExtTSPBlockOrdering);
+      addOptimization(OMR::basicBlockOrdering);
+      }
+
+   };
+
+/**
+ * Checks that the return of the given value is the last real tree of the method,
+ * i.e. that the block holding it was laid out after all other blocks.
+ */
+class ReturnIsLastIlVerifier : public TR::IlVerifier
+   {
+   public:
+   ReturnIsLastIlVerifier(int32_t value) : _value(value) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      TR::Node *lastNode = NULL;
+      for (TR::TreeTop *tt = sym->getFirstTreeTop(); tt; tt = tt->getNextTreeTop())
+         {
+         TR::ILOpCodes op = tt->getNode()->getOpCodeValue();
+         if (op != TR::BBStart && op != TR::BBEnd)
+            lastNode = tt->getNode();
+         }
+
+      if (lastNode == NULL || lastNode->getOpCodeValue() != TR::ireturn)
+         return 1;
+
+      TR::Node *child = lastNode->getFirstChild();
+      if (child->getOpCodeValue() != TR::iconst || child->getInt() != _value)
+         return 1;
+
+      return 0;
+      }
+
+   private:
+   int32_t _value;
+   };
+
+/*
+ * The rarely executed block is between the entry and the hot block in the
+ * original order, so the hot path has to be made the fall-through.
+ */
+TEST_F(ExtTSPBlockOrderingTest, HotPathBecomesFallThrough) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                       "
+                      " (block name=\"entry\" frequency=1000                   "
+                      "  (ificmpgt target=\"hot\" (iload parm=0) (iconst 0)))  "
+                      " (block name=\"rare\" frequency=1                       "
+                      "  (ireturn (iconst -1)))                                "
+                      " (block name=\"hot\" frequency=999                      "
+                      "  (istore temp=\"x\" (iadd (iload parm=0) (iconst 1)))  "
+                      "  (ificmpgt target=\"rare\" (iload temp=\"x\") (iconst 1000)))"
+                      " (block name=\"done\" frequency=999                     "
+                      "  (ireturn (iload temp=\"x\"))))                        ";
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ReturnIsLastIlVerifier verifier(-1);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed or rare block was not laid out last\n"
+                                                          << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(-1, entry_point(0));
+    EXPECT_EQ(-1, entry_point(-5));
+    EXPECT_EQ(2, entry_point(1));
+    EXPECT_EQ(43, entry_point(42));
+    EXPECT_EQ(-1, entry_point(1000));
+}
+
+/*
+ * The loop exit comes textually before the loop, so the loop header and body
+ * have to be moved up to follow the entry.
+ */
+TEST_F(ExtTSPBlockOrderingTest, LoopIsLaidOutBeforeExit) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                                  "
+                      " (block name=\"entry\" frequency=10                                "
+                      "  (istore temp=\"i\" (iconst 0))                                   "
+                      "  (istore temp=\"s\" (iconst 0))                                   "
+                      "  (goto target=\"header\"))                                        "
+                      " (block name=\"exit\" frequency=10                                 "
+                      "  (ireturn (iload temp=\"s\")))                                    "
+                      " (block name=\"header\" frequency=1000                             "
+                      "  (ificmpge target=\"exit\" (iload temp=\"i\") (iload parm=0)))    "
+                      " (block name=\"body\" frequency=1000                               "
+                      "  (istore temp=\"s\" (iadd (iload temp=\"s\") (iload temp=\"i\"))) "
+                      "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))         "
+                      "  (goto target=\"header\")))                                       ";
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(0, entry_point(0));
+    EXPECT_EQ(0, entry_point(1));
+    EXPECT_EQ(45, entry_point(10));
+    EXPECT_EQ(4950, entry_point(100));
+}
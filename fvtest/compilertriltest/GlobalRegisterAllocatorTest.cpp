@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "control/Options.hpp"
+
+/**
+ * Test fixture that compiles with the default strategy, with global registers
+ * assigned by linear scan.
+ */
+class LinearScanGRATest : public TRTest::JitTest
+   {
+
+   public:
+   LinearScanGRATest()
+      {
+      TR::Options::getCmdLineOptions()->setOption(TR_EnableLinearScanGRA);
+      }
+
+   };
+
+TEST_F(LinearScanGRATest, LoopSum) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                                  "
+                      " (block name=\"entry\"                                             "
+                      "  (istore temp=\"i\" (iconst 0))                                   "
+                      "  (istore temp=\"s\" (iconst 0))                                   "
+                      "  (goto target=\"header\"))                                        "
+                      " (block name=\"header\"                                            "
+                      "  (ificmpge target=\"exit\" (iload temp=\"i\") (iload parm=0)))    "
+                      " (block name=\"body\"                                              "
+                      "  (istore temp=\"s\" (iadd (iload temp=\"s\") (iload temp=\"i\"))) "
+                      "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))         "
+                      "  (goto target=\"header\"))                                        "
+                      " (block name=\"exit\"                                              "
+                      "  (ireturn (iload temp=\"s\"))))                                   ";
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(0, entry_point(0));
+    EXPECT_EQ(0, entry_point(1));
+    EXPECT_EQ(45, entry_point(10));
+    EXPECT_EQ(4950, entry_point(100));
+}
+
+/*
+ * More values are live across the loop than there are global registers, so
+ * some candidates have to be evicted or left in memory.
+ */
+TEST_F(LinearScanGRATest, MoreCandidatesThanRegisters) {
+    auto inputTrees = "(method return=Int64 args=[Int64]                                   "
+                      " (block name=\"entry\"                                              "
+                      "  (lstore temp=\"i\" (lconst 0))                                    "
+                      "  (lstore temp=\"a\" (lconst 1))  (lstore temp=\"b\" (lconst 2))    "
+                      "  (lstore temp=\"c\" (lconst 3))  (lstore temp=\"d\" (lconst 4))    "
+                      "  (lstore temp=\"e\" (lconst 5))  (lstore temp=\"f\" (lconst 6))    "
+                      "  (lstore temp=\"g\" (lconst 7))  (lstore temp=\"h\" (lconst 8))    "
+                      "  (lstore temp=\"j\" (lconst 9))  (lstore temp=\"k\" (lconst 10))   "
+                      "  (lstore temp=\"l\" (lconst 11)) (lstore temp=\"m\" (lconst 12))   "
+                      "  (lstore temp=\"n\" (lconst 13)) (lstore temp=\"o\" (lconst 14))   "
+                      "  (lstore temp=\"p\" (lconst 15)) (lstore temp=\"q\" (lconst 16))   "
+                      "  (goto target=\"header\"))                                         "
+                      " (block name=\"header\"                                             "
+                      "  (iflcmpge target=\"exit\" (lload temp=\"i\") (lload parm=0)))     "
+                      " (block name=\"body\"                                               "
+                      "  (lstore temp=\"a\" (ladd (lload temp=\"a\") (lload temp=\"b\")))  "
+                      "  (lstore temp=\"b\" (ladd (lload temp=\"b\") (lload temp=\"c\")))  "
+                      "  (lstore temp=\"c\" (ladd (lload temp=\"c\") (lload temp=\"d\")))  "
+                      "  (lstore temp=\"d\" (ladd (lload temp=\"d\") (lload temp=\"e\")))  "
+                      "  (lstore temp=\"e\" (ladd (lload temp=\"e\") (lload temp=\"f\")))  "
+                      "  (lstore temp=\"f\" (ladd (lload temp=\"f\") (lload temp=\"g\")))  "
+                      "  (lstore temp=\"g\" (ladd (lload temp=\"g\") (lload temp=\"h\")))  "
+                      "  (lstore temp=\"h\" (ladd (lload temp=\"h\") (lload temp=\"j\")))  "
+                      "  (lstore temp=\"j\" (ladd (lload temp=\"j\") (lload temp=\"k\")))  "
+                      "  (lstore temp=\"k\" (ladd (lload temp=\"k\") (lload temp=\"l\")))  "
+                      "  (lstore temp=\"l\" (ladd (lload temp=\"l\") (lload temp=\"m\")))  "
+                      "  (lstore temp=\"m\" (ladd (lload temp=\"m\") (lload temp=\"n\")))  "
+                      "  (lstore temp=\"n\" (ladd (lload temp=\"n\") (lload temp=\"o\")))  "
+                      "  (lstore temp=\"o\" (ladd (lload temp=\"o\") (lload temp=\"p\")))  "
+                      "  (lstore temp=\"p\" (ladd (lload temp=\"p\") (lload temp=\"q\")))  "
+                      "  (lstore temp=\"i\" (ladd (lload temp=\"i\") (lconst 1)))          "
+                      "  (goto target=\"header\"))                                         "
+                      " (block name=\"exit\"                                               "
+                      "  (lreturn (lxor (lload temp=\"a\") (lxor (lload temp=\"h\") (lload temp=\"p\"))))))";
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    // Reference computation of the same loop
+    auto expected = [](int64_t n) -> int64_t {
+        int64_t v[15];
+        for (int32_t x = 0; x < 15; x++)
+            v[x] = x + 1;
+        int64_t q = 16;
+        for (int64_t i = 0; i < n; i++) {
+            for (int32_t x = 0; x < 14; x++)
+                v[x] += v[x + 1];
+            v[14] += q;
+        }
+        return v[0] ^ v[7] ^ v[14];
+    };
+
+    auto entry_point = compiler.getEntryPoint<int64_t (*)(int64_t)>();
+    EXPECT_EQ(expected(0), entry_point(0));
+    EXPECT_EQ(expected(1), entry_point(1));
+    EXPECT_EQ(expected(7), entry_point(7));
+    EXPECT_EQ(expected(50), entry_point(50));
+}
+
+TEST_F(LinearScanGRATest, FloatingPointLoop) {
+    auto inputTrees = "(method return=Double args=[Int32, Double]                          "
+                      " (block name=\"entry\"                                              "
+                      "  (istore temp=\"i\" (iconst 0))                                    "
+                      "  (dstore temp=\"s\" (dconst 0.0))                                  "
+                      "  (goto target=\"header\"))                                         "
+                      " (block name=\"header\"                                             "
+                      "  (ificmpge target=\"exit\" (iload temp=\"i\") (iload parm=0)))     "
+                      " (block name=\"body\"                                               "
+                      "  (dstore temp=\"s\" (dadd (dload temp=\"s\") (dload parm=1)))      "
+                      "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))          "
+                      "  (goto target=\"header\"))                                         "
+                      " (block name=\"exit\"                                               "
+                      "  (dreturn (dload temp=\"s\"))))                                    ";
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<double (*)(int32_t, double)>();
+    EXPECT_DOUBLE_EQ(0.0, entry_point(0, 1.5));
+    EXPECT_DOUBLE_EQ(1.5, entry_point(1, 1.5));
+    EXPECT_DOUBLE_EQ(15.0, entry_point(10, 1.5));
+}
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "env/RawAllocator.hpp"
+#include "env/Region.hpp"
+#include "env/SystemSegmentProvider.hpp"
+#include "optimizer/NodeSignatureTable.hpp"
+
+namespace {
+
+// The table never looks at its nodes, so any distinct pointers will do
+TR::Node *fakeNode(uintptr_t n)
+{
+    return reinterpret_cast<TR::Node *>(n * 16);
+}
+
+} // namespace
+
+class NodeSignatureTableTest : public ::testing::Test {
+public:
+    NodeSignatureTableTest()
+        : _rawAllocator()
+        , _segmentProvider(1 << 16, _rawAllocator)
+        , _region(_segmentProvider, _rawAllocator)
+    {}
+
+protected:
+    TR::RawAllocator _rawAllocator;
+    TR::SystemSegmentProvider _segmentProvider;
+    TR::Region _region;
+};
+
+TEST_F(NodeSignatureTableTest, NodesWithASignatureAreFoundInInsertionOrder)
+{
+    TR::NodeSignatureTable table(_region);
+
+    table.add(7, fakeNode(1));
+    table.add(3, fakeNode(2));
+    table.add(7, fakeNode(3));
+    table.add(7, fakeNode(4));
+
+    int32_t slot = table.first(7);
+    ASSERT_GE(slot, 0);
+    EXPECT_EQ(fakeNode(1), table.nodeAt(slot));
+    slot = table.next(7, slot);
+    ASSERT_GE(slot, 0);
+    EXPECT_EQ(fakeNode(3), table.nodeAt(slot));
+    slot = table.next(7, slot);
+    ASSERT_GE(slot, 0);
+    EXPECT_EQ(fakeNode(4), table.nodeAt(slot));
+    EXPECT_EQ(-1, table.next(7, slot));
+
+    EXPECT_EQ(fakeNode(4), table.nodeAt(table.last(7)));
+    EXPECT_EQ(fakeNode(2), table.nodeAt(table.first(3)));
+    EXPECT_EQ(-1, table.first(5));
+    EXPECT_EQ(4u, table.size());
+}
+
+TEST_F(NodeSignatureTableTest, RemovedNodesAreSkipped)
+{
+    TR::NodeSignatureTable table(_region);
+
+    for (uintptr_t i = 1; i <= 3; i++)
+        table.add(0, fakeNode(i));
+
+    table.removeAt(table.next(0, table.first(0)));
+
+    int32_t slot = table.first(0);
+    EXPECT_EQ(fakeNode(1), table.nodeAt(slot));
+    slot = table.next(0, slot);
+    EXPECT_EQ(fakeNode(3), table.nodeAt(slot));
+    EXPECT_EQ(-1, table.next(0, slot));
+
+    EXPECT_EQ(fakeNode(3), table.removeAll(0));
+    EXPECT_EQ(-1, table.first(0));
+    EXPECT_TRUE(table.removeAll(0) == NULL);
+    EXPECT_EQ(0u, table.size());
+}
+
+TEST_F(NodeSignatureTableTest, GrowingKeepsInsertionOrder)
+{
+    TR::NodeSignatureTable table(_region, 4);
+    uint32_t initialCapacity = table.capacity();
+
+    // Interleave a few signatures so that clusters overlap before the table
+    // grows, and leave some tombstones behind
+    const uint32_t signatures[] = { 0, 1, 2, 1000, 0x80000000 };
+    const uint32_t numSignatures = sizeof(signatures) / sizeof(signatures[0]);
+    const uint32_t perSignature = 40;
+    uint32_t expected[numSignatures] = {};
+    for (uint32_t i = 0; i < perSignature; i++) {
+        for (uint32_t s = 0; s < numSignatures; s++) {
+            table.add(signatures[s], fakeNode(i * numSignatures + s + 1));
+            expected[s]++;
+        }
+        if (i % 3 == 0) {
+            table.removeAt(table.last(signatures[i % numSignatures]));
+            expected[i % numSignatures]--;
+        }
+    }
+
+    EXPECT_GT(table.capacity(), initialCapacity);
+
+    for (uint32_t s = 0; s < numSignatures; s++) {
+        uintptr_t previous = 0;
+        uint32_t count = 0;
+        for (int32_t slot = table.first(signatures[s]); slot >= 0; slot = table.next(signatures[s], slot)) {
+            uintptr_t n = reinterpret_cast<uintptr_t>(table.nodeAt(slot)) / 16;
+            EXPECT_EQ(s, (n - 1) % numSignatures);
+            EXPECT_GT(n, previous);
+            previous = n;
+            count++;
+        }
+        EXPECT_EQ(expected[s], count);
+    }
+}
+
+TEST_F(NodeSignatureTableTest, ReservedSignaturesCanBeUsed)
+{
+    TR::NodeSignatureTable table(_region);
+
+    table.add(0xffffffff, fakeNode(1));
+    table.add(0xfffffffe, fakeNode(2));
+
+    EXPECT_EQ(fakeNode(1), table.nodeAt(table.first(0xffffffff)));
+    EXPECT_EQ(fakeNode(2), table.nodeAt(table.first(0xfffffffe)));
+    EXPECT_EQ(fakeNode(1), table.removeAll(0xffffffff));
+    EXPECT_EQ(-1, table.first(0xffffffff));
+    EXPECT_EQ(1u, table.size());
+}
+
+TEST_F(NodeSignatureTableTest, ClearEmptiesTheTable)
+{
+    TR::NodeSignatureTable table(_region);
+
+    for (uintptr_t i = 1; i <= 100; i++)
+        table.add(static_cast<uint32_t>(i % 10), fakeNode(i));
+    EXPECT_EQ(100u, table.size());
+
+    table.clear();
+    EXPECT_EQ(0u, table.size());
+    for (uint32_t s = 0; s < 10; s++)
+        EXPECT_EQ(-1, table.first(s));
+
+    table.add(4, fakeNode(1));
+    EXPECT_EQ(fakeNode(1), table.nodeAt(table.first(4)));
+}
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "env/PersistentAllocator.hpp"
+#include "env/PersistentAllocatorKit.hpp"
+#include "env/RawAllocator.hpp"
+
+class PersistentAllocatorTest : public ::testing::Test {
+public:
+    PersistentAllocatorTest()
+        : _rawAllocator()
+        , _allocator(TR::PersistentAllocatorKit(_rawAllocator))
+    {}
+
+protected:
+    TR::PersistentAllocator::Statistics statistics()
+    {
+        TR::PersistentAllocator::Statistics stats;
+        _allocator.getStatistics(stats);
+        return stats;
+    }
+
+    TR::RawAllocator _rawAllocator;
+    TR::PersistentAllocator _allocator;
+};
+
+TEST_F(PersistentAllocatorTest, SmallAllocationsAreAlignedAndReused)
+{
+    void *first = _allocator.allocate(40);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(first) % 16);
+    memset(first, 0xab, 40);
+
+    _allocator.deallocate(first);
+
+    // 33 to 64 bytes share a size class
+    void *reused = _allocator.allocate(64);
+    EXPECT_EQ(first, reused);
+    void *other = _allocator.allocate(65);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(other) % 16);
+
+    _allocator.deallocate(reused);
+    _allocator.deallocate(other);
+    _allocator.deallocate(NULL);
+}
+
+TEST_F(PersistentAllocatorTest, StatisticsAccountForEveryBlock)
+{
+    std::vector<void *> blocks;
+    for (size_t size = 1; size <= 2 * TR::PersistentAllocator::MAX_CACHED_SIZE; size += 7)
+        blocks.push_back(_allocator.allocate(size));
+
+    TR::PersistentAllocator::Statistics stats = statistics();
+    EXPECT_GT(stats.smallBytesInUse, stats.smallBytesRequested);
+    EXPECT_LE(stats.smallBytesInUse + stats.cachedBytes + stats.pooledBytes, stats.segmentBytes);
+    EXPECT_EQ(73u, stats.numLargeAllocations);
+    EXPECT_EQ(1u, stats.numThreadCaches);
+
+    for (size_t i = 0; i < blocks.size(); i++)
+        _allocator.deallocate(blocks[i]);
+
+    stats = statistics();
+    EXPECT_EQ(0u, stats.smallBytesInUse);
+    EXPECT_EQ(0u, stats.smallBytesRequested);
+    EXPECT_EQ(0u, stats.largeBytesInUse);
+    EXPECT_EQ(0u, stats.numLargeAllocations);
+    EXPECT_GT(stats.cachedBytes + stats.pooledBytes, 0u);
+}
+
+TEST_F(PersistentAllocatorTest, BlocksFreedByOneThreadAreReusedByAnother)
+{
+    static const size_t numBlocks = 1000;
+    std::vector<void *> blocks(numBlocks);
+
+    std::thread producer([&]() {
+        for (size_t i = 0; i < numBlocks; i++)
+            blocks[i] = _allocator.allocate(100);
+    });
+    producer.join();
+
+    size_t segmentBytes = statistics().segmentBytes;
+
+    std::thread consumer([&]() {
+        for (size_t i = 0; i < numBlocks; i++)
+            _allocator.deallocate(blocks[i]);
+        for (size_t i = 0; i < numBlocks; i++)
+            blocks[i] = _allocator.allocate(100);
+    });
+    consumer.join();
+
+    EXPECT_EQ(segmentBytes, statistics().segmentBytes);
+
+    for (size_t i = 0; i < numBlocks; i++)
+        _allocator.deallocate(blocks[i]);
+}
+
+TEST_F(PersistentAllocatorTest, ConcurrentAllocationsDoNotOverlap)
+{
+    static const int numThreads = 4;
+    static const int numIterations = 20000;
+    bool failed[numThreads] = {};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < numThreads; t++) {
+        threads.push_back(std::thread([&, t]() {
+            void *live[64] = {};
+            for (int i = 0; i < numIterations; i++) {
+                int slot = (i * 7 + t) % 64;
+                if (live[slot]) {
+                    uint8_t *bytes = static_cast<uint8_t *>(live[slot]);
+                    if (bytes[0] != t || bytes[15] != t)
+                        failed[t] = true;
+                    _allocator.deallocate(live[slot]);
+                }
+                size_t size = 16 + (i % 600);
+                live[slot] = _allocator.allocate(size);
+                memset(live[slot], t, size);
+            }
+            for (int slot = 0; slot < 64; slot++)
+                _allocator.deallocate(live[slot]);
+        }));
+    }
+
+    for (int t = 0; t < numThreads; t++)
+        threads[t].join();
+
+    for (int t = 0; t < numThreads; t++)
+        EXPECT_FALSE(failed[t]) << "thread " << t;
+
+    TR::PersistentAllocator::Statistics stats = statistics();
+    EXPECT_EQ(0u, stats.smallBytesInUse);
+    EXPECT_EQ(0u, stats.numLargeAllocations);
+    EXPECT_EQ(4u, stats.numThreadCaches);
+    EXPECT_GT(stats.lockAcquisitions, 0u);
+}
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "env/RawAllocator.hpp"
+#include "env/Region.hpp"
+#include "env/SystemSegmentProvider.hpp"
+#include "infra/TRlist.hpp"
+#include "infra/vector.hpp"
+
+class RegionTest : public ::testing::Test {
+public:
+    RegionTest()
+        : _rawAllocator()
+        , _segmentProvider(1 << 16, _rawAllocator)
+    {}
+
+protected:
+    TR::RawAllocator _rawAllocator;
+    TR::SystemSegmentProvider _segmentProvider;
+};
+
+TEST_F(RegionTest, DeallocateWithoutFreeListsKeepsMemory)
+{
+    TR::Region region(_segmentProvider, _rawAllocator);
+
+    void *first = region.allocate(24);
+    region.deallocate(first, 24);
+    void *second = region.allocate(24);
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(64u, region.bytesAllocated());
+    EXPECT_EQ(region.bytesAllocated(), region.bytesInUse());
+    EXPECT_EQ(region.bytesAllocated(), region.highWaterMark());
+}
+
+TEST_F(RegionTest, FreeListsReuseSizeClass)
+{
+    TR::Region region(_segmentProvider, _rawAllocator);
+    region.enableFreeLists();
+
+    void *first = region.allocate(24);
+    region.deallocate(first, 24);
+
+    EXPECT_EQ(0u, region.bytesInUse());
+    EXPECT_EQ(32u, region.highWaterMark());
+
+    // 17 to 32 bytes share a size class; 33 bytes does not
+    void *other = region.allocate(33);
+    EXPECT_NE(first, other);
+    void *reused = region.allocate(32);
+    EXPECT_EQ(first, reused);
+
+    EXPECT_EQ(96u, region.bytesAllocated());
+    EXPECT_EQ(96u, region.bytesInUse());
+}
+
+TEST_F(RegionTest, FreeListsIgnoreUnknownAndLargeSizes)
+{
+    TR::Region region(_segmentProvider, _rawAllocator);
+    region.enableFreeLists();
+
+    void *unsized = region.allocate(64);
+    region.deallocate(unsized);
+    EXPECT_NE(unsized, region.allocate(64));
+
+    void *large = region.allocate(2000);
+    region.deallocate(large, 2000);
+    EXPECT_NE(large, region.allocate(2000));
+    EXPECT_EQ(region.bytesAllocated(), region.bytesInUse());
+}
+
+TEST_F(RegionTest, FreeListsAreInheritedFromPrototype)
+{
+    TR::Region prototype(_segmentProvider, _rawAllocator);
+    prototype.enableFreeLists();
+    TR::Region region(prototype);
+
+    EXPECT_TRUE(region.freeListsEnabled());
+
+    void *first = region.allocate(100);
+    region.deallocate(first, 100);
+    EXPECT_EQ(first, region.allocate(128));
+}
+
+TEST_F(RegionTest, TemporaryContainersReuseMemory)
+{
+    TR::Region region(_segmentProvider, _rawAllocator);
+    region.enableFreeLists();
+
+    size_t allocatedAfterFirstPass = 0;
+    for (int pass = 0; pass < 10; pass++) {
+        {
+            TR::vector<int32_t, TR::Region &> values(region);
+            TR::list<int32_t, TR::Region &> nodes(region);
+            for (int32_t i = 0; i < 200; i++) {
+                values.push_back(i);
+                nodes.push_back(i);
+            }
+        }
+
+        EXPECT_EQ(0u, region.bytesInUse());
+        if (pass == 0)
+            allocatedAfterFirstPass = region.bytesAllocated();
+    }
+
+    EXPECT_EQ(allocatedAfterFirstPass, region.bytesAllocated());
+    EXPECT_LE(region.highWaterMark(), allocatedAfterFirstPass);
+}
@@ -26,6 +26,8 @@
 #include "optimizer/abstractinterpreter/AbsValue.hpp"
 #include "optimizer/abstractinterpreter/AbsOpArray.hpp"
 #include "optimizer/abstractinterpreter/AbsOpStack.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummary.hpp"
+#include "optimizer/abstractinterpreter/InliningSummaryCache.hpp"
 
 
 class AbsVPValueTest : public TRTest::AbsInterpreterTest {};
@@ -428,3 +430,105 @@ TEST_F(AbsOpArrayTest, testMergeOperation) {
     ASSERT_EQ(INT_MAX, v3->getHigh());
     ASSERT_TRUE(v3->isTop());
 }
+
+class InliningSummaryCacheTest : public TRTest::AbsInterpreterTest {
+public:
+    InliningSummaryCacheTest() : AbsInterpreterTest(), _cache(TR::InliningSummaryCache::create(2)) {}
+    ~InliningSummaryCacheTest() { TR::InliningSummaryCache::destroy(_cache); }
+
+    TR::InliningSummaryCache* cache() { return _cache; }
+
+    // The cache only compares method identifiers, so any distinct addresses will do
+    TR_OpaqueMethodBlock* method(uintptr_t i) { return reinterpret_cast<TR_OpaqueMethodBlock*>(0x1000 + i * 0x40); }
+
+    TR::InliningMethodSummary* summary() {
+        TR::InliningMethodSummary* summary = new (region()) TR::InliningMethodSummary(region());
+        summary->addPotentialOptimizationByArgument(new (region()) TR::PotentialOptimizationVPPredicate(
+            TR::VPIntRange::create(vp(), 0, 10), 3, TR::PotentialOptimizationPredicate::Kind::BranchFolding, vp()), 0);
+        summary->addPotentialOptimizationByArgument(new (region()) TR::PotentialOptimizationVPPredicate(
+            TR::VPNonNullObject::create(vp()), 7, TR::PotentialOptimizationPredicate::Kind::NullCheckFolding, vp()), 2);
+        return summary;
+    }
+
+private:
+    TR::InliningSummaryCache* _cache;
+};
+
+class NonVPPredicate : public TR::PotentialOptimizationPredicate {
+public:
+    NonVPPredicate() : TR::PotentialOptimizationPredicate(0, TR::PotentialOptimizationPredicate::Kind::BranchFolding) {}
+    virtual void trace(TR::Compilation* comp) {}
+    virtual bool test(TR::AbsValue* value) { return true; }
+};
+
+TEST_F(InliningSummaryCacheTest, testStoreAndLookup) {
+    ASSERT_TRUE(cache()->store(method(1), 20, summary()));
+    ASSERT_EQ(1, cache()->size());
+
+    TR::InliningMethodSummary* cached = cache()->lookup(method(1), 20, region(), vp());
+    ASSERT_NE((TR::InliningMethodSummary*)NULL, cached);
+    ASSERT_EQ(1, cache()->hits());
+
+    ASSERT_EQ(3, cached->getNumArguments());
+    ASSERT_EQ(1, cached->getNumPredicates(0));
+    ASSERT_EQ(0, cached->getNumPredicates(1));
+    ASSERT_EQ(1, cached->getNumPredicates(2));
+    ASSERT_EQ(3, cached->getPredicate(0, 0)->getBytecodeIndex());
+    ASSERT_EQ(TR::PotentialOptimizationPredicate::Kind::BranchFolding, cached->getPredicate(0, 0)->getKind());
+    ASSERT_EQ(7, cached->getPredicate(2, 0)->getBytecodeIndex());
+    ASSERT_EQ(TR::PotentialOptimizationPredicate::Kind::NullCheckFolding, cached->getPredicate(2, 0)->getKind());
+
+    // The rebuilt predicates must accept and reject the same values as the originals
+    TR::AbsVPValue* inRange = new (region()) TR::AbsVPValue(vp(), TR::VPIntConst::create(vp(), 5), TR::Int32);
+    TR::AbsVPValue* outOfRange = new (region()) TR::AbsVPValue(vp(), TR::VPIntRange::create(vp(), 5, 20), TR::Int32);
+    TR::AbsVPValue* nonNull = new (region()) TR::AbsVPValue(vp(), TR::VPNonNullObject::create(vp()), TR::Address);
+    TR::AbsVPValue* null = new (region()) TR::AbsVPValue(vp(), TR::VPNullObject::create(vp()), TR::Address);
+    ASSERT_EQ(1, cached->testArgument(inRange, 0));
+    ASSERT_EQ(0, cached->testArgument(outOfRange, 0));
+    ASSERT_EQ(1, cached->testArgument(nonNull, 2));
+    ASSERT_EQ(0, cached->testArgument(null, 2));
+}
+
+TEST_F(InliningSummaryCacheTest, testLookupMiss) {
+    ASSERT_TRUE(cache()->store(method(1), 20, summary()));
+
+    // A different bytecode size means the method was redefined
+    ASSERT_EQ((TR::InliningMethodSummary*)NULL, cache()->lookup(method(1), 24, region(), vp()));
+    ASSERT_EQ((TR::InliningMethodSummary*)NULL, cache()->lookup(method(2), 20, region(), vp()));
+    ASSERT_EQ(0, cache()->hits());
+    ASSERT_EQ(2, cache()->misses());
+}
+
+TEST_F(InliningSummaryCacheTest, testEmptySummary) {
+    ASSERT_TRUE(cache()->store(method(1), 4, new (region()) TR::InliningMethodSummary(region())));
+
+    TR::InliningMethodSummary* cached = cache()->lookup(method(1), 4, region(), vp());
+    ASSERT_NE((TR::InliningMethodSummary*)NULL, cached);
+    ASSERT_EQ(0, cached->getNumArguments());
+}
+
+TEST_F(InliningSummaryCacheTest, testUncacheableSummary) {
+    TR::InliningMethodSummary* uncacheable = summary();
+    uncacheable->addPotentialOptimizationByArgument(new (region()) NonVPPredicate(), 1);
+
+    ASSERT_FALSE(cache()->store(method(1), 20, uncacheable));
+    ASSERT_EQ(0, cache()->size());
+    ASSERT_FALSE(cache()->store(method(1), 20, NULL));
+}
+
+TEST_F(InliningSummaryCacheTest, testCapacityAndInvalidation) {
+    ASSERT_TRUE(cache()->store(method(1), 20, summary()));
+    ASSERT_FALSE(cache()->store(method(1), 20, summary()));
+    ASSERT_TRUE(cache()->store(method(2), 20, summary()));
+    ASSERT_FALSE(cache()->store(method(3), 20, summary()));
+    ASSERT_EQ(2, cache()->size());
+
+    cache()->invalidate(method(1));
+    ASSERT_EQ(1, cache()->size());
+    ASSERT_EQ((TR::InliningMethodSummary*)NULL, cache()->lookup(method(1), 20, region(), vp()));
+    ASSERT_TRUE(cache()->store(method(3), 20, summary()));
+
+    cache()->purge();
+    ASSERT_EQ(0, cache()->size());
+    ASSERT_EQ((TR::InliningMethodSummary*)NULL, cache()->lookup(method(2), 20, region(), vp()));
+}
@@ -0,0 +1,251 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <stdlib.h>
+
+struct Point
+   {
+   int32_t x;
+   int32_t y;
+   };
+
+static std::vector<void *> allocations;
+
+static void *
+allocate(int64_t size)
+   {
+   #define ALLOCATE_LINE LINETOSTR(__LINE__)
+   void *memory = calloc(1, static_cast<size_t>(size));
+   allocations.push_back(memory);
+   return memory;
+   }
+
+static int64_t
+sumPoint(Point *p)
+   {
+   #define SUMPOINT_LINE LINETOSTR(__LINE__)
+   return p->x + p->y;
+   }
+
+typedef int64_t (LoopFunction)(int32_t);
+
+DEFINE_TYPES(PointTypeDictionary)
+   {
+   DEFINE_STRUCT(Point);
+   DEFINE_FIELD(Point, x, Int32);
+   DEFINE_FIELD(Point, y, Int32);
+   CLOSE_STRUCT(Point);
+   }
+
+#define DEFINE_ALLOCATE() \
+   DefineFunction("allocate", __FILE__, ALLOCATE_LINE, (void *)&allocate, PointerTo("Point"), 1, Int64); \
+   DefineAllocator("allocate")
+
+// total += p.x + p.y for a new p in every iteration
+DEFINE_BUILDER(LocalPointBuilder,
+               Int64,
+               PARAM("n", Int32))
+   {
+   DEFINE_ALLOCATE();
+
+   Store("total", ConstInt64(0));
+
+   OMR::JitBuilder::IlBuilder *body = NULL;
+   ForLoopUp((char *)"i", &body, ConstInt32(0), Load("n"), ConstInt32(1));
+   body->Store("p", body->Call("allocate", 1, body->ConstInt64(sizeof(Point))));
+   body->StoreIndirect("Point", "x", body->Load("p"), body->Load("i"));
+   body->StoreIndirect("Point", "y", body->Load("p"), body->Mul(body->Load("i"), body->ConstInt32(2)));
+   body->Store("total",
+   body->   Add(
+   body->      Load("total"),
+   body->      ConvertTo(Int64,
+   body->         Add(
+   body->            LoadIndirect("Point", "x", body->Load("p")),
+   body->            LoadIndirect("Point", "y", body->Load("p"))))));
+
+   Return(Load("total"));
+
+   return true;
+   }
+
+// Same as LocalPointBuilder, but every point is passed to a call
+DEFINE_BUILDER(EscapingPointBuilder,
+               Int64,
+               PARAM("n", Int32))
+   {
+   DEFINE_ALLOCATE();
+   DefineFunction("sumPoint", __FILE__, SUMPOINT_LINE, (void *)&sumPoint, Int64, 1, PointerTo("Point"));
+
+   Store("total", ConstInt64(0));
+
+   OMR::JitBuilder::IlBuilder *body = NULL;
+   ForLoopUp((char *)"i", &body, ConstInt32(0), Load("n"), ConstInt32(1));
+   body->Store("p", body->Call("allocate", 1, body->ConstInt64(sizeof(Point))));
+   body->StoreIndirect("Point", "x", body->Load("p"), body->Load("i"));
+   body->StoreIndirect("Point", "y", body->Load("p"), body->Mul(body->Load("i"), body->ConstInt32(2)));
+   body->Store("total",
+   body->   Add(
+   body->      Load("total"),
+   body->      Call("sumPoint", 1, body->Load("p"))));
+
+   Return(Load("total"));
+
+   return true;
+   }
+
+// total += prev.x, where prev is the point allocated by the previous
+// iteration, so two instances of the same allocation are live at once
+DEFINE_BUILDER(PreviousPointBuilder,
+               Int64,
+               PARAM("n", Int32))
+   {
+   DEFINE_ALLOCATE();
+
+   Store("total", ConstInt64(0));
+   Store("prev", Call("allocate", 1, ConstInt64(sizeof(Point))));
+
+   OMR::JitBuilder::IlBuilder *body = NULL;
+   ForLoopUp((char *)"i", &body, ConstInt32(0), Load("n"), ConstInt32(1));
+   body->Store("p", body->Call("allocate", 1, body->ConstInt64(sizeof(Point))));
+   body->StoreIndirect("Point", "x", body->Load("p"), body->Load("i"));
+   body->Store("total",
+   body->   Add(
+   body->      Load("total"),
+   body->      ConvertTo(Int64, body->LoadIndirect("Point", "x", body->Load("prev")))));
+   body->Store("prev", body->Load("p"));
+
+   Return(Load("total"));
+
+   return true;
+   }
+
+// Fills an array of 8 Int32 with squares and sums it, indexing with a variable
+DEFINE_BUILDER(IndexedArrayBuilder,
+               Int64,
+               PARAM("n", Int32))
+   {
+   DEFINE_ALLOCATE();
+
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   Store("a", Call("allocate", 1, ConstInt64(8 * sizeof(int32_t))));
+   Store("total", ConstInt64(0));
+
+   OMR::JitBuilder::IlBuilder *fill = NULL;
+   ForLoopUp((char *)"i", &fill, ConstInt32(0), Load("n"), ConstInt32(1));
+   fill->StoreAt(
+   fill->   IndexAt(pInt32, fill->Load("a"), fill->Load("i")),
+   fill->   Mul(fill->Load("i"), fill->Load("i")));
+
+   OMR::JitBuilder::IlBuilder *sum = NULL;
+   ForLoopUp((char *)"j", &sum, ConstInt32(0), ConstInt32(8), ConstInt32(1));
+   sum->Store("total",
+   sum->   Add(
+   sum->      Load("total"),
+   sum->      ConvertTo(Int64,
+   sum->         LoadAt(pInt32,
+   sum->            IndexAt(pInt32, sum->Load("a"), sum->Load("j"))))));
+
+   Return(Load("total"));
+
+   return true;
+   }
+
+// Like LocalPointBuilder, with a point created by CreateLocalStruct
+DEFINE_BUILDER(LocalStructBuilder,
+               Int64,
+               PARAM("n", Int32))
+   {
+   Store("s", CreateLocalStruct(LookupStruct("Point")));
+   StoreIndirect("Point", "y", Load("s"), ConstInt32(0));
+   Store("total", ConstInt64(0));
+
+   OMR::JitBuilder::IlBuilder *body = NULL;
+   ForLoopUp((char *)"i", &body, ConstInt32(0), Load("n"), ConstInt32(1));
+   body->StoreIndirect("Point", "x", body->Load("s"), body->Load("i"));
+   body->StoreIndirect("Point", "y", body->Load("s"),
+   body->   Add(
+   body->      LoadIndirect("Point", "y", body->Load("s")),
+   body->      LoadIndirect("Point", "x", body->Load("s"))));
+
+   Return(ConvertTo(Int64, LoadIndirect("Point", "y", Load("s"))));
+
+   return true;
+   }
+
+class EscapeAnalysisTest : public JitBuilderTest
+   {
+   protected:
+
+   virtual void TearDown()
+      {
+      for (size_t i = 0; i < allocations.size(); i++)
+         free(allocations[i]);
+      allocations.clear();
+      }
+   };
+
+TEST_F(EscapeAnalysisTest, ScalarReplaceHeapAllocation)
+   {
+   LoopFunction *localPoint;
+   ASSERT_COMPILE(PointTypeDictionary, LocalPointBuilder, localPoint);
+
+   ASSERT_EQ(3 * 45, localPoint(10));
+   ASSERT_EQ(0U, allocations.size()) << "Allocation that does not escape was not removed";
+   }
+
+TEST_F(EscapeAnalysisTest, EscapingHeapAllocation)
+   {
+   LoopFunction *escapingPoint;
+   ASSERT_COMPILE(PointTypeDictionary, EscapingPointBuilder, escapingPoint);
+
+   ASSERT_EQ(3 * 45, escapingPoint(10));
+   ASSERT_EQ(10U, allocations.size()) << "Allocation passed to a call was removed";
+   }
+
+TEST_F(EscapeAnalysisTest, OlderInstanceIsLive)
+   {
+   LoopFunction *previousPoint;
+   ASSERT_COMPILE(PointTypeDictionary, PreviousPointBuilder, previousPoint);
+
+   ASSERT_EQ(36, previousPoint(10));
+   ASSERT_EQ(11U, allocations.size()) << "Allocation was removed while two of its instances were live";
+   }
+
+TEST_F(EscapeAnalysisTest, StackAllocateIndexedArray)
+   {
+   LoopFunction *indexedArray;
+   ASSERT_COMPILE(PointTypeDictionary, IndexedArrayBuilder, indexedArray);
+
+   ASSERT_EQ(0 + 1 + 4 + 9 + 16, indexedArray(5));
+   ASSERT_EQ(0U, allocations.size()) << "Allocation accessed with a variable index was not moved to the stack";
+   ASSERT_EQ(140, indexedArray(8));
+   }
+
+TEST_F(EscapeAnalysisTest, ScalarReplaceLocalStruct)
+   {
+   LoopFunction *localStruct;
+   ASSERT_COMPILE(PointTypeDictionary, LocalStructBuilder, localStruct);
+
+   ASSERT_EQ(45, localStruct(10));
+   ASSERT_EQ(0, localStruct(0));
+   }
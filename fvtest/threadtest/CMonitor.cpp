@@ -160,6 +160,13 @@ CMonitor::isThreadBlocking(CThread& thread)
 {
 	bool found = false;
 	const omrthread_t jthread = thread.getThread();
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+	/* Futex monitors keep no blocking queue; a blocked thread only records the monitor */
+	THREAD_LOCK(jthread, 0);
+	found = (jthread->monitor == m_monitor) && (0 != (jthread->flags & J9THREAD_FLAG_BLOCKED));
+	THREAD_UNLOCK(jthread);
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 	J9ThreadMonitor *mon = (J9ThreadMonitor *) m_monitor;
 
 	MONITOR_LOCK(m_monitor, 0);
@@ -173,6 +180,7 @@ CMonitor::isThreadBlocking(CThread& thread)
 	}
 
 	MONITOR_UNLOCK(m_monitor);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	return found;
 }
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
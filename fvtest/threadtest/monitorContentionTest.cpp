@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Contended monitor micro-benchmarks. Each test checks that the monitor kept its
+ * state consistent and logs how long the run took, so blocking implementations
+ * (condition variables, futexes) can be compared on the same machine.
+ */
+
+#include <string.h>
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "thread_api.h"
+#include "threadTestHelp.h"
+#include "testHelper.hpp"
+
+#define CONTENTION_THREADS 4
+#define ENTERS_PER_THREAD 50000
+#define NOTIFY_ROUNDS 2000
+#define PARK_ROUNDS 20000
+
+extern ThreadTestEnvironment *omrTestEnv;
+
+typedef struct ContentionData {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t counter;
+	volatile uintptr_t generation;
+	volatile uintptr_t acknowledged;
+	volatile uintptr_t turn;
+	omrthread_t pinger;
+} ContentionData;
+
+static int J9THREAD_PROC enterExitHelper(void *entryArg);
+static int J9THREAD_PROC notifyAllHelper(void *entryArg);
+static int J9THREAD_PROC parkHelper(void *entryArg);
+
+static void
+logElapsed(const char *name, uint64_t start)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	uint64_t micros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	omrTestEnv->log("%s: %llu us\n", name, (unsigned long long)micros);
+}
+
+TEST(MonitorContentionTest, EnterExit)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_t threads[CONTENTION_THREADS];
+	ContentionData data;
+	uint64_t start = 0;
+	uintptr_t i = 0;
+
+	memset(&data, 0, sizeof(data));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, 0, "MonitorContentionTest::EnterExit"));
+
+	start = omrtime_hires_clock();
+	for (i = 0; i < CONTENTION_THREADS; i++) {
+		ASSERT_NO_FATAL_FAILURE(createJoinableThread(&threads[i], enterExitHelper, &data));
+	}
+	for (i = 0; i < CONTENTION_THREADS; i++) {
+		VERBOSE_JOIN(threads[i], J9THREAD_SUCCESS);
+	}
+	logElapsed("enter/exit", start);
+
+	EXPECT_EQ((uintptr_t)(CONTENTION_THREADS * ENTERS_PER_THREAD), data.counter);
+	omrthread_monitor_destroy(data.monitor);
+}
+
+TEST(MonitorContentionTest, NotifyAll)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_t threads[CONTENTION_THREADS];
+	ContentionData data;
+	uint64_t start = 0;
+	uintptr_t i = 0;
+
+	memset(&data, 0, sizeof(data));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, 0, "MonitorContentionTest::NotifyAll"));
+
+	start = omrtime_hires_clock();
+	for (i = 0; i < CONTENTION_THREADS; i++) {
+		ASSERT_NO_FATAL_FAILURE(createJoinableThread(&threads[i], notifyAllHelper, &data));
+	}
+
+	/* Each round wakes every helper and waits until all of them have seen it */
+	omrthread_monitor_enter(data.monitor);
+	for (i = 1; i <= NOTIFY_ROUNDS; i++) {
+		data.generation = i;
+		omrthread_monitor_notify_all(data.monitor);
+		while (data.acknowledged < (i * CONTENTION_THREADS)) {
+			omrthread_monitor_wait(data.monitor);
+		}
+	}
+	omrthread_monitor_exit(data.monitor);
+
+	for (i = 0; i < CONTENTION_THREADS; i++) {
+		VERBOSE_JOIN(threads[i], J9THREAD_SUCCESS);
+	}
+	logElapsed("notifyAll", start);
+
+	EXPECT_EQ((uintptr_t)(NOTIFY_ROUNDS * CONTENTION_THREADS), data.acknowledged);
+	omrthread_monitor_destroy(data.monitor);
+}
+
+TEST(MonitorContentionTest, ParkUnpark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_t ponger = NULL;
+	ContentionData data;
+	uint64_t start = 0;
+	uintptr_t i = 0;
+
+	memset(&data, 0, sizeof(data));
+	data.pinger = omrthread_self();
+
+	start = omrtime_hires_clock();
+	ASSERT_NO_FATAL_FAILURE(createJoinableThread(&ponger, parkHelper, &data));
+	for (i = 0; i < PARK_ROUNDS; i++) {
+		data.turn = 1;
+		omrthread_unpark(ponger);
+		while (0 != data.turn) {
+			omrthread_park(0, 0);
+		}
+	}
+	VERBOSE_JOIN(ponger, J9THREAD_SUCCESS);
+	logElapsed("park/unpark", start);
+
+	EXPECT_EQ((uintptr_t)PARK_ROUNDS, data.counter);
+}
+
+static int J9THREAD_PROC
+enterExitHelper(void *entryArg)
+{
+	ContentionData *data = (ContentionData *)entryArg;
+	uintptr_t i = 0;
+
+	for (i = 0; i < ENTERS_PER_THREAD; i++) {
+		omrthread_monitor_enter(data->monitor);
+		data->counter += 1;
+		omrthread_monitor_exit(data->monitor);
+	}
+	return 0;
+}
+
+static int J9THREAD_PROC
+notifyAllHelper(void *entryArg)
+{
+	ContentionData *data = (ContentionData *)entryArg;
+	uintptr_t seen = 0;
+
+	omrthread_monitor_enter(data->monitor);
+	while (seen < NOTIFY_ROUNDS) {
+		while (data->generation == seen) {
+			omrthread_monitor_wait(data->monitor);
+		}
+		seen = data->generation;
+		data->acknowledged += 1;
+		omrthread_monitor_notify_all(data->monitor);
+	}
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+static int J9THREAD_PROC
+parkHelper(void *entryArg)
+{
+	ContentionData *data = (ContentionData *)entryArg;
+	uintptr_t i = 0;
+
+	for (i = 0; i < PARK_ROUNDS; i++) {
+		while (1 != data->turn) {
+			omrthread_park(0, 0);
+		}
+		data->counter += 1;
+		data->turn = 0;
+		omrthread_unpark(data->pinger);
+	}
+	return 0;
+}
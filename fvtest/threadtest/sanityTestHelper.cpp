@@ -242,9 +242,17 @@ TestBlockingQueue(CThread& self, const unsigned int numThreads)
 	}
 
 	/* Hold the monitor until threads have spun out */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	for (i = 0; i < numThreads; i++) {
+		while (!mon.isThreadBlocking(*pThreads[i])) {
+			self.Sleep(100);
+		}
+	}
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 	while (mon.numBlocking() < numThreads) {
 		self.Sleep(100);
 	}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 	for (i = 0; i < numThreads; i++) {
 		if (!mon.isThreadBlocking(*pThreads[i])) {
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Times the compilation of a method made of one long basic block, the case
+ * where local CSE and value numbering hold the most candidate expressions at
+ * once, and checks the value the compiled method computes.
+ *
+ * Usage: longblockbench [statements] [repetitions] [options]
+ *
+ * Each statement stores an expression over the arguments and an input array
+ * to a temp, and then stores a value derived from the temp to an output array.
+ * The expressions repeat, so most of the block's nodes are candidates for
+ * commoning. Tril gives every indirect load and store its own symbol
+ * reference, with no aliasing between them, so the method never reads memory
+ * that it writes. The options, if given, are appended to the default -Xjit
+ * options, e.g.
+ *
+ *    longblockbench 4000 10
+ *    longblockbench 4000 10 disableLocalCSE
+ */
+
+#include "default_compiler.hpp"
+#include "control/SimpleJit.hpp"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+typedef int32_t (LongBlockFunction) (int32_t, int32_t, int32_t *, int32_t *);
+
+static const int32_t NUM_TEMPS = 16;
+static const int32_t ARRAY_LENGTH = 8;
+
+static std::string generateMethod(int32_t statements) {
+    std::string method = "(method name=\"longblock\" return=\"Int32\""
+                         " args=[\"Int32\", \"Int32\", \"Address\", \"Address\"] (block";
+    char buffer[512];
+    for (int32_t i = 0; i < statements; ++i) {
+        // t[i % 16] = parm0 * (i % 4 + 1) + parm1 + parm2[i % 8];
+        // parm3[i % 8] = t[i % 16] - parm2[(i + 3) % 8];
+        snprintf(buffer, sizeof(buffer),
+                 " (istore temp=\"t%d\" (iadd (iadd (imul (iload parm=0) (iconst %d)) (iload parm=1))"
+                 " (iloadi offset=%d (aload parm=2))))"
+                 " (istorei offset=%d (aload parm=3) (isub (iload temp=\"t%d\") (iloadi offset=%d (aload parm=2))))",
+                 i % NUM_TEMPS, i % 4 + 1, 4 * (i % ARRAY_LENGTH),
+                 4 * (i % ARRAY_LENGTH), i % NUM_TEMPS, 4 * ((i + 3) % ARRAY_LENGTH));
+        method += buffer;
+    }
+    snprintf(buffer, sizeof(buffer),
+             " (ireturn (iadd (iload temp=\"t%d\") (iloadi offset=0 (aload parm=3))))))",
+             (statements - 1) % NUM_TEMPS);
+    method += buffer;
+    return method;
+}
+
+// The same computation in unsigned arithmetic, which wraps like the IL does
+static int32_t longBlockReference(int32_t statements, int32_t a, int32_t b, const int32_t *input, int32_t *output) {
+    uint32_t t[NUM_TEMPS] = {};
+    const uint32_t *in = reinterpret_cast<const uint32_t *>(input);
+    uint32_t *out = reinterpret_cast<uint32_t *>(output);
+    for (int32_t i = 0; i < statements; ++i) {
+        t[i % NUM_TEMPS] = static_cast<uint32_t>(a) * static_cast<uint32_t>(i % 4 + 1) + static_cast<uint32_t>(b)
+            + in[i % ARRAY_LENGTH];
+        out[i % ARRAY_LENGTH] = t[i % NUM_TEMPS] - in[(i + 3) % ARRAY_LENGTH];
+    }
+    return static_cast<int32_t>(t[(statements - 1) % NUM_TEMPS] + out[0]);
+}
+
+int main(int argc, char const * const * const argv) {
+    if (argc > 4) {
+        fprintf(stderr, "Usage: %s [statements] [repetitions] [options]\n", argv[0]);
+        return -1;
+    }
+
+    const int32_t statements = argc > 1 ? atoi(argv[1]) : 2000;
+    const int32_t repetitions = argc > 2 ? atoi(argv[2]) : 10;
+    if (statements < 1 || repetitions < 1) {
+        fprintf(stderr, "FAIL: statements and repetitions must be positive\n");
+        return -1;
+    }
+
+    std::string options = "-Xjit:acceptHugeMethods,useILValidator";
+    if (argc > 3) {
+        options += ",";
+        options += argv[3];
+    }
+
+    bool initialized = initializeSimpleJitWithOptions(const_cast<char *>(options.c_str()));
+    if (!initialized) {
+        fprintf(stderr, "FAIL: could not initialize JIT\n");
+        return -1;
+    }
+
+    std::string method = generateMethod(statements);
+    ASTNode* trees = parseString(method.c_str());
+    if (trees == NULL) {
+        fprintf(stderr, "FAIL: could not parse the generated method\n");
+        return -1;
+    }
+
+    double best = 0.0;
+    double total = 0.0;
+    for (int32_t i = 0; i < repetitions; ++i) {
+        Tril::DefaultCompiler compiler(trees);
+
+        auto start = std::chrono::steady_clock::now();
+        int32_t rc = compiler.compile();
+        auto end = std::chrono::steady_clock::now();
+
+        if (rc != 0) {
+            fprintf(stderr, "FAIL: compilation error %d\n", rc);
+            return -2;
+        }
+
+        const int32_t input[ARRAY_LENGTH] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        int32_t output[ARRAY_LENGTH] = {};
+        int32_t expectedOutput[ARRAY_LENGTH] = {};
+        int32_t result = compiler.getEntryPoint<LongBlockFunction*>()(3, -7, const_cast<int32_t *>(input), output);
+        int32_t expected = longBlockReference(statements, 3, -7, input, expectedOutput);
+        if (result != expected || memcmp(output, expectedOutput, sizeof(output)) != 0) {
+            fprintf(stderr, "FAIL: compiled code returned %d, expected %d\n", result, expected);
+            return -3;
+        }
+
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        total += ms;
+        if (i == 0 || ms < best)
+            best = ms;
+    }
+
+    printf("options: %s\n", options.c_str());
+    printf("%d compilations of a block of %d statements: best %.3f ms, mean %.3f ms\n",
+           repetitions, statements, best, total / repetitions);
+
+    shutdownSimpleJit();
+    return 0;
+}
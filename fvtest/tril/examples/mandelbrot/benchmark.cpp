@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Times the code compiled from mandelbrot.tril and checks its output against
+ * a C++ version of the same computation.
+ *
+ * Usage: mandelbrotbench <file.tril> [repetitions] [options]
+ *
+ * The options, if given, are appended to the default -Xjit options, so the
+ * same binary can be used to compare code generator settings, e.g.
+ *
+ *    mandelbrotbench mandelbrot.tril 20 disableInstructionScheduling
+ *    mandelbrotbench mandelbrot.tril 20 instructionSchedulingOptLevel=warm
+ */
+
+#include "default_compiler.hpp"
+#include "control/SimpleJit.hpp"
+
+#include <assert.h>
+#include <chrono>
+#include <cstring>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+typedef void (MandelbrotFunction) (int32_t, int32_t, int32_t*);
+
+// Same operations, in the same order, as mandelbrot.tril
+static void mandelbrotReference(int32_t iterations, int32_t size, int32_t *table) {
+    for (int32_t py = 0; py < size; ++py) {
+        for (int32_t px = 0; px < size; ++px) {
+            double x0 = (double)px * (3.5 / (double)size) - 2.5;
+            double y0 = (double)py * (2.0 / (double)size) - 1.0;
+            double x = 0.0;
+            double y = 0.0;
+            int32_t iter = 0;
+            while ((x * x + y * y) < 4.0 && iter < iterations) {
+                double xtemp = x0 + (x * x - y * y);
+                y = y0 + 2.0 * (x * y);
+                x = xtemp;
+                iter += 1;
+            }
+            table[px + py * size] = iter;
+        }
+    }
+}
+
+int main(int argc, char const * const * const argv) {
+    if (argc < 2 || argc > 4) {
+        fprintf(stderr, "Usage: %s <file.tril> [repetitions] [options]\n", argv[0]);
+        return -1;
+    }
+
+    const int32_t repetitions = argc > 2 ? atoi(argv[2]) : 10;
+
+    std::string options = "-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator";
+    if (argc > 3) {
+        options += ",";
+        options += argv[3];
+    }
+
+    bool initialized = initializeSimpleJitWithOptions(const_cast<char *>(options.c_str()));
+    if (!initialized) {
+        fprintf(stderr, "FAIL: could not initialize JIT\n");
+        return -1;
+    }
+
+    FILE* inputFile = fopen(argv[1], "r");
+    assert(inputFile != NULL);
+    ASTNode* trees = parseFile(inputFile);
+    fclose(inputFile);
+
+    Tril::DefaultCompiler mandelbrotCompiler(trees);
+
+    int32_t rc = mandelbrotCompiler.compile();
+    if (rc != 0) {
+        fprintf(stderr, "FAIL: compilation error %d\n", rc);
+        return -2;
+    }
+
+    auto mandelbrot = mandelbrotCompiler.getEntryPoint<MandelbrotFunction*>();
+
+    const int32_t size = 200;
+    const int32_t iterations = 1000;
+    std::vector<int32_t> table(size * size);
+    std::vector<int32_t> expected(size * size);
+
+    mandelbrotReference(iterations, size, &expected[0]);
+
+    double best = 0.0;
+    double total = 0.0;
+    for (int32_t i = 0; i < repetitions; ++i) {
+        std::memset(&table[0], 0, table.size() * sizeof(int32_t));
+
+        auto start = std::chrono::steady_clock::now();
+        mandelbrot(iterations, size, &table[0]);
+        auto end = std::chrono::steady_clock::now();
+
+        if (table != expected) {
+            fprintf(stderr, "FAIL: compiled code computed a different table than the reference\n");
+            return -3;
+        }
+
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        total += ms;
+        if (i == 0 || ms < best)
+            best = ms;
+    }
+
+    printf("options: %s\n", options.c_str());
+    printf("%d repetitions of a %dx%d table with %d iterations: best %.3f ms, mean %.3f ms\n",
+           repetitions, size, size, iterations, best, repetitions > 0 ? total / repetitions : 0.0);
+
+    shutdownSimpleJit();
+    return 0;
+}
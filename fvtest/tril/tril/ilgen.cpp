@@ -161,18 +161,31 @@ bool Tril::TRLangBuilder::injectIL()
     // evaluate the arguments for each basic block
     const ASTNode *block = _trees;
     auto blockIndex = 0;
+    auto maxFrequency = -1;
 
-    // assign block names
+    // assign block names and frequencies
     while (block) {
         if (block->getArgByName("name") != NULL) {
             auto name = block->getArgByName("name")->getValue()->getString();
             state->setBlockPair(name, blockIndex);
             TraceIL("Name of block %d set to \"%s\"\n", blockIndex, name);
         }
+        if (block->getArgByName("frequency") != NULL) {
+            auto frequency = block->getArgByName("frequency")->getValue()->get<int32_t>();
+            _blocks[blockIndex]->setFrequency(frequency);
+            TraceIL("Frequency of block %d set to %d\n", blockIndex, frequency);
+            if (frequency > maxFrequency)
+                maxFrequency = frequency;
+        }
         ++blockIndex;
         block = block->next;
     }
 
+    // Given frequencies take the place of profiling data, so the optimizer
+    // must not replace them with frequencies estimated from the structure
+    if (maxFrequency >= 0)
+        cfg()->setMaxFrequency(maxFrequency);
+
     TraceIL("=== %s ===\n", "Generating IL");
     block = _trees;
     generateToBlock(0);
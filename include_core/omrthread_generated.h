@@ -180,11 +180,19 @@ typedef struct J9ThreadTracing {
 #define J9_ABSTRACT_THREAD_FIELDS_4
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+#define J9_ABSTRACT_THREAD_FIELDS_5 \
+	volatile uint32_t parkSequence;
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
+#define J9_ABSTRACT_THREAD_FIELDS_5
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #define J9_ABSTRACT_THREAD_FIELDS \
 	J9_ABSTRACT_THREAD_FIELDS_1 \
 	J9_ABSTRACT_THREAD_FIELDS_2 \
 	J9_ABSTRACT_THREAD_FIELDS_3 \
-	J9_ABSTRACT_THREAD_FIELDS_4
+	J9_ABSTRACT_THREAD_FIELDS_4 \
+	J9_ABSTRACT_THREAD_FIELDS_5
 
 typedef struct J9ThreadMonitorTracing {
 	char *monitor_name;
@@ -259,6 +267,13 @@ typedef struct J9ThreadMonitorTracing {
 #define J9_ABSTRACT_MONITOR_FIELDS_8
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+#define J9_ABSTRACT_MONITOR_FIELDS_9 \
+	volatile uint32_t waitSequence;
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
+#define J9_ABSTRACT_MONITOR_FIELDS_9
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #define J9_ABSTRACT_MONITOR_FIELDS \
 	J9_ABSTRACT_MONITOR_FIELDS_1 \
 	J9_ABSTRACT_MONITOR_FIELDS_2 \
@@ -267,7 +282,8 @@ typedef struct J9ThreadMonitorTracing {
 	J9_ABSTRACT_MONITOR_FIELDS_5 \
 	J9_ABSTRACT_MONITOR_FIELDS_6 \
 	J9_ABSTRACT_MONITOR_FIELDS_7 \
-	J9_ABSTRACT_MONITOR_FIELDS_8
+	J9_ABSTRACT_MONITOR_FIELDS_8 \
+	J9_ABSTRACT_MONITOR_FIELDS_9
 
 /*
  * @ddr_namespace: map_to_type=J9ThreadAbstractMonitor
@@ -43,6 +43,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/x/codegen/X86BinaryEncoding.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/X86Debug.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/X86FPConversionSnippet.cpp \
+    $(JIT_OMR_DIRTY_DIR)/x/codegen/X86InstructionScheduler.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/OMRInstruction.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/OMRInstructionDelegate.cpp \
     $(JIT_OMR_DIRTY_DIR)/x/codegen/OMRX86Instruction.cpp \
@@ -45,6 +45,11 @@ JIT_PRODUCT_BUILDNAME_SRC=$(FIXED_OBJBASE)/$(JIT_OMR_DIRTY_DIR)/env/TRBuildName.
 JIT_PRODUCT_BUILDNAME_OBJ=$(FIXED_OBJBASE)/$(JIT_OMR_DIRTY_DIR)/env/TRBuildName.o
 JIT_PRODUCT_BACKEND_OBJECTS+=$(JIT_PRODUCT_BUILDNAME_OBJ)
 
+# Add the simplifier's generated rewrite rules
+JIT_PRODUCT_SIMPLIFIER_RULES_SRC=$(FIXED_OBJBASE)/$(JIT_OMR_DIRTY_DIR)/optimizer/OMRSimplifierRules.cpp
+JIT_PRODUCT_SIMPLIFIER_RULES_OBJ=$(FIXED_OBJBASE)/$(JIT_OMR_DIRTY_DIR)/optimizer/OMRSimplifierRules.o
+JIT_PRODUCT_BACKEND_OBJECTS+=$(JIT_PRODUCT_SIMPLIFIER_RULES_OBJ)
+
 $(CPP_JIT_PRODUCT_BACKEND_LIBRARY): $(CPP_API_OBJECTS)
 jit: $(CPP_JIT_PRODUCT_BACKEND_LIBRARY)
 
@@ -67,6 +72,15 @@ $(JIT_PRODUCT_BUILDNAME_SRC):
 jit_clean::
 	rm -f $(JIT_PRODUCT_BUILDNAME_SRC)
 
+$(call RULE.cpp,$(JIT_PRODUCT_SIMPLIFIER_RULES_OBJ),$(JIT_PRODUCT_SIMPLIFIER_RULES_SRC))
+
+$(JIT_PRODUCT_SIMPLIFIER_RULES_SRC): $(SIMPLIFIER_RULES_FILE) $(GENERATE_SIMPLIFIER_RULES_SCRIPT)
+	@mkdir -p $(dir $@)
+	$(PERL_PATH) $(GENERATE_SIMPLIFIER_RULES_SCRIPT) $(SIMPLIFIER_RULES_FILE) $@
+
+jit_clean::
+	rm -f $(JIT_PRODUCT_SIMPLIFIER_RULES_SRC)
+
 $(call RULE.cpp,$(GTEST_OBJ),$(GTEST_CC))
 
 #
@@ -71,6 +71,10 @@ endif
 # This is the script that's used to generate TRBuildName.cpp
 GENERATE_VERSION_SCRIPT?=$(JIT_SCRIPT_DIR)/generateVersion.pl
 
+# This is the script that's used to generate the simplifier's rewrite rules
+GENERATE_SIMPLIFIER_RULES_SCRIPT?=$(JIT_SCRIPT_DIR)/generateSimplifierRules.pl
+SIMPLIFIER_RULES_FILE?=$(JIT_SRCBASE)/$(JIT_OMR_DIRTY_DIR)/optimizer/OMRSimplifierRules.rules
+
 # This is the script to preprocess ARM assembly files
 ARMASM_SCRIPT?=$(JIT_SCRIPT_DIR)/armasm2gas.sed
 
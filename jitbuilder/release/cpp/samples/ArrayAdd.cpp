@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Adds two int32 arrays element by element. Nothing tells the JIT whether the
+ * three arrays overlap, so at hot the loop is versioned on a runtime overlap
+ * test: the fast version has the array accesses refined to independent alias
+ * sets, and the original loop runs whenever the arrays do overlap.
+ *
+ * The method is called on disjoint arrays and on arrays that overlap with a
+ * loop carried dependence, and each result is checked against a C loop.
+ *
+ * Usage: arrayadd [options]
+ *
+ * The options replace the default -Xjit options.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "ArrayAdd.hpp"
+
+#define NUM_VALUES 1000
+
+static const char *defaultOptions = "-Xjit:optLevel=hot";
+
+ArrayAddMethod::ArrayAddMethod(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("array_add");
+
+   pInt32 = types->PointerTo(Int32);
+
+   DefineParameter("result", pInt32);
+   DefineParameter("values1", pInt32);
+   DefineParameter("values2", pInt32);
+   DefineParameter("length", Int32);
+   DefineReturnType(NoType);
+   }
+
+bool
+ArrayAddMethod::buildIL()
+   {
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+             ConstInt32(0),
+             Load("length"),
+             ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pInt32,
+   loop->      Load("result"),
+   loop->      Load("i")),
+   loop->   Add(
+   loop->      LoadAt(pInt32,
+   loop->         IndexAt(pInt32,
+   loop->            Load("values1"),
+   loop->            Load("i"))),
+   loop->      LoadAt(pInt32,
+   loop->         IndexAt(pInt32,
+   loop->            Load("values2"),
+   loop->            Load("i")))));
+
+   Return();
+
+   return true;
+   }
+
+static void
+referenceAdd(int32_t *result, int32_t *values1, int32_t *values2, int32_t length)
+   {
+   for (int32_t i=0;i < length;i++)
+      result[i] = values1[i] + values2[i];
+   }
+
+static void
+initValues(int32_t *buffer, int32_t length)
+   {
+   for (int32_t v=0;v < length;v++)
+      buffer[v] = v * 7 - 300;
+   }
+
+// Runs array_add and the C loop on identically laid out copies of one buffer
+static bool
+check(const char *name, ArrayAddFunctionType *array_add, int32_t resultOffset, int32_t values1Offset, int32_t values2Offset, int32_t length)
+   {
+   static int32_t actual[3 * NUM_VALUES];
+   static int32_t expected[3 * NUM_VALUES];
+   initValues(actual, 3 * NUM_VALUES);
+   initValues(expected, 3 * NUM_VALUES);
+
+   array_add(actual + resultOffset, actual + values1Offset, actual + values2Offset, length);
+   referenceAdd(expected + resultOffset, expected + values1Offset, expected + values2Offset, length);
+
+   if (memcmp(actual, expected, sizeof(actual)) != 0)
+      {
+      fprintf(stderr, "FAIL: %s arrays computed the wrong result\n", name);
+      return false;
+      }
+   printf("   %s arrays: ok\n", name);
+   return true;
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   char *options = (char *)((argc > 1) ? argv[1] : defaultOptions);
+
+   printf("Step 1: initialize JIT with %s\n", options);
+   bool initialized = initializeJitWithOptions(options);
+   if (!initialized)
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT\n");
+      exit(-1);
+      }
+
+   printf("Step 2: define type dictionary\n");
+   OMR::JitBuilder::TypeDictionary types;
+
+   printf("Step 3: compile method builder\n");
+   ArrayAddMethod method(&types);
+   void *entry=0;
+   int32_t rc = compileMethodBuilder(&method, &entry);
+   if (rc != 0)
+      {
+      fprintf(stderr,"FAIL: compilation error %d\n", rc);
+      exit(-2);
+      }
+
+   printf("Step 4: invoke compiled code and verify results\n");
+   ArrayAddFunctionType *array_add = (ArrayAddFunctionType *)entry;
+   bool passed = true;
+   passed = check("disjoint", array_add, 0, NUM_VALUES, 2 * NUM_VALUES, NUM_VALUES) && passed;
+   passed = check("in place", array_add, 0, 0, NUM_VALUES, NUM_VALUES) && passed;
+   passed = check("forward overlapping", array_add, 1, 0, NUM_VALUES + 500, NUM_VALUES) && passed;
+   passed = check("backward overlapping", array_add, 0, 1, 2 * NUM_VALUES, NUM_VALUES) && passed;
+   passed = check("adjacent", array_add, NUM_VALUES, 0, 2 * NUM_VALUES, NUM_VALUES) && passed;
+   passed = check("empty", array_add, 1, 0, NUM_VALUES, 0) && passed;
+   passed = check("single element", array_add, 1, 0, NUM_VALUES, 1) && passed;
+   if (!passed)
+      exit(-3);
+
+   printf ("Step 5: shutdown JIT\n");
+   shutdownJit();
+
+   printf("PASS\n");
+   }
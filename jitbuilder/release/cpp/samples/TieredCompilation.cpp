@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Demonstrates tiered compilation, and doubles as its throughput benchmark.
+ *
+ * The method is compiled once, and the entry point returned by that first
+ * compilation is called for the whole run. With enableTieredCompilation the
+ * first body is compiled at cold with counters; the JIT recompiles the method
+ * at warm and then at hot in the background and forwards calls through the
+ * old entry point to the new bodies, so the calls get faster from one round
+ * to the next. The vlog lines on stderr show each body as it is compiled.
+ *
+ * Usage: tieredcompilation [rounds [options]]
+ *
+ * The options replace the default -Xjit options. Running with
+ *    tieredcompilation 20 -Xjit:omitFramePointer
+ * compiles the method once at warm, the level JitBuilder uses otherwise.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+
+#include "TieredCompilation.hpp"
+
+#define NUM_VALUES 1000
+#define CALLS_PER_ROUND 2000
+
+static const char *defaultOptions = "-Xjit:enableTieredCompilation,omitFramePointer,verbose={compileEnd}";
+
+TieredHashMethod::TieredHashMethod(OMR::JitBuilder::TypeDictionary *types)
+   : OMR::JitBuilder::MethodBuilder(types)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   DefineName("tiered_hash");
+
+   pInt32 = types->PointerTo(Int32);
+
+   DefineParameter("values", pInt32);
+   DefineParameter("length", Int32);
+   DefineReturnType(Int32);
+   }
+
+bool
+TieredHashMethod::buildIL()
+   {
+   Store("hash",
+      ConstInt32(17));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+             ConstInt32(0),
+             Load("length"),
+             ConstInt32(1));
+
+   loop->Store("hash",
+   loop->   Add(
+   loop->      Mul(
+   loop->         Load("hash"),
+   loop->         ConstInt32(31)),
+   loop->      LoadAt(pInt32,
+   loop->         IndexAt(pInt32,
+   loop->            Load("values"),
+   loop->            Load("i")))));
+
+   Return(
+      Load("hash"));
+
+   return true;
+   }
+
+static int32_t
+referenceHash(int32_t *values, int32_t length)
+   {
+   uint32_t hash = 17;
+   for (int32_t i=0;i < length;i++)
+      hash = hash * 31 + (uint32_t)values[i];
+   return (int32_t)hash;
+   }
+
+static double
+nowInMicros()
+   {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   int32_t rounds = (argc > 1) ? atoi(argv[1]) : 20;
+   char *options = (char *)((argc > 2) ? argv[2] : defaultOptions);
+
+   printf("Step 1: initialize JIT with %s\n", options);
+   bool initialized = initializeJitWithOptions(options);
+   if (!initialized)
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT\n");
+      exit(-1);
+      }
+
+   printf("Step 2: define type dictionary\n");
+   OMR::JitBuilder::TypeDictionary types;
+
+   printf("Step 3: compile method builder\n");
+   // The method builder must outlive every recompilation, so it lives until the JIT shuts down
+   TieredHashMethod method(&types);
+   void *entry=0;
+   double start = nowInMicros();
+   int32_t rc = compileMethodBuilder(&method, &entry);
+   if (rc != 0)
+      {
+      fprintf(stderr,"FAIL: compilation error %d\n", rc);
+      exit(-2);
+      }
+   printf("   first compilation took %.0f us\n", nowInMicros() - start);
+
+   printf("Step 4: invoke compiled code\n");
+   int32_t values[NUM_VALUES];
+   for (int32_t v=0;v < NUM_VALUES;v++)
+      values[v] = v * 7 - 300;
+   int32_t expected = referenceHash(values, NUM_VALUES);
+
+   TieredHashFunctionType *tiered_hash = (TieredHashFunctionType *)entry;
+   double total = 0;
+   for (int32_t r=0;r < rounds;r++)
+      {
+      start = nowInMicros();
+      for (int32_t c=0;c < CALLS_PER_ROUND;c++)
+         {
+         int32_t result = tiered_hash(values, NUM_VALUES);
+         if (result != expected)
+            {
+            fprintf(stderr, "FAIL: round %d returned %d, expected %d\n", r, result, expected);
+            exit(-3);
+            }
+         }
+      double elapsed = nowInMicros() - start;
+      total += elapsed;
+      printf("   round %2d: %8.1f ns per call\n", r, elapsed * 1000 / CALLS_PER_ROUND);
+      }
+   printf("   %d rounds: %.1f ms in total\n", rounds, total / 1000);
+
+   printf ("Step 5: shutdown JIT\n");
+   shutdownJit();
+
+   printf("PASS\n");
+   }
@@ -66,17 +66,27 @@ static intptr_t monitor_wait(omrthread_monitor_t monitor, int64_t millis, intptr
 static intptr_t monitor_notify_one_or_all(omrthread_monitor_t monitor, int notifyall);
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 static intptr_t monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable);
+#if !defined(OMR_THR_FUTEX_MONITORS)
 static intptr_t monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible, omrthread_monitor_wait_callback callbackFunction, void *userData);
 static intptr_t monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int notifyall);
+#endif /* !defined(OMR_THR_FUTEX_MONITORS) */
 #endif /* OMR_THR_THREE_TIER_LOCKING */
+#if defined(OMR_THR_FUTEX_MONITORS)
+static intptr_t monitor_enter_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, BOOLEAN spin);
+static void monitor_release_futex(omrthread_monitor_t monitor);
+static intptr_t monitor_wait_futex(omrthread_t self, omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible, omrthread_monitor_wait_callback callbackFunction, void *userData);
+static intptr_t monitor_notify_futex(omrthread_t self, omrthread_monitor_t monitor, int notifyall);
+static intptr_t threadParkWait(omrthread_t self, const struct timespec *deadline);
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 static intptr_t monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible, omrthread_monitor_wait_callback callbackFunction, void *userData);
 static intptr_t monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, int notifyall);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 static intptr_t init_spinCounts(omrthread_library_t lib);
-#if !defined(OMR_THR_MCS_LOCKS)
+#if !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS)
 static void unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor);
-#endif /* !defined(OMR_THR_MCS_LOCKS) */
+#endif /* !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS) */
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
 static intptr_t init_threadParam(const char *name, uintptr_t *pDefault);
@@ -84,7 +94,10 @@ static intptr_t init_spinParameters(omrthread_library_t lib);
 
 static void threadInterrupt(omrthread_t thread, uintptr_t interruptFlag);
 static void threadInterruptWake(omrthread_t thread, omrthread_monitor_t monitor);
+static void threadUnparkWake(omrthread_t thread);
+#if !defined(OMR_THR_FUTEX_MONITORS)
 static void threadNotify(omrthread_t threadToNotify);
+#endif /* !defined(OMR_THR_FUTEX_MONITORS) */
 static int32_t J9THREAD_PROC interruptServer(void *entryArg);
 static intptr_t interrupt_waiting_thread(omrthread_t self, omrthread_t threadToInterrupt);
 
@@ -92,10 +105,12 @@ static intptr_t interrupt_waiting_thread(omrthread_t self, omrthread_t threadToI
 static void interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt);
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
-static intptr_t check_notified(omrthread_t self, omrthread_monitor_t monitor);
 static uintptr_t monitor_maximum_wait_number(omrthread_monitor_t monitor);
+#if !defined(OMR_THR_FUTEX_MONITORS)
+static intptr_t check_notified(omrthread_t self, omrthread_monitor_t monitor);
 static uintptr_t monitor_on_notify_all_wait_list(omrthread_t self, omrthread_monitor_t monitor);
 static void monitor_notify_all_migration(omrthread_monitor_t monitor);
+#endif /* !defined(OMR_THR_FUTEX_MONITORS) */
 
 static intptr_t failedToSetAttr(intptr_t rc);
 #if defined(OSX)
@@ -176,6 +191,11 @@ omrthread_t global_lock_owner = UNOWNED;
 #define J9THR_WAIT_INTERRUPTED(flags) (((flags) & J9THREAD_FLAG_INTERRUPTED) != 0)
 #define J9THR_WAIT_PRI_INTERRUPTED(flags) (((flags) & (J9THREAD_FLAG_PRIORITY_INTERRUPTED | J9THREAD_FLAG_ABORTED)) != 0)
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/* How often an abortable thread blocked on a futex monitor re-checks for abort */
+#define FUTEX_ABORT_POLL_MILLIS 10
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #if defined(OMR_OS_WINDOWS) || !defined(OMR_NOTIFY_POLICY_CONTROL)
 #define NOTIFY_WRAPPER(thread) OMROSCOND_NOTIFY_ALL((thread)->condition);
 #else /* defined(OMR_OS_WINDOWS) || !defined(OMR_NOTIFY_POLICY_CONTROL) */
@@ -2889,9 +2909,12 @@ threadInterrupt(omrthread_t thread, uintptr_t interruptFlag)
 	thread->flags |= interruptFlag;
 
 	if (currFlags & testFlags) {
-		if (currFlags & (J9THREAD_FLAG_SLEEPING | J9THREAD_FLAG_PARKED)) {
+		if (currFlags & J9THREAD_FLAG_SLEEPING) {
 			NOTIFY_WRAPPER(thread);
 
+		} else if (currFlags & J9THREAD_FLAG_PARKED) {
+			threadUnparkWake(thread);
+
 		} else if (currFlags & J9THREAD_FLAG_WAITING) {
 			if (interrupt_waiting_thread(self, thread) == 1) {
 				threadMutexIsUnlocked = TRUE;
@@ -2932,6 +2955,13 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 
 	monitor = threadToInterrupt->monitor;
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	/* The thread sleeps on the lock word with the other blocked threads. Wake them all;
+	 * the rest simply go back to sleep, and an abortable enter polls in case it
+	 * checked its flags just before this.
+	 */
+	omrthread_futex_wake(omrthread_spinlock_futex_word(monitor), OMRTHREAD_FUTEX_WAKE_ALL, OMRTHREAD_FUTEX_ANY);
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 	if (MONITOR_TRY_LOCK(monitor) == 0) {
 		NOTIFY_WRAPPER(threadToInterrupt);
 	} else {
@@ -2952,6 +2982,7 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 		omrthread_monitor_unpin(monitor, self);
 	}
 	MONITOR_UNLOCK(monitor);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 }
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
@@ -3217,6 +3248,7 @@ threadEnqueue(omrthread_t *queue, omrthread_t thread)
 	ASSERT(NULL == thread->next);
 }
 
+#if !defined(OMR_THR_FUTEX_MONITORS)
 /**
  * Notify a thread.
  *
@@ -3237,6 +3269,7 @@ threadNotify(omrthread_t threadToNotify)
 	threadToNotify->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
 	NOTIFY_WRAPPER(threadToNotify);
 }
+#endif /* !defined(OMR_THR_FUTEX_MONITORS) */
 
 /**
  * Wake a thread that's being interrupted.
@@ -3253,7 +3286,32 @@ threadInterruptWake(omrthread_t thread, omrthread_monitor_t monitor)
 	ASSERT(0 != monitor);
 
 	thread->flags |= J9THREAD_FLAG_BLOCKED;
+#if defined(OMR_THR_FUTEX_MONITORS)
+	omrthread_futex_advance(&monitor->waitSequence);
+	omrthread_futex_wake(&monitor->waitSequence, OMRTHREAD_FUTEX_WAKE_ALL, OMRTHREAD_FUTEX_BIT(thread));
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
+	NOTIFY_WRAPPER(thread);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+}
+
+/**
+ * Wake a parked thread.
+ *
+ * @param[in] thread thread to wake
+ * @note: assumes the caller has THREAD_LOCK()'d the thread
+ */
+static void
+threadUnparkWake(omrthread_t thread)
+{
+	ASSERT(thread);
+	ASSERT(thread->flags & J9THREAD_FLAG_PARKED);
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+	omrthread_futex_advance(&thread->parkSequence);
+	omrthread_futex_wake(&thread->parkSequence, 1, OMRTHREAD_FUTEX_ANY);
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 	NOTIFY_WRAPPER(thread);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 }
 
 /**
@@ -3313,6 +3371,13 @@ omrthread_park(int64_t millis, intptr_t nanos)
 #endif /* defined(OMR_THR_YIELD_ALG) */
 			self->flags |= J9THREAD_FLAG_TIMER_SET;
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+			{
+				struct timespec deadline;
+				omrthread_futex_deadline(&deadline, boundedMillis, nanos);
+				rc = threadParkWait(self, &deadline);
+			}
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 			OMROSCOND_WAIT_IF_TIMEDOUT(self->condition, self->mutex, boundedMillis, nanos) {
 				rc = J9THREAD_TIMED_OUT;
 				break;
@@ -3325,7 +3390,11 @@ omrthread_park(int64_t millis, intptr_t nanos)
 				break;
 			}
 			OMROSCOND_WAIT_TIMED_LOOP();
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 		} else {
+#if defined(OMR_THR_FUTEX_MONITORS)
+			rc = threadParkWait(self, NULL);
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 			OMROSCOND_WAIT(self->condition, self->mutex);
 				rc = omrthread_park_check_flags(self);
 				if (J9THREAD_UNPARKED == rc) {
@@ -3334,6 +3403,7 @@ omrthread_park(int64_t millis, intptr_t nanos)
 				}
 				break;
 			OMROSCOND_WAIT_LOOP();
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 		}
 	}
 
@@ -3345,6 +3415,40 @@ omrthread_park(int64_t millis, intptr_t nanos)
 }
 
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Sleep on the current thread's park futex until it is woken or the deadline passes.
+ *
+ * @param[in] self the current thread, with THREAD_LOCK() held
+ * @param[in] deadline absolute CLOCK_MONOTONIC deadline, or NULL to wait indefinitely
+ *
+ * @return 0 if unparked or woken spuriously, otherwise as omrthread_park
+ * @note: THREAD_LOCK() is released while sleeping and held again on return
+ */
+static intptr_t
+threadParkWait(omrthread_t self, const struct timespec *deadline)
+{
+	/* Unpark and interrupt advance the sequence under THREAD_LOCK, so sampling it
+	 * here means a wake-up between THREAD_UNLOCK and the futex wait is not lost.
+	 */
+	uint32_t sequence = self->parkSequence;
+	intptr_t rc = 0;
+
+	THREAD_UNLOCK(self);
+	rc = omrthread_futex_wait(&self->parkSequence, sequence, deadline, OMRTHREAD_FUTEX_ANY);
+	THREAD_LOCK(self, CALLER_PARK);
+
+	if (J9THREAD_TIMED_OUT != rc) {
+		rc = omrthread_park_check_flags(self);
+		if (J9THREAD_UNPARKED == rc) {
+			self->flags &= ~J9THREAD_FLAG_UNPARKED;
+			rc = 0;
+		}
+	}
+	return rc;
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 /**
  * 'Unpark' the specified thread.
  *
@@ -3365,7 +3469,7 @@ omrthread_unpark(omrthread_t thread)
 	thread->flags |= J9THREAD_FLAG_UNPARKED;
 
 	if (thread->flags & J9THREAD_FLAG_PARKED) {
-		NOTIFY_WRAPPER(thread);
+		threadUnparkWake(thread);
 	}
 
 	THREAD_UNLOCK(thread);
@@ -3753,6 +3857,9 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	monitor->spinThreads = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	monitor->waitSequence = 0;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 	ASSERT(monitor->spinCount1 != 0);
 	ASSERT(monitor->spinCount2 != 0);
@@ -3971,7 +4078,7 @@ monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
 
 
 
-#if defined(OMR_THR_THREE_TIER_LOCKING)
+#if defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_FUTEX_MONITORS)
 /**
  * Enter a three-tier monitor.
  *
@@ -4119,10 +4226,131 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 
 	return 0;
 }
-#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_FUTEX_MONITORS) */
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Enter a three-tier monitor whose blocking tier is a futex.
+ *
+ * @param[in] self current thread
+ * @param[in] monitor monitor to enter
+ * @return 0 on success, J9THREAD_INTERRUPTED_MONITOR_ENTER otherwise
+ */
+static intptr_t
+monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable)
+{
+	return monitor_enter_futex(self, monitor, isAbortable, TRUE);
+}
+
+/**
+ * Enter a futex monitor.
+ *
+ * Spin on the spinlock as a three-tier monitor does. When that fails, sleep on
+ * the spinlock word itself. A blocked thread only ever takes the lock by swapping
+ * in SPINLOCK_EXCEEDED, so the word stays marked while anyone may be asleep on it
+ * and monitor_exit knows to wake one of them.
+ *
+ * @param[in] self current thread
+ * @param[in] monitor monitor to enter
+ * @param[in] isAbortable SET_ABORTABLE if an abort should interrupt the enter
+ * @param[in] spin FALSE if the thread may already be queued on the lock word, as a
+ * waiter requeued by notifyAll is
+ * @return 0 on success, J9THREAD_INTERRUPTED_MONITOR_ENTER otherwise
+ */
+static intptr_t
+monitor_enter_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, BOOLEAN spin)
+{
+	int blockedCount = 0;
+	volatile uint32_t *lockWord = omrthread_spinlock_futex_word(monitor);
+
+	ASSERT(self);
+	ASSERT(monitor);
+	ASSERT(monitor->spinCount1 != 0);
+	ASSERT(monitor->spinCount2 != 0);
+	ASSERT(monitor->spinCount3 != 0);
+	ASSERT(monitor->owner != self);
+	ASSERT(FREE_TAG != monitor->count);
+
+	if (!spin || (0 != omrthread_spinlock_acquire(self, monitor))) {
+		THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
+		if (SET_ABORTABLE == isAbortable) {
+			self->flags |= J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+		} else {
+			self->flags |= J9THREAD_FLAG_BLOCKED;
+		}
+		self->monitor = monitor;
+		THREAD_UNLOCK(self);
+
+		while (J9THREAD_MONITOR_SPINLOCK_UNOWNED != omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+			struct timespec deadline;
+			const struct timespec *deadlinePtr = NULL;
+
+			if (SET_ABORTABLE == isAbortable) {
+				THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER4);
+				if (self->flags & J9THREAD_FLAG_ABORTED) {
+					self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+					self->monitor = 0;
+					THREAD_UNLOCK(self);
+					return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+				}
+				THREAD_UNLOCK(self);
+				/* An abort arriving between the check and the sleep is caught on the next poll */
+				omrthread_futex_deadline(&deadline, FUTEX_ABORT_POLL_MILLIS, 0);
+				deadlinePtr = &deadline;
+			}
+
+			blockedCount++;
+			omrthread_futex_wait(lockWord, J9THREAD_MONITOR_SPINLOCK_EXCEEDED, deadlinePtr, OMRTHREAD_FUTEX_ANY);
+		}
+	}
+
+	monitor->owner = self;
+	monitor->count = 1;
+	ASSERT(monitor->spinlockState != J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+
+	/* We now own the monitor */
+	self->lockedmonitorcount++;
+
+	if ((self->monitor != 0) || (SET_ABORTABLE == isAbortable)) {
+		THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER3);
+		self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+		self->monitor = 0;
+
+		if (SET_ABORTABLE == isAbortable) {
+			/* Check for abort that may have occurred after we got the monitor. */
+			if (self->flags & J9THREAD_FLAG_ABORTED) {
+				THREAD_UNLOCK(self);
+				monitor_exit(self, monitor);
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+		}
+		THREAD_UNLOCK(self);
+	}
+
+	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, (blockedCount > 0));
+
+	ASSERT(!(self->flags & J9THREAD_FLAG_BLOCKED));
+	ASSERT(0 == self->monitor);
+
+	return 0;
+}
+
+/**
+ * Release a futex monitor's spinlock, waking one blocked thread if any may be asleep on it.
+ *
+ * @param[in] monitor monitor being released
+ */
+static void
+monitor_release_futex(omrthread_monitor_t monitor)
+{
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		omrthread_futex_wake(omrthread_spinlock_futex_word(monitor), 1, OMRTHREAD_FUTEX_ANY);
+	}
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 
-#if defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS)
+#if defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS)
 /**
  * Notify all threads blocked on the monitor's mutex, waiting
  * to be told that it's ok to try again to get the spinlock.
@@ -4159,7 +4387,7 @@ unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor)
 	}
 }
 
-#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS) */
 
 
 
@@ -4365,7 +4593,9 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
 		UPDATE_JLM_MON_EXIT(self, monitor);
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
-#if defined(OMR_THR_MCS_LOCKS)
+#if defined(OMR_THR_FUTEX_MONITORS)
+		monitor_release_futex(monitor);
+#elif defined(OMR_THR_MCS_LOCKS)
 		MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
 		nextThread = omrthread_mcs_unlock(self, monitor);
 		if (NULL != nextThread) {
@@ -4590,7 +4820,9 @@ monitor_wait(omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintpt
 {
 	omrthread_t self = MACRO_SELF();
 
-#if defined(OMR_THR_THREE_TIER_LOCKING)
+#if defined(OMR_THR_FUTEX_MONITORS)
+	return monitor_wait_futex(self, monitor, millis, nanos, interruptible, callbackFunction, userData);
+#elif defined(OMR_THR_THREE_TIER_LOCKING)
 	if (self->library->flags & J9THREAD_LIB_FLAG_FAST_NOTIFY) {
 		return monitor_wait_three_tier(self, monitor, millis, nanos, interruptible, callbackFunction, userData);
 	} else {
@@ -4601,6 +4833,7 @@ monitor_wait(omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintpt
 #endif
 }
 
+#if !defined(OMR_THR_FUTEX_MONITORS)
 /*
  * VMDESIGN WIP 1320
  * This is the original implementation of monitor_wait().
@@ -4874,8 +5107,9 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 	ASSERT(0);
 	return 0;
 }
+#endif /* !defined(OMR_THR_FUTEX_MONITORS) */
 
-#if defined(OMR_THR_THREE_TIER_LOCKING)
+#if defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_FUTEX_MONITORS)
 static intptr_t
 monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 						int64_t millis, intptr_t nanos, uintptr_t interruptible,
@@ -5126,7 +5360,221 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 	ASSERT(0);
 	return 0;
 }
-#endif /* OMR_THR_THREE_TIER_LOCKING */
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_FUTEX_MONITORS) */
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Wait on a futex monitor.
+ *
+ * Waiters sleep on the monitor's waitSequence, each answering to the wake bit of
+ * its own thread. Notify and interrupt change a waiter's flags and then advance
+ * the sequence, so a waiter that samples the sequence before checking its flags
+ * cannot miss a wake-up.
+ */
+static intptr_t
+monitor_wait_futex(omrthread_t self, omrthread_monitor_t monitor,
+				   int64_t millis, intptr_t nanos, uintptr_t interruptible,
+				   omrthread_monitor_wait_callback callbackFunction, void *userData)
+{
+	intptr_t count = -1;
+	uintptr_t interrupted = 0;
+	uintptr_t notified = 0;
+	uintptr_t priorityinterrupted = 0;
+	uintptr_t intrMask = 0;
+	uintptr_t intrFlags = 0;
+	uintptr_t timedOut = 0;
+	BOOLEAN expired = FALSE;
+	uint32_t sequence = 0;
+	struct timespec deadline;
+	const struct timespec *deadlinePtr = NULL;
+
+	ASSERT(monitor);
+	ASSERT(FREE_TAG != monitor->count);
+
+	if (monitor->owner != self) {
+		ASSERT_DEBUG(0);
+		return J9THREAD_ILLEGAL_MONITOR_STATE;
+	}
+
+	if ((millis < 0) || (nanos < 0) || (nanos >= 1000000)) {
+		ASSERT_DEBUG(0);
+		return J9THREAD_INVALID_ARGUMENT;
+	}
+
+	count = monitor->count;
+
+	intrMask = 0;
+	if (interruptible & J9THREAD_FLAG_INTERRUPTABLE) {
+		intrMask |= J9THREAD_FLAG_INTERRUPTED | J9THREAD_FLAG_PRIORITY_INTERRUPTED;
+	}
+	if (interruptible & J9THREAD_FLAG_ABORTABLE) {
+		intrMask |= J9THREAD_FLAG_ABORTED;
+	}
+
+	THREAD_LOCK(self, CALLER_MONITOR_WAIT1);
+	ASSERT(0 == self->monitor);
+
+	/*
+	 * Before we wait, check if we've already been interrupted
+	 */
+	intrFlags = self->flags & intrMask;
+	if (intrFlags & J9THREAD_FLAG_INTERRUPTED) {
+		self->flags &= ~J9THREAD_FLAG_INTERRUPTED;
+		THREAD_UNLOCK(self);
+		return J9THREAD_INTERRUPTED;
+	}
+	if (intrFlags & J9THREAD_FLAG_PRIORITY_INTERRUPTED) {
+		self->flags &= ~J9THREAD_FLAG_PRIORITY_INTERRUPTED;
+		THREAD_UNLOCK(self);
+		return J9THREAD_PRIORITY_INTERRUPTED;
+	}
+	if (intrFlags & J9THREAD_FLAG_ABORTED) {
+		THREAD_UNLOCK(self);
+		return J9THREAD_PRIORITY_INTERRUPTED;
+	}
+
+	self->flags |= (J9THREAD_FLAG_WAITING | interruptible);
+	if (millis || nanos) {
+		self->flags |= J9THREAD_FLAG_TIMER_SET;
+		omrthread_futex_deadline(&deadline, BOUNDED_I64_TO_IDATA(millis), nanos);
+		deadlinePtr = &deadline;
+	}
+	self->monitor = monitor;
+
+	THREAD_UNLOCK(self);
+
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+	if (IS_JLM_TIME_STAMPS_ENABLED(self, monitor)) {
+		UPDATE_JLM_MON_EXIT_HOLD_TIMES(self, monitor);
+		/*
+		 * If this is a pause monitor, increment this thread's pause count
+		 * so that the hold times of currently held monitors won't be measured
+		 */
+		if (monitor->flags & J9THREAD_MONITOR_JLM_TIME_STAMP_INVALIDATOR) {
+			self->tracing->pause_count++;
+		}
+	}
+#endif
+
+	ASSERT(self->flags & J9THREAD_FLAG_WAITING);
+	monitor->owner = NULL;
+	monitor->count = 0;
+
+	MONITOR_LOCK(monitor, CALLER_MONITOR_WAIT);
+	monitor_release_futex(monitor);
+	self->lockedmonitorcount--;
+
+	/* Monitor is released. */
+	if (NULL != callbackFunction) {
+		callbackFunction(userData);
+	}
+
+	threadEnqueue(&monitor->waiting, self);
+
+	while (1) {
+		sequence = monitor->waitSequence;
+		THREAD_LOCK(self, CALLER_MONITOR_WAIT2);
+		intrFlags = self->flags & intrMask;
+		interrupted = J9THR_WAIT_INTERRUPTED(intrFlags);
+		priorityinterrupted = J9THR_WAIT_PRI_INTERRUPTED(intrFlags);
+		notified = self->flags & J9THREAD_FLAG_NOTIFIED;
+		if (interrupted || priorityinterrupted || notified) {
+			break;
+		}
+		if (expired) {
+			timedOut = 1;
+			self->flags |= J9THREAD_FLAG_BLOCKED;
+			break;
+		}
+		THREAD_UNLOCK(self);
+		MONITOR_UNLOCK(monitor);
+
+		if (J9THREAD_TIMED_OUT == omrthread_futex_wait(&monitor->waitSequence, sequence, deadlinePtr, OMRTHREAD_FUTEX_BIT(self))) {
+			expired = TRUE;
+		}
+
+		MONITOR_LOCK(monitor, CALLER_MONITOR_WAIT);
+	}
+
+	/* DONE WAITING AT THIS POINT */
+
+	/* the notifier has already removed a notified thread from the wait queue */
+	if (!notified) {
+		threadDequeue(&monitor->waiting, self);
+	}
+
+	MONITOR_UNLOCK(monitor);
+
+	/* at this point, this thread should already be locked */
+
+	ASSERT(notified || interrupted || priorityinterrupted || timedOut);
+	/* if we were interrupted, then we'd better have been interruptible */
+	ASSERT(!interrupted || (interruptible & J9THREAD_FLAG_INTERRUPTABLE));
+	ASSERT(!priorityinterrupted || (interruptible & (J9THREAD_FLAG_INTERRUPTABLE | J9THREAD_FLAG_ABORTABLE)));
+
+	self->flags &= ~(J9THREAD_FLAG_WAITING | J9THREAD_FLAG_TIMER_SET
+					 | J9THREAD_FLAG_INTERRUPTABLE
+					 | J9THREAD_FLAG_NOTIFIED);
+	if (interruptible & J9THREAD_FLAG_INTERRUPTABLE) {
+		self->flags &= ~J9THREAD_FLAG_PRIORITY_INTERRUPTED;
+	}
+	/*
+	 * The interrupt remains pending if the thread was priority-interrupted or notified.
+	 */
+	if (interrupted && !(notified || priorityinterrupted)) {
+		self->flags &= ~J9THREAD_FLAG_INTERRUPTED;
+	}
+
+	/*
+	 * Is there an interruptServer thread out there trying to interrupt us?
+	 * Its services are no longer required.
+	 */
+	if (self->interrupter) {
+		ASSERT(interrupted || priorityinterrupted);
+		THREAD_LOCK(self->interrupter, CALLER_MONITOR_WAIT2);
+		self->interrupter->flags |= J9THREAD_FLAG_CANCELED;
+		THREAD_UNLOCK(self->interrupter);
+		self->interrupter = NULL;
+	}
+
+	THREAD_UNLOCK(self);
+
+	/* A notifyAll may have requeued this thread onto the lock word, so it must
+	 * reacquire as a blocked thread rather than by spinning.
+	 */
+	if (monitor_enter_futex(
+			self, monitor,
+			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE),
+			FALSE)
+		== J9THREAD_INTERRUPTED_MONITOR_ENTER
+	) {
+		/* we don't own the monitor */
+		return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+	}
+	monitor->count = count;
+
+	ASSERT(monitor->owner == self);
+	ASSERT(monitor->count == count);
+	ASSERT(monitor->count >= 1);
+	ASSERT(0 == self->monitor);
+	ASSERT(NULL == self->next);
+
+	if (priorityinterrupted) {
+		return J9THREAD_PRIORITY_INTERRUPTED;
+	}
+	if (notified) {
+		return 0;
+	}
+	if (interrupted) {
+		return J9THREAD_INTERRUPTED;
+	}
+	if (timedOut) {
+		return J9THREAD_TIMED_OUT;
+	}
+	ASSERT(0);
+	return 0;
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 /**
  * Returns how many threads are currently waiting on a monitor.
@@ -5228,7 +5676,9 @@ monitor_notify_one_or_all(omrthread_monitor_t monitor, int notifyall)
 
 	Trc_THR_ThreadMonitorNotifyEnter(self, monitor, notifyall);
 
-#if defined(OMR_THR_THREE_TIER_LOCKING)
+#if defined(OMR_THR_FUTEX_MONITORS)
+	rc = monitor_notify_futex(self, monitor, notifyall);
+#elif defined(OMR_THR_THREE_TIER_LOCKING)
 	if (self->library->flags & J9THREAD_LIB_FLAG_FAST_NOTIFY) {
 		rc = monitor_notify_three_tier(self, monitor, notifyall);
 	} else {
@@ -5242,6 +5692,7 @@ monitor_notify_one_or_all(omrthread_monitor_t monitor, int notifyall)
 	return rc;
 }
 
+#if !defined(OMR_THR_FUTEX_MONITORS)
 /*
  * VMDESIGN WIP 1320
  * This is the original implementation of monitor_notify_one_or_all().
@@ -5370,6 +5821,67 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 	return 0;
 }
 #endif
+#endif /* !defined(OMR_THR_FUTEX_MONITORS) */
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+static intptr_t
+monitor_notify_futex(omrthread_t self, omrthread_monitor_t monitor, int notifyall)
+{
+	omrthread_t queue = NULL;
+
+	ASSERT(self);
+	ASSERT(monitor);
+
+	if (monitor->owner != self) {
+		ASSERT_DEBUG(0);
+		return J9THREAD_ILLEGAL_MONITOR_STATE;
+	}
+
+	MONITOR_LOCK(monitor, CALLER_NOTIFY_ONE_OR_ALL);
+	queue = monitor->waiting;
+	if (queue) {
+		if (notifyall) {
+			/* set all the thread flags and empty the waiting queue */
+			do {
+				omrthread_t next = queue->next;
+
+				THREAD_LOCK(queue, 0);
+				queue->flags &= ~J9THREAD_FLAG_WAITING;
+				queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
+				Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
+				THREAD_UNLOCK(queue);
+
+				queue->next = NULL;
+				queue->prev = NULL;
+				queue = next;
+			} while (queue);
+			monitor->waiting = NULL;
+
+			/*
+			 * Rather than waking every waiter only for all but one to block again,
+			 * move them onto the lock word. Marking the lock EXCEEDED makes each
+			 * monitor exit release the next of them.
+			 */
+			omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED);
+			omrthread_futex_advance(&monitor->waitSequence);
+			omrthread_futex_requeue(&monitor->waitSequence, omrthread_spinlock_futex_word(monitor));
+		} else {
+			THREAD_LOCK(queue, 0);
+			queue->flags &= ~J9THREAD_FLAG_WAITING;
+			queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
+			Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
+			THREAD_UNLOCK(queue);
+
+			threadDequeue(&monitor->waiting, queue);
+			omrthread_futex_advance(&monitor->waitSequence);
+			omrthread_futex_wake(&monitor->waitSequence, OMRTHREAD_FUTEX_WAKE_ALL, OMRTHREAD_FUTEX_BIT(queue));
+		}
+	}
+
+	MONITOR_UNLOCK(monitor);
+	return 0;
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 /**
  * Acquire the threading library's global lock.
@@ -5525,6 +6037,7 @@ free_mcs_nodes(omrthread_library_t lib, omrthread_mcs_nodes_t mcsNodes)
 }
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 
+#if !defined(OMR_THR_FUTEX_MONITORS)
 /**
  * Check if the current awakened thread was a target for a notify request.
  *
@@ -5548,6 +6061,7 @@ check_notified(omrthread_t self, omrthread_monitor_t monitor)
 
 	return rc;
 }
+#endif /* !defined(OMR_THR_FUTEX_MONITORS) */
 
 /**
  * Determine the maximum waitNumber of threads waiting on a monitor.
@@ -5572,6 +6086,7 @@ monitor_maximum_wait_number(omrthread_monitor_t monitor)
 	return hwn;
 }
 
+#if !defined(OMR_THR_FUTEX_MONITORS)
 /**
  * Determine if a given thread is on the notifyAll wait list.
  * This is done by looking at the wait number in the thread and
@@ -5627,6 +6142,7 @@ monitor_notify_all_migration(omrthread_monitor_t monitor)
 	}
 	monitor->waiting = NULL;
 }
+#endif /* !defined(OMR_THR_FUTEX_MONITORS) */
 
 /**
  * Test to see whether the current thread is the owner of a monitor
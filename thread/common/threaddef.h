@@ -117,6 +117,33 @@ void
 omrthread_mcs_node_free(omrthread_t self, omrthread_mcs_node_t mcsNode);
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/* Wake mask matching every futex waiter */
+#define OMRTHREAD_FUTEX_ANY ((uint32_t)0xFFFFFFFF)
+/* Wake count releasing every matching futex waiter */
+#define OMRTHREAD_FUTEX_WAKE_ALL ((int32_t)0x7FFFFFFF)
+/* Wake mask selecting one thread's waits on a shared futex word */
+#define OMRTHREAD_FUTEX_BIT(thread) ((uint32_t)1 << ((thread)->tid & 31))
+
+volatile uint32_t *
+omrthread_spinlock_futex_word(omrthread_monitor_t monitor);
+
+void
+omrthread_futex_deadline(struct timespec *deadline, int64_t millis, intptr_t nanos);
+
+intptr_t
+omrthread_futex_wait(volatile uint32_t *address, uint32_t expected, const struct timespec *deadline, uint32_t bitset);
+
+void
+omrthread_futex_wake(volatile uint32_t *address, int32_t count, uint32_t bitset);
+
+void
+omrthread_futex_requeue(volatile uint32_t *address, volatile uint32_t *target);
+
+uint32_t
+omrthread_futex_advance(volatile uint32_t *address);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 /*
  * constants for profiling
  */
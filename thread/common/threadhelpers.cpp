@@ -22,6 +22,15 @@
 
 #include "AtomicSupport.hpp"
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 extern "C" {
 
 #include "thrtypes.h"
@@ -489,6 +498,114 @@ omrthread_mcs_node_free(omrthread_t self, omrthread_mcs_node_t mcsNode)
 }
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Return the 32-bit half of a monitor's spinlockState that holds the lock state.
+ * Blocked threads sleep on this word; it only ever holds 0, 1 or 2.
+ *
+ * @param[in] monitor the monitor
+ *
+ * @return address of the low-order half of spinlockState
+ */
+volatile uint32_t *
+omrthread_spinlock_futex_word(omrthread_monitor_t monitor)
+{
+	volatile uint32_t *word = (volatile uint32_t *)&monitor->spinlockState;
+#if defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN)
+	word += 1;
+#endif /* defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN) */
+	return word;
+}
+
+/**
+ * Compute an absolute CLOCK_MONOTONIC deadline for a futex wait.
+ *
+ * @param[out] deadline the deadline
+ * @param[in] millis milliseconds from now
+ * @param[in] nanos additional nanoseconds from now (less than one millisecond)
+ */
+void
+omrthread_futex_deadline(struct timespec *deadline, int64_t millis, intptr_t nanos)
+{
+	clock_gettime(CLOCK_MONOTONIC, deadline);
+	int64_t nsec = (int64_t)deadline->tv_nsec + ((millis % 1000) * 1000000) + nanos;
+	deadline->tv_sec += (time_t)(millis / 1000) + (time_t)(nsec / 1000000000);
+	deadline->tv_nsec = (long)(nsec % 1000000000);
+}
+
+/**
+ * Sleep while a futex word holds an expected value.
+ *
+ * Returns early on wake-ups, signals and when the word has already changed;
+ * callers re-check their condition in a loop.
+ *
+ * @param[in] address the futex word
+ * @param[in] expected the value that must still be present to sleep
+ * @param[in] deadline absolute CLOCK_MONOTONIC deadline, or NULL to wait indefinitely
+ * @param[in] bitset the wake mask this waiter answers to
+ *
+ * @return 0 if woken or the value changed, J9THREAD_TIMED_OUT if the deadline passed
+ */
+intptr_t
+omrthread_futex_wait(volatile uint32_t *address, uint32_t expected, const struct timespec *deadline, uint32_t bitset)
+{
+	intptr_t rc = 0;
+	if (-1 == syscall(SYS_futex, address, FUTEX_WAIT_BITSET_PRIVATE, expected, deadline, NULL, bitset)) {
+		if (ETIMEDOUT == errno) {
+			rc = J9THREAD_TIMED_OUT;
+		}
+	}
+	return rc;
+}
+
+/**
+ * Wake threads sleeping on a futex word.
+ *
+ * @param[in] address the futex word
+ * @param[in] count the maximum number of threads to wake
+ * @param[in] bitset wake only waiters whose mask intersects this one
+ */
+void
+omrthread_futex_wake(volatile uint32_t *address, int32_t count, uint32_t bitset)
+{
+	syscall(SYS_futex, address, FUTEX_WAKE_BITSET_PRIVATE, count, NULL, NULL, bitset);
+}
+
+/**
+ * Move every thread sleeping on one futex word onto another without waking them.
+ * Used by notifyAll so that waiters queue on the monitor's lock word and are
+ * released one at a time as the monitor is exited.
+ *
+ * @param[in] address the futex word the threads sleep on
+ * @param[in] target the futex word to move them to
+ */
+void
+omrthread_futex_requeue(volatile uint32_t *address, volatile uint32_t *target)
+{
+	uint32_t expected = *address;
+	/* An interrupt may advance the word concurrently; retry with the new value */
+	while ((-1 == syscall(SYS_futex, address, FUTEX_CMP_REQUEUE_PRIVATE, 0, (long)INT_MAX, target, expected))
+		&& (EAGAIN == errno)
+	) {
+		expected = *address;
+	}
+}
+
+/**
+ * Atomically advance a futex sequence word so that threads about to sleep on the
+ * old value return immediately.
+ *
+ * @param[in] address the futex word
+ *
+ * @return the new value
+ */
+uint32_t
+omrthread_futex_advance(volatile uint32_t *address)
+{
+	return VM_AtomicSupport::addU32(address, 1);
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
 /**
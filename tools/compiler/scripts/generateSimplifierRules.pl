@@ -0,0 +1,338 @@
+#!/bin/perl
+
+###############################################################################
+# Copyright IBM Corp. and others 2026
+#
+# This program and the accompanying materials are made available under
+# the terms of the Eclipse Public License 2.0 which accompanies this
+# distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+# or the Apache License, Version 2.0 which accompanies this distribution and
+# is available at https://www.apache.org/licenses/LICENSE-2.0.
+#
+# This Source Code may also be made available under the following
+# Secondary Licenses when the conditions for such availability set
+# forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+# General Public License, version 2 with the GNU Classpath
+# Exception [1] and GNU General Public License, version 2 with the
+# OpenJDK Assembly Exception [2].
+#
+# [1] https://www.gnu.org/software/classpath/license.html
+# [2] https://openjdk.org/legal/assembly-exception.html
+#
+# SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+###############################################################################
+
+# Compiles the simplifier's rewrite rules into C++.
+#
+# Every rule has the form
+#
+#    <name>: <pattern> => <result> [when <condition>]
+#
+# where the pattern and the result are trees written as (<opcode> <operand>...).
+# An operand is another tree, a variable, or a constant written as (iconst <n>)
+# or (lconst <n>). A variable that appears more than once in a pattern must
+# match the same node each time. The condition is a C++ expression in which
+# $<variable> stands for the node bound to the variable. See
+# doc/compiler/optimizer/SimplifierRules.md.
+#
+# The rules for each root opcode are merged into a decision tree that tests
+# every node position once, switching on its opcode, so the cost of matching
+# does not grow with the number of rules that share a prefix.
+
+use strict;
+use warnings;
+
+die("\nUsage:\n  $0 rules_file output\n") unless (@ARGV == 2);
+
+my ($rulesFile, $outFile) = @ARGV;
+
+my %constValue = (iconst => 'getInt()', lconst => 'getLongInt()');
+my %constCreate = (iconst => 'TR::Node::iconst', lconst => 'TR::Node::lconst');
+my %constSet = (iconst => 'setInt', lconst => 'setLongInt');
+
+my @rules;
+my %arity;
+my %ruleNames;
+my $lineNumber = 0;
+
+sub fail {
+    my ($message) = @_;
+    die("$rulesFile:$lineNumber: $message\n");
+}
+
+sub parseTree {
+    my ($tokens) = @_;
+    my $token = shift @$tokens;
+    fail("unexpected end of rule") unless defined $token;
+
+    if ($token eq '(') {
+        my $op = shift @$tokens;
+        fail("expected an opcode after '('") unless defined $op && $op =~ /^[A-Za-z_]\w*$/;
+        my @operands;
+        push @operands, parseTree($tokens) while (@$tokens && $tokens->[0] ne ')');
+        fail("missing ')'") unless @$tokens;
+        shift @$tokens;
+
+        if (exists $constValue{$op}) {
+            fail("$op takes a single integer") unless @operands == 1 && exists $operands[0]{int};
+            return { const => $op, value => $operands[0]{int} };
+        }
+        fail("$op has more than 9 operands") if @operands > 9;
+        return { op => $op, operands => \@operands };
+    }
+
+    return { int => $token } if $token =~ /^-?\d+$/;
+    return { var => $token } if $token =~ /^[A-Za-z_]\w*$/;
+    fail("unexpected '$token'");
+}
+
+sub parse {
+    my ($text) = @_;
+    my @tokens = ($text =~ /\(|\)|[^\s()]+/g);
+    my $tree = parseTree(\@tokens);
+    fail("unexpected '$tokens[0]'") if @tokens;
+    return $tree;
+}
+
+sub nodeAt {
+    my ($path) = @_;
+    return $path eq '' ? 'node' : "n_$path";
+}
+
+sub checkArity {
+    my ($op, $count) = @_;
+    fail("$op is used with both $arity{$op} and $count operands") if exists $arity{$op} && $arity{$op} != $count;
+    $arity{$op} = $count;
+}
+
+# Record the tests a pattern makes: the opcode at each position, and the
+# constant values and repeated variables that are checked once the opcodes
+# have matched.
+sub flatten {
+    my ($rule, $tree, $path) = @_;
+    $rule->{paths}{$path} = 1;
+
+    if (exists $tree->{op}) {
+        checkArity($tree->{op}, scalar @{$tree->{operands}});
+        $rule->{opcodes}{$path} = $tree->{op};
+        my $i = 0;
+        flatten($rule, $_, $path . $i++) for @{$tree->{operands}};
+    } elsif (exists $tree->{const}) {
+        $rule->{opcodes}{$path} = $tree->{const};
+        push @{$rule->{checks}}, nodeAt($path) . "->$constValue{$tree->{const}} == $tree->{value}";
+    } elsif (exists $tree->{var}) {
+        if (exists $rule->{vars}{$tree->{var}}) {
+            push @{$rule->{checks}}, nodeAt($path) . " == " . nodeAt($rule->{vars}{$tree->{var}});
+        } else {
+            $rule->{vars}{$tree->{var}} = $path;
+        }
+    } else {
+        fail("integers may only appear in constants");
+    }
+}
+
+sub usedVars {
+    my ($tree, $used) = @_;
+    $used->{$tree->{var}} = 1 if exists $tree->{var};
+    usedVars($_, $used) for @{$tree->{operands} || []};
+}
+
+sub buildOperand {
+    my ($rule, $tree) = @_;
+    if (exists $tree->{var}) {
+        fail("'$tree->{var}' is not bound by the pattern") unless exists $rule->{vars}{$tree->{var}};
+        return nodeAt($rule->{vars}{$tree->{var}});
+    }
+    return "$constCreate{$tree->{const}}(node, $tree->{value})" if exists $tree->{const};
+    fail("integers may only appear in constants") unless exists $tree->{op};
+
+    checkArity($tree->{op}, scalar @{$tree->{operands}});
+    fail("new nodes need at least one operand") unless @{$tree->{operands}};
+    fail("new nodes take at most 3 operands") if @{$tree->{operands}} > 3;
+    my @operands = map { buildOperand($rule, $_) } @{$tree->{operands}};
+    return "TR::Node::create(node, TR::$tree->{op}, " . scalar(@operands) . ", " . join(', ', @operands) . ")";
+}
+
+# The statements that replace the matched node with the rule's result.
+sub buildResult {
+    my ($rule) = @_;
+    my $result = $rule->{result};
+
+    if (exists $result->{var}) {
+        return ("return rewriteToNode(node, " . buildOperand($rule, $result) . ");");
+    }
+
+    if (exists $result->{const}) {
+        return (
+            "anchorChildren(node, _curTree);",
+            "prepareToReplaceNode(node, TR::$result->{const});",
+            "node->$constSet{$result->{const}}($result->{value});",
+            "return node;"
+        );
+    }
+
+    # The node is rewritten in place, so every subtree the pattern bound must
+    # still be used; anything else would silently drop its side effects.
+    my %used;
+    usedVars($result, \%used);
+    for my $var (sort keys %{$rule->{vars}}) {
+        fail("'$var' is not used by the result; only results that are a variable or a constant may drop operands")
+            unless $used{$var};
+    }
+
+    checkArity($result->{op}, scalar @{$result->{operands}});
+    fail("results take at most 3 operands") if @{$result->{operands}} > 3;
+    my @operands = map { buildOperand($rule, $_) } @{$result->{operands}};
+    return ("return rewriteInPlace(node, TR::$result->{op}, " . join(', ', scalar(@operands), @operands) . ");");
+}
+
+open(my $in, '<', $rulesFile) or die("Cannot read $rulesFile\n");
+while (my $line = <$in>) {
+    $lineNumber++;
+    $line =~ s/#.*$//;
+    next if $line =~ /^\s*$/;
+
+    $line =~ /^\s*(\w+)\s*:\s*(.*?)\s*=>\s*(.*?)\s*(?:\bwhen\b\s*(.*?))?\s*$/
+        or fail("expected '<name>: <pattern> => <result> [when <condition>]'");
+    my ($name, $patternText, $resultText, $condition) = ($1, $2, $3, $4);
+
+    fail("rule $name is defined twice") if $ruleNames{$name}++;
+
+    my $rule = { name => $name, line => $lineNumber, text => "$patternText => $resultText", checks => [], vars => {} };
+    my $pattern = parse($patternText);
+    fail("the pattern of $name must start with an opcode") unless exists $pattern->{op};
+    flatten($rule, $pattern, '');
+
+    if (defined $condition) {
+        $rule->{text} .= " when $condition";
+        $condition =~ s/\$(\w+)/exists $rule->{vars}{$1} ? nodeAt($rule->{vars}{$1}) : fail("'\$$1' is not bound by the pattern")/ge;
+        push @{$rule->{checks}}, "($condition)";
+    }
+
+    $rule->{result} = parse($resultText);
+    $rule->{statements} = [ buildResult($rule) ];
+    push @rules, $rule;
+}
+close($in);
+
+my @code;
+
+sub emit {
+    my ($depth, $text) = @_;
+    push @code, ('    ' x $depth) . $text;
+}
+
+sub emitCandidates {
+    my ($rules, $depth) = @_;
+    for my $rule (@$rules) {
+        emit($depth, "// $rule->{name}: $rule->{text}");
+        my $test = join(' && ', @{$rule->{checks}}, "performRewrite(\"$rule->{name}\", node)");
+        emit($depth, "if ($test) {");
+        emit($depth + 1, $_) for @{$rule->{statements}};
+        emit($depth, "}");
+    }
+}
+
+# Emit a decision tree for rules that agree on the opcodes at every position
+# in $tested. The next position tested is the first one in preorder that some
+# rule still has to check, so a node is always tested before its operands.
+# Rules that need a particular opcode there are tried before rules that
+# accept any node there.
+sub emitTree {
+    my ($rules, $tested, $depth) = @_;
+
+    my $next;
+    for my $rule (@$rules) {
+        for my $path (keys %{$rule->{opcodes}}) {
+            $next = $path if !$tested->{$path} && (!defined $next || $path lt $next);
+        }
+    }
+
+    if (!defined $next) {
+        emitCandidates($rules, $depth);
+        return;
+    }
+
+    my (%byOpcode, @opcodes, @anyOpcode);
+    for my $rule (@$rules) {
+        my $op = $rule->{opcodes}{$next};
+        if (defined $op) {
+            push @opcodes, $op unless $byOpcode{$op};
+            push @{$byOpcode{$op}}, $rule;
+        } else {
+            push @anyOpcode, $rule;
+        }
+    }
+
+    my %nowTested = (%$tested, $next => 1);
+    my $node = nodeAt($next);
+
+    emit($depth, "switch ($node->getOpCodeValue()) {");
+    for my $op (@opcodes) {
+        my $group = $byOpcode{$op};
+        emit($depth + 1, "case TR::$op: {");
+        my $count = $arity{$op} || 0;
+        if ($count > 0 && !exists $constValue{$op}) {
+            emit($depth + 2, "if ($node->getNumChildren() != $count)");
+            emit($depth + 3, "break;");
+            for my $i (0 .. $count - 1) {
+                my $child = $next . $i;
+                next unless grep { $_->{paths}{$child} } @$group;
+                emit($depth + 2, "TR::Node *" . nodeAt($child) . " = $node->getChild($i);");
+            }
+        }
+        emitTree($group, \%nowTested, $depth + 2);
+        emit($depth + 2, "break;");
+        emit($depth + 1, "}");
+    }
+    emit($depth + 1, "default:");
+    emit($depth + 2, "break;");
+    emit($depth, "}");
+
+    emitTree(\@anyOpcode, \%nowTested, $depth) if @anyOpcode;
+}
+
+my %rootOpcodes;
+$rootOpcodes{$_->{opcodes}{''}} = 1 for @rules;
+
+my $source = $rulesFile;
+$source =~ s/^.*\/(compiler\/)/$1/;
+
+emit(0, "// Generated by tools/compiler/scripts/generateSimplifierRules.pl from $source.");
+emit(0, "// Do not edit.");
+emit(0, "");
+emit(0, "#include \"optimizer/Simplifier.hpp\"");
+emit(0, "");
+emit(0, "#include \"il/ILOpCodes.hpp\"");
+emit(0, "#include \"il/Node.hpp\"");
+emit(0, "#include \"il/Node_inlines.hpp\"");
+emit(0, "");
+emit(0, "bool OMR::Simplifier::hasRewriteRules(TR::ILOpCodes op)");
+emit(0, "{");
+emit(1, "switch (op) {");
+emit(2, "case TR::$_:") for sort keys %rootOpcodes;
+emit(3, "return true;") if %rootOpcodes;
+emit(2, "default:");
+emit(3, "return false;");
+emit(1, "}");
+emit(0, "}");
+emit(0, "");
+emit(0, "TR::Node *OMR::Simplifier::applyRewriteRules(TR::Node *node)");
+emit(0, "{");
+emitTree(\@rules, {}, 1) if @rules;
+emit(1, "return NULL;");
+emit(0, "}");
+
+my $code = join("\n", @code) . "\n";
+
+my $oldCode = '';
+if (open(my $old, '<', $outFile)) {
+    $oldCode = join('', <$old>);
+    close($old);
+}
+
+if ($code ne $oldCode) {
+    open(my $out, '>', $outFile) or die("Cannot write to $outFile\n");
+    print $out $code;
+    close($out);
+}